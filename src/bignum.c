@@ -0,0 +1,692 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bignum.h"
+
+_Static_assert (sizeof (intmax_t) == sizeof (uint64_t),
+                "a fixnum must fit a limb");
+
+#define LIMB_BITS 64
+
+typedef unsigned __int128 dlimb_t;
+
+/* Radix conversion works in chunks of DIGITS digits, BASE being RADIX to
+   that power, the most that fits a limb.  POWERS[I] is BASE to the power
+   2^I, SIZES[I] limbs long.  */
+typedef struct Conversion
+{
+  int radix;
+  unsigned digits;
+  uint64_t base;
+  size_t npowers;
+  uint64_t *powers[LIMB_BITS];
+  size_t sizes[LIMB_BITS];
+} conversion_t;
+
+static const char digit_chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+/* Arithmetic on magnitudes held as arrays of limbs.  Sizes are in limbs
+   and results go to arrays the caller provides.  */
+
+static size_t
+limbs_trim (const uint64_t *a, size_t n)
+{
+  while (n && !a[n - 1])
+    n--;
+  return n;
+}
+
+static int
+limbs_compare (const uint64_t *a, size_t an, const uint64_t *b, size_t bn)
+{
+  if (an != bn)
+    return an < bn ? -1 : 1;
+  while (an--)
+    if (a[an] != b[an])
+      return a[an] < b[an] ? -1 : 1;
+  return 0;
+}
+
+/* R = A + B for AN >= BN, returning the carry out of the top limb.  R may
+   be A.  */
+static uint64_t
+limbs_add (uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b,
+           size_t bn)
+{
+  uint64_t carry = 0;
+  size_t i = 0;
+  for (; i < bn; i++)
+    {
+      uint64_t s;
+      bool c1 = __builtin_add_overflow (a[i], b[i], &s);
+      bool c2 = __builtin_add_overflow (s, carry, &r[i]);
+      carry = c1 | c2;
+    }
+  for (; i < an; i++)
+    carry = __builtin_add_overflow (a[i], carry, &r[i]);
+  return carry;
+}
+
+/* R = A - B for AN >= BN, returning the borrow out of the top limb.  R
+   may be A.  */
+static uint64_t
+limbs_sub (uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b,
+           size_t bn)
+{
+  uint64_t borrow = 0;
+  size_t i = 0;
+  for (; i < bn; i++)
+    {
+      uint64_t d;
+      bool b1 = __builtin_sub_overflow (a[i], b[i], &d);
+      bool b2 = __builtin_sub_overflow (d, borrow, &r[i]);
+      borrow = b1 | b2;
+    }
+  for (; i < an; i++)
+    borrow = __builtin_sub_overflow (a[i], borrow, &r[i]);
+  return borrow;
+}
+
+/* R[0, RN) += A[0, AN), carrying as far as it goes.  */
+static uint64_t
+limbs_add_into (uint64_t *r, size_t rn, const uint64_t *a, size_t an)
+{
+  uint64_t carry = limbs_add (r, r, an, a, an);
+  for (size_t i = an; carry && i < rn; i++)
+    carry = ++r[i] == 0;
+  return carry;
+}
+
+/* R[0, RN) -= A[0, AN), borrowing as far as it goes.  */
+static uint64_t
+limbs_sub_from (uint64_t *r, size_t rn, const uint64_t *a, size_t an)
+{
+  uint64_t borrow = limbs_sub (r, r, an, a, an);
+  for (size_t i = an; borrow && i < rn; i++)
+    borrow = r[i]-- == 0;
+  return borrow;
+}
+
+/* R = A * M, returning the limb carried out.  R may be A.  */
+static uint64_t
+limbs_mul_1 (uint64_t *r, const uint64_t *a, size_t n, uint64_t m)
+{
+  uint64_t carry = 0;
+  for (size_t i = 0; i < n; i++)
+    {
+      dlimb_t p = (dlimb_t)a[i] * m + carry;
+      r[i] = (uint64_t)p;
+      carry = (uint64_t)(p >> LIMB_BITS);
+    }
+  return carry;
+}
+
+/* R += A * M, returning the limb carried out.  */
+static uint64_t
+limbs_addmul_1 (uint64_t *r, const uint64_t *a, size_t n, uint64_t m)
+{
+  uint64_t carry = 0;
+  for (size_t i = 0; i < n; i++)
+    {
+      dlimb_t p = (dlimb_t)a[i] * m + r[i] + carry;
+      r[i] = (uint64_t)p;
+      carry = (uint64_t)(p >> LIMB_BITS);
+    }
+  return carry;
+}
+
+/* R -= A * M, returning the limb borrowed.  */
+static uint64_t
+limbs_submul_1 (uint64_t *r, const uint64_t *a, size_t n, uint64_t m)
+{
+  uint64_t borrow = 0;
+  for (size_t i = 0; i < n; i++)
+    {
+      dlimb_t p = (dlimb_t)a[i] * m + borrow;
+      uint64_t lo = (uint64_t)p;
+      borrow = (uint64_t)(p >> LIMB_BITS) + (r[i] < lo);
+      r[i] -= lo;
+    }
+  return borrow;
+}
+
+static void
+limbs_mul_basecase (uint64_t *r, const uint64_t *a, size_t an,
+                    const uint64_t *b, size_t bn)
+{
+  r[an] = limbs_mul_1 (r, a, an, b[0]);
+  for (size_t j = 1; j < bn; j++)
+    r[an + j] = limbs_addmul_1 (r + j, a, an, b[j]);
+}
+
+/* R = A * B, AN + BN limbs, R apart from both.  Karatsuba splits the
+   longer operand at H limbs and makes three half-size products of four;
+   an operand too short to split that way is multiplied into the longer
+   one a slice at a time.  */
+static void
+limbs_mul (uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b,
+           size_t bn)
+{
+  if (an < bn)
+    {
+      const uint64_t *t = a;
+      a = b;
+      b = t;
+      size_t tn = an;
+      an = bn;
+      bn = tn;
+    }
+  if (bn < BIGNUM_KARATSUBA_THRESHOLD)
+    {
+      limbs_mul_basecase (r, a, an, b, bn);
+      return;
+    }
+
+  size_t h = (an + 1) / 2;
+  if (bn <= h)
+    {
+      uint64_t *t = malloc (2 * bn * sizeof (uint64_t));
+      memset (r, 0, (an + bn) * sizeof (uint64_t));
+      for (size_t i = 0; i < an; i += bn)
+        {
+          size_t k = an - i < bn ? an - i : bn;
+          limbs_mul (t, a + i, k, b, bn);
+          limbs_add_into (r + i, an + bn - i, t, k + bn);
+        }
+      free (t);
+      return;
+    }
+
+  /* With A = A1 B^H + A0 and B likewise, the middle term A1 B0 + A0 B1 is
+     (A0 + A1)(B0 + B1) less the outer two products.  */
+  const uint64_t *a0 = a, *a1 = a + h, *b0 = b, *b1 = b + h;
+  size_t a1n = an - h, b1n = bn - h;
+  uint64_t *t = malloc ((4 * h + 4) * sizeof (uint64_t));
+  uint64_t *sa = t, *sb = t + h + 1, *mid = t + 2 * h + 2;
+  sa[h] = limbs_add (sa, a0, h, a1, a1n);
+  sb[h] = limbs_add (sb, b0, h, b1, b1n);
+  limbs_mul (mid, sa, h + 1, sb, h + 1);
+  limbs_mul (r, a0, h, b0, h);
+  limbs_mul (r + 2 * h, a1, a1n, b1, b1n);
+  limbs_sub_from (mid, 2 * h + 2, r, 2 * h);
+  limbs_sub_from (mid, 2 * h + 2, r + 2 * h, a1n + b1n);
+  limbs_add_into (r + h, an + bn - h, mid, limbs_trim (mid, 2 * h + 2));
+  free (t);
+}
+
+/* Q = A / D, returning A % D.  Q may be A.  */
+static uint64_t
+limbs_divmod_1 (uint64_t *q, const uint64_t *a, size_t n, uint64_t d)
+{
+  uint64_t rem = 0;
+  for (size_t i = n; i--;)
+    {
+      dlimb_t x = ((dlimb_t)rem << LIMB_BITS) | a[i];
+      q[i] = (uint64_t)(x / d);
+      rem = (uint64_t)(x % d);
+    }
+  return rem;
+}
+
+/* R = A << S for S < LIMB_BITS, returning the bits shifted out.  */
+static uint64_t
+limbs_shift_left (uint64_t *r, const uint64_t *a, size_t n, unsigned s)
+{
+  if (!s)
+    {
+      memmove (r, a, n * sizeof (uint64_t));
+      return 0;
+    }
+  uint64_t carry = 0;
+  for (size_t i = 0; i < n; i++)
+    {
+      uint64_t x = a[i];
+      r[i] = (x << s) | carry;
+      carry = x >> (LIMB_BITS - s);
+    }
+  return carry;
+}
+
+/* R = A >> S for S < LIMB_BITS.  */
+static void
+limbs_shift_right (uint64_t *r, const uint64_t *a, size_t n, unsigned s)
+{
+  if (!s)
+    {
+      memmove (r, a, n * sizeof (uint64_t));
+      return;
+    }
+  for (size_t i = 0; i < n; i++)
+    r[i] = (a[i] >> s) | (i + 1 < n ? a[i + 1] << (LIMB_BITS - s) : 0);
+}
+
+/* Q = A / B and R = A % B for AN >= BN >= 2 by Knuth's algorithm D: both
+   are shifted until B's top bit is set, then each quotient limb is
+   estimated from the top two limbs of the running remainder, corrected
+   with B's second limb, and is at worst one too large.  Q has
+   AN - BN + 1 limbs and R has BN.  */
+static void
+limbs_divmod (uint64_t *q, uint64_t *r, const uint64_t *a, size_t an,
+              const uint64_t *b, size_t bn)
+{
+  unsigned s = __builtin_clzll (b[bn - 1]);
+  uint64_t *u = malloc ((an + 1 + bn) * sizeof (uint64_t));
+  uint64_t *v = u + an + 1;
+  limbs_shift_left (v, b, bn, s);
+  u[an] = limbs_shift_left (u, a, an, s);
+
+  uint64_t vtop = v[bn - 1], vnext = v[bn - 2];
+  for (size_t j = an - bn + 1; j--;)
+    {
+      dlimb_t num = ((dlimb_t)u[j + bn] << LIMB_BITS) | u[j + bn - 1];
+      dlimb_t qhat = num / vtop, rhat = num % vtop;
+      while (qhat >> LIMB_BITS
+             || qhat * vnext > ((rhat << LIMB_BITS) | u[j + bn - 2]))
+        {
+          qhat--;
+          rhat += vtop;
+          if (rhat >> LIMB_BITS)
+            break;
+        }
+
+      uint64_t borrow = limbs_submul_1 (u + j, v, bn, (uint64_t)qhat);
+      if (u[j + bn] < borrow)
+        {
+          qhat--;
+          u[j + bn] += limbs_add (u + j, u + j, bn, v, bn);
+        }
+      u[j + bn] -= borrow;
+      q[j] = (uint64_t)qhat;
+    }
+
+  limbs_shift_right (r, u, bn, s);
+  free (u);
+}
+
+/* Bignums on top of the limb routines.  Results are fresh and trimmed;
+   the caller owns them.  */
+
+static bignum_t *
+bignum_alloc (size_t size)
+{
+  bignum_t *b = malloc (sizeof (bignum_t));
+  b->negative = false;
+  b->size = size;
+  b->limbs = malloc ((size ? size : 1) * sizeof (uint64_t));
+  return b;
+}
+
+static bignum_t *
+bignum_trim (bignum_t *b)
+{
+  b->size = limbs_trim (b->limbs, b->size);
+  if (!b->size)
+    b->negative = false;
+  return b;
+}
+
+bignum_t *
+bignum_copy (const bignum_t *a)
+{
+  bignum_t *b = bignum_alloc (a->size);
+  memcpy (b->limbs, a->limbs, a->size * sizeof (uint64_t));
+  b->negative = a->negative;
+  return b;
+}
+
+bignum_t *
+bignum_new_int (intmax_t v)
+{
+  bignum_t tmp;
+  uint64_t limb;
+  return bignum_copy (bignum_view (&tmp, &limb, v));
+}
+
+void
+bignum_release (bignum_t *b)
+{
+  free (b->limbs);
+  free (b);
+}
+
+bool
+bignum_fits_int (const bignum_t *b, intmax_t *v)
+{
+  if (b->size > 1)
+    return false;
+  uint64_t m = b->size ? b->limbs[0] : 0;
+  if (m > (uint64_t)INTMAX_MAX + b->negative)
+    return false;
+  *v = b->negative ? (intmax_t)(0 - m) : (intmax_t)m;
+  return true;
+}
+
+/* Rounded to nearest: the top 64 bits go through the hardware conversion
+   with every lower bit folded into the last one, so ties are broken only
+   when they are exact.  */
+double
+bignum_to_double (const bignum_t *b)
+{
+  size_t n = b->size;
+  if (!n)
+    return 0.0;
+  if (n > 1024 / LIMB_BITS + 1)
+    return b->negative ? -HUGE_VAL : HUGE_VAL;
+
+  unsigned s = __builtin_clzll (b->limbs[n - 1]);
+  uint64_t hi = b->limbs[n - 1] << s, sticky = 0;
+  if (n > 1)
+    {
+      if (s)
+        hi |= b->limbs[n - 2] >> (LIMB_BITS - s);
+      sticky = b->limbs[n - 2] << s;
+      for (size_t i = 0; i < n - 2; i++)
+        sticky |= b->limbs[i];
+    }
+  double d = ldexp ((double)(hi | (sticky != 0)),
+                    (int)(LIMB_BITS * (n - 1)) - (int)s);
+  return b->negative ? -d : d;
+}
+
+uint32_t
+bignum_hash (const bignum_t *b)
+{
+  uint64_t h = b->negative ? 0x9e3779b97f4a7c15ull : 0;
+  for (size_t i = 0; i < b->size; i++)
+    {
+      h ^= b->limbs[i];
+      h *= 0xff51afd7ed558ccdull;
+      h ^= h >> 33;
+    }
+  return (uint32_t)(h ^ (h >> 32));
+}
+
+int
+bignum_compare (const bignum_t *a, const bignum_t *b)
+{
+  if (a->negative != b->negative)
+    return a->negative ? -1 : 1;
+  int c = limbs_compare (a->limbs, a->size, b->limbs, b->size);
+  return a->negative ? -c : c;
+}
+
+/* A + B with B taken as negative if BNEG.  */
+static bignum_t *
+add_signed (const bignum_t *a, const bignum_t *b, bool bneg)
+{
+  bool aneg = a->negative;
+  if (aneg == bneg)
+    {
+      if (a->size < b->size)
+        {
+          const bignum_t *t = a;
+          a = b;
+          b = t;
+        }
+      bignum_t *r = bignum_alloc (a->size + 1);
+      r->limbs[a->size]
+          = limbs_add (r->limbs, a->limbs, a->size, b->limbs, b->size);
+      r->negative = aneg;
+      return bignum_trim (r);
+    }
+
+  int c = limbs_compare (a->limbs, a->size, b->limbs, b->size);
+  if (c < 0)
+    {
+      const bignum_t *t = a;
+      a = b;
+      b = t;
+    }
+  bignum_t *r = bignum_alloc (a->size);
+  limbs_sub (r->limbs, a->limbs, a->size, b->limbs, b->size);
+  r->negative = c < 0 ? bneg : aneg;
+  return bignum_trim (r);
+}
+
+bignum_t *
+bignum_add (const bignum_t *a, const bignum_t *b)
+{
+  return add_signed (a, b, b->negative);
+}
+
+bignum_t *
+bignum_sub (const bignum_t *a, const bignum_t *b)
+{
+  return add_signed (a, b, !b->negative);
+}
+
+bignum_t *
+bignum_mul (const bignum_t *a, const bignum_t *b)
+{
+  if (!a->size || !b->size)
+    return bignum_alloc (0);
+
+  bignum_t *r = bignum_alloc (a->size + b->size);
+  limbs_mul (r->limbs, a->limbs, a->size, b->limbs, b->size);
+  r->negative = a->negative != b->negative;
+  return bignum_trim (r);
+}
+
+/* The quotient truncated toward zero and the remainder, which takes the
+   sign of A.  Either of QUOT and REM may be null if it is not wanted.  B
+   must not be zero.  */
+void
+bignum_divmod (const bignum_t *a, const bignum_t *b, bignum_t **quot,
+               bignum_t **rem)
+{
+  bignum_t *q, *r;
+  if (a->size < b->size)
+    {
+      q = bignum_alloc (0);
+      r = bignum_copy (a);
+    }
+  else if (b->size == 1)
+    {
+      q = bignum_alloc (a->size);
+      r = bignum_alloc (1);
+      r->limbs[0] = limbs_divmod_1 (q->limbs, a->limbs, a->size, b->limbs[0]);
+    }
+  else
+    {
+      q = bignum_alloc (a->size - b->size + 1);
+      r = bignum_alloc (b->size);
+      limbs_divmod (q->limbs, r->limbs, a->limbs, a->size, b->limbs,
+                    b->size);
+    }
+  q->negative = a->negative != b->negative;
+  r->negative = a->negative;
+  bignum_trim (q);
+  bignum_trim (r);
+
+  if (quot)
+    *quot = q;
+  else
+    bignum_release (q);
+  if (rem)
+    *rem = r;
+  else
+    bignum_release (r);
+}
+
+static void
+conversion_init (conversion_t *cv, int radix)
+{
+  cv->radix = radix;
+  cv->digits = 1;
+  cv->base = radix;
+  while (cv->base <= UINT64_MAX / radix)
+    {
+      cv->base *= radix;
+      cv->digits++;
+    }
+  cv->npowers = 0;
+}
+
+/* Square powers of the chunk base until the last one is at least half as
+   long as an N-limb number.  */
+static void
+conversion_powers (conversion_t *cv, size_t n)
+{
+  cv->powers[0] = malloc (sizeof (uint64_t));
+  cv->powers[0][0] = cv->base;
+  cv->sizes[0] = 1;
+  cv->npowers = 1;
+  while (2 * cv->sizes[cv->npowers - 1] <= n)
+    {
+      size_t i = cv->npowers++;
+      size_t pn = cv->sizes[i - 1];
+      cv->powers[i] = malloc (2 * pn * sizeof (uint64_t));
+      limbs_mul (cv->powers[i], cv->powers[i - 1], pn, cv->powers[i - 1], pn);
+      cv->sizes[i] = limbs_trim (cv->powers[i], 2 * pn);
+    }
+}
+
+static void
+conversion_release (conversion_t *cv)
+{
+  for (size_t i = 0; i < cv->npowers; i++)
+    free (cv->powers[i]);
+}
+
+/* Write the digits of A[0, AN) to end just before END, padded with zeros
+   to WIDTH digits, and return how many were written.  Zero with no width
+   writes nothing.  */
+static size_t
+write_digits_basecase (const conversion_t *cv, const uint64_t *a, size_t an,
+                       uint8_t *end, size_t width)
+{
+  uint64_t *t = malloc ((an ? an : 1) * sizeof (uint64_t));
+  memcpy (t, a, an * sizeof (uint64_t));
+  uint8_t *p = end;
+  while (an)
+    {
+      uint64_t chunk = limbs_divmod_1 (t, t, an, cv->base);
+      an = limbs_trim (t, an);
+      for (unsigned k = 0; k < cv->digits && (an || chunk); k++)
+        {
+          *--p = digit_chars[chunk % cv->radix];
+          chunk /= cv->radix;
+        }
+    }
+  while ((size_t)(end - p) < width)
+    *--p = '0';
+  free (t);
+  return end - p;
+}
+
+/* As write_digits_basecase, but a long number is first split by the
+   largest precomputed power at most half its length, and the halves are
+   written independently, the low half padded to the power's digits.
+   Each level's divisions cost about as much as one at the top, instead
+   of one division by a limb for every chunk of digits.  */
+static size_t
+write_digits (const conversion_t *cv, const uint64_t *a, size_t an,
+              uint8_t *end, size_t width)
+{
+  an = limbs_trim (a, an);
+  if (an <= BIGNUM_CONVERT_THRESHOLD)
+    return write_digits_basecase (cv, a, an, end, width);
+
+  size_t i = cv->npowers - 1;
+  while (cv->sizes[i] > (an + 1) / 2)
+    i--;
+  const uint64_t *p = cv->powers[i];
+  size_t pn = cv->sizes[i];
+
+  size_t qn = an - pn + 1;
+  uint64_t *q = malloc ((qn + pn) * sizeof (uint64_t)), *r = q + qn;
+  if (pn == 1)
+    r[0] = limbs_divmod_1 (q, a, an, p[0]);
+  else
+    limbs_divmod (q, r, a, an, p, pn);
+
+  size_t low = (size_t)cv->digits << i;
+  write_digits (cv, r, pn, end, low);
+  size_t high
+      = write_digits (cv, q, qn, end - low, width > low ? width - low : 0);
+  free (q);
+  return low + high;
+}
+
+/* B in RADIX, from 2 to 36, as a fresh buffer from malloc with a NUL
+   after its SIZE bytes.  */
+uint8_t *
+bignum_to_string (const bignum_t *b, int radix, size_t *size)
+{
+  if (!b->size)
+    {
+      uint8_t *zero = malloc (2);
+      memcpy (zero, "0", 2);
+      *size = 1;
+      return zero;
+    }
+
+  conversion_t cv;
+  conversion_init (&cv, radix);
+  if (b->size > BIGNUM_CONVERT_THRESHOLD)
+    conversion_powers (&cv, b->size);
+
+  unsigned bits_per_digit = 0;
+  while ((2 << bits_per_digit) <= radix)
+    bits_per_digit++;
+  size_t cap = b->size * LIMB_BITS / bits_per_digit + 2;
+  uint8_t *buf = malloc (cap + 1);
+  uint8_t *end = buf + cap;
+  uint8_t *start = end - write_digits (&cv, b->limbs, b->size, end, 0);
+  if (b->negative)
+    *--start = '-';
+  conversion_release (&cv);
+
+  *size = end - start;
+  memmove (buf, start, *size);
+  buf[*size] = '\0';
+  return buf;
+}
+
+/* S[0, N) as an optionally signed integer in RADIX, or null if it is not
+   one.  Digits are taken a chunk at a time, each a multiply and add by a
+   single limb.  */
+bignum_t *
+bignum_parse (const uint8_t *s, size_t n, int radix)
+{
+  size_t i = 0;
+  bool negative = false;
+  if (i < n && (s[i] == '+' || s[i] == '-'))
+    negative = s[i++] == '-';
+  if (i == n)
+    return NULL;
+
+  conversion_t cv;
+  conversion_init (&cv, radix);
+  bignum_t *b = bignum_alloc ((n - i) * 6 / LIMB_BITS + 2);
+  b->size = 0;
+  while (i < n)
+    {
+      uint64_t chunk = 0, scale = 1;
+      for (unsigned k = 0; k < cv.digits && i < n; k++, i++)
+        {
+          uint8_t c = s[i];
+          int v = c >= '0' && c <= '9'   ? c - '0'
+                  : c >= 'a' && c <= 'z' ? c - 'a' + 10
+                  : c >= 'A' && c <= 'Z' ? c - 'A' + 10
+                                         : radix;
+          if (v >= radix)
+            {
+              bignum_release (b);
+              return NULL;
+            }
+          chunk = chunk * radix + v;
+          scale *= radix;
+        }
+
+      uint64_t top = limbs_mul_1 (b->limbs, b->limbs, b->size, scale);
+      for (size_t j = 0; chunk && j < b->size; j++)
+        chunk = __builtin_add_overflow (b->limbs[j], chunk, &b->limbs[j]);
+      top += chunk;
+      if (top)
+        b->limbs[b->size++] = top;
+    }
+  b->negative = negative;
+  return bignum_trim (b);
+}
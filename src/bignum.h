@@ -0,0 +1,58 @@
+#ifndef BIGNUM_H
+#define BIGNUM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "object.h"
+
+/* Operands of at least this many limbs are multiplied by Karatsuba's
+   method; smaller ones by the schoolbook method.  */
+#define BIGNUM_KARATSUBA_THRESHOLD 32
+
+/* Numbers of at most this many limbs are converted to digits by repeated
+   division by a single limb; larger ones are split in halves by powers
+   of the radix first.  */
+#define BIGNUM_CONVERT_THRESHOLD 24
+
+/* An integer as its magnitude in SIZE 64-bit LIMBS, least significant
+   first, with no high zero limbs, and a sign.  Zero has no limbs and is
+   never negative.  */
+struct Bignum
+{
+  bool negative;
+  size_t size;
+  uint64_t *limbs;
+};
+
+/* Make TMP a view of V that borrows LIMB for storage, so fixnums can be
+   passed where bignums are expected without allocating.  */
+static inline bignum_t *
+bignum_view (bignum_t *tmp, uint64_t *limb, intmax_t v)
+{
+  tmp->negative = v < 0;
+  *limb = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+  tmp->size = *limb != 0;
+  tmp->limbs = limb;
+  return tmp;
+}
+
+bignum_t *bignum_new_int (intmax_t v);
+bignum_t *bignum_copy (const bignum_t *a);
+bignum_t *bignum_parse (const uint8_t *s, size_t n, int radix);
+void bignum_release (bignum_t *b);
+
+bool bignum_fits_int (const bignum_t *b, intmax_t *v);
+double bignum_to_double (const bignum_t *b);
+uint8_t *bignum_to_string (const bignum_t *b, int radix, size_t *size);
+uint32_t bignum_hash (const bignum_t *b);
+
+int bignum_compare (const bignum_t *a, const bignum_t *b);
+bignum_t *bignum_add (const bignum_t *a, const bignum_t *b);
+bignum_t *bignum_sub (const bignum_t *a, const bignum_t *b);
+bignum_t *bignum_mul (const bignum_t *a, const bignum_t *b);
+void bignum_divmod (const bignum_t *a, const bignum_t *b, bignum_t **quot,
+                    bignum_t **rem);
+
+#endif
@@ -1,10 +1,23 @@
 #include <complex.h>
 #include <inttypes.h>
 #include <math.h>
+#include <string.h>
+#include <sys/mman.h>
 
+#include "bignum.h"
+#include "builtin.h"
 #include "eval.h"
 #include "heap.h"
+#include "interp.h"
+#include "numvec.h"
 #include "object.h"
+#include "port.h"
+#include "reader.h"
+#include "regexp.h"
+#include "search.h"
+#include "text.h"
+#include "unicode.h"
+#include "utf8.h"
 
 #define PROMOTED_TO_NONE 0
 #define PROMOTED_TO_REAL 1
@@ -12,37 +25,17 @@
 
 typedef int promotion_t;
 
-extern heap_t *current_heap;
-extern object_t *object_nil;
-extern object_t *object_true;
-extern object_t *object_false;
-
-static inline object_t *
-deref_symbols (object_t *args, object_t *env)
-{
-  for (object_t *a = args; a; a = a->next)
-    {
-      if (a->type == OBJ_Symbol)
-        {
-          object_t **ap = &a;
-          object_t *ref = environ_retrieve (env->v_environ, a);
-          if (ref == NULL)
-            raise_runtime_error ("Symbol does not exist");
-          *ap = ref;
-        }
-    }
-}
-
 static inline promotion_t
-assess_promotion (object_t *args, const char *fnname)
+assess_promotion (object_t **args, size_t argc, const char *fnname)
 {
 
   promotion_t promotion = PROMOTED_TO_NONE;
-  for (object_t *a = args; a; a = a->next)
+  for (size_t i = 0; i < argc; i++)
     {
-      switch (a->type)
+      switch (args[i]->type)
         {
         case OBJ_Integer:
+        case OBJ_Bignum:
           continue;
         case OBJ_Real:
           if (promotion < PROMOTED_TO_REAL)
@@ -61,546 +54,756 @@ assess_promotion (object_t *args, const char *fnname)
   return promotion;
 }
 
+static inline bool
+is_exact (object_t *a)
+{
+  return a->type == OBJ_Integer || a->type == OBJ_Bignum;
+}
+
+/* An exact integer argument as a bignum; a fixnum is viewed in place
+   through TMP and LIMB.  */
+static inline const bignum_t *
+exact_arg (object_t *a, bignum_t *tmp, uint64_t *limb)
+{
+  if (a->type == OBJ_Bignum)
+    return a->v_bignum;
+  return bignum_view (tmp, limb, a->v_integer);
+}
+
+static inline double
+real_arg (object_t *a)
+{
+  switch (a->type)
+    {
+    case OBJ_Integer:
+      return a->v_integer;
+    case OBJ_Bignum:
+      return bignum_to_double (a->v_bignum);
+    default:
+      return a->v_real;
+    }
+}
+
+static inline double complex
+complex_arg (object_t *a)
+{
+  return a->type == OBJ_Complex ? a->v_complex : real_arg (a);
+}
+
+static int
+exact_compare (object_t *a, object_t *b)
+{
+  if (a->type == OBJ_Integer && b->type == OBJ_Integer)
+    return (a->v_integer > b->v_integer) - (a->v_integer < b->v_integer);
+
+  bignum_t ta, tb;
+  uint64_t la, lb;
+  return bignum_compare (exact_arg (a, &ta, &la), exact_arg (b, &tb, &lb));
+}
+
+static bignum_t *
+divide_truncated (const bignum_t *a, const bignum_t *b)
+{
+  bignum_t *q;
+  bignum_divmod (a, b, &q, NULL);
+  return q;
+}
+
+/* Fold the N arguments ARGS into ACC with OP in bignums, once a fixnum
+   result has overflowed or a bignum has turned up.  The result is demoted
+   if it fits a fixnum again.  */
+static object_t *
+exact_fold (bignum_t *acc, object_t **args, size_t n,
+            bignum_t *(*op) (const bignum_t *, const bignum_t *))
+{
+  for (size_t i = 0; i < n; i++)
+    {
+      bignum_t tmp;
+      uint64_t limb;
+      bignum_t *next = op (acc, exact_arg (args[i], &tmp, &limb));
+      bignum_release (acc);
+      acc = next;
+    }
+  return object_new_bignum (acc, current_heap);
+}
+
+/* Truncating division of exact integers.  Dividing the most negative
+   fixnum by -1 is the one fixnum quotient that overflows.  */
+static object_t *
+exact_quotient (object_t **args, size_t argc)
+{
+  for (size_t i = 1; i < argc; i++)
+    if (args[i]->type == OBJ_Integer && args[i]->v_integer == 0)
+      raise_runtime_error ("Division by zero");
+
+  if (args[0]->type == OBJ_Bignum)
+    return exact_fold (bignum_copy (args[0]->v_bignum), args + 1, argc - 1,
+                       divide_truncated);
+
+  intmax_t result = args[0]->v_integer;
+  size_t i = 1;
+  for (; i < argc && args[i]->type == OBJ_Integer; i++)
+    {
+      if (result == INTMAX_MIN && args[i]->v_integer == -1)
+        break;
+      result /= args[i]->v_integer;
+    }
+  if (i == argc)
+    return object_new_integer (result, current_heap);
+  return exact_fold (bignum_new_int (result), args + i, argc - i,
+                     divide_truncated);
+}
+
+/* The remainder of exact integers, with the sign of the dividend, or if
+   FLOORED with the sign of the divisor.  */
+static object_t *
+exact_remainder (object_t *dividend, object_t *divisor, bool floored)
+{
+  bignum_t ta, tb;
+  uint64_t la, lb;
+  const bignum_t *a = exact_arg (dividend, &ta, &la);
+  const bignum_t *b = exact_arg (divisor, &tb, &lb);
+  if (!b->size)
+    raise_runtime_error ("Division by zero");
+
+  bignum_t *rem;
+  bignum_divmod (a, b, NULL, &rem);
+  if (floored && rem->size && rem->negative != b->negative)
+    {
+      bignum_t *sum = bignum_add (rem, b);
+      bignum_release (rem);
+      rem = sum;
+    }
+  return object_new_bignum (rem, current_heap);
+}
+
+/* Exact sums, differences and products stay in fixnums until one
+   overflows, then carry on in bignums.  */
 object_t *
-builtin_add (object_t *args, object_t *env)
+builtin_add (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
+  if (argc == 0)
     return object_new_integer (0, current_heap);
 
-  deref_symbols (args, env);
-  promotion_t promotion = assess_promotion (args, "Addition");
+  promotion_t promotion = assess_promotion (args, argc, "Addition");
 
   switch (promotion)
     {
     case PROMOTED_TO_NONE:
-      intmax_t result = 0;
-      for (object_t *a = args; a; a = a->next)
-        result += a->v_integer;
-      return object_new_integer (result, current_heap);
+      {
+        intmax_t result = 0;
+        size_t i = 0;
+        for (; i < argc && args[i]->type == OBJ_Integer; i++)
+          {
+            intmax_t sum;
+            if (__builtin_add_overflow (result, args[i]->v_integer, &sum))
+              break;
+            result = sum;
+          }
+        if (i == argc)
+          return object_new_integer (result, current_heap);
+        return exact_fold (bignum_new_int (result), args + i, argc - i,
+                           bignum_add);
+      }
     case PROMOTED_TO_REAL:
-      double result = 0.0;
-      for (object_t *a = args; a; a = a->next)
-        {
-          if (a->type == OBJ_Integer)
-            result += a->v_integer;
-          else
-            result += a->v_real;
-        }
-      return object_new_real (result, current_heap);
+      {
+        double result = 0.0;
+        for (size_t i = 0; i < argc; i++)
+          result += real_arg (args[i]);
+        return object_new_real (result, current_heap);
+      }
     case PROMOTED_TO_COMPLEX:
-      double complex result = 0.0 * I;
-      for (object_t *a = args; a; a = a->next)
-        {
-          if (a->type == OBJ_Integer)
-            result += a->v_integer;
-          else if (a->type == OBJ_Real)
-            result += a->v_real;
-          else if (a->type == OBJ_Complex)
-            result += a->v_complex;
-        }
-      return object_new_complex (result, current_heap);
+      {
+        double complex result = 0.0;
+        for (size_t i = 0; i < argc; i++)
+          result += complex_arg (args[i]);
+        return object_new_complex (result, current_heap);
+      }
     default:
       return object_nil;
     }
 }
 
 object_t *
-builtin_subtract (object_t *args, object_t *env)
+builtin_subtract (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
+  if (argc == 0)
     return object_new_integer (0, current_heap);
 
-  deref_symbols (args, env);
-  promotion_t promotion = assess_promotion (args, "Subtraction");
+  promotion_t promotion = assess_promotion (args, argc, "Subtraction");
   switch (promotion)
     {
     case PROMOTED_TO_NONE:
-      intmax_t result = args->v_integer;
-      for (object_t *a = args->next; a; a = a->next)
-        result -= a->v_integer;
-      return object_new_integer (result, current_heap);
+      {
+        /* Negating the most negative fixnum is the one negation that
+           overflows.  */
+        if (argc == 1)
+          {
+            if (args[0]->type == OBJ_Integer
+                && args[0]->v_integer != INTMAX_MIN)
+              return object_new_integer (-args[0]->v_integer, current_heap);
+            return exact_fold (bignum_new_int (0), args, 1, bignum_sub);
+          }
+        if (args[0]->type == OBJ_Bignum)
+          return exact_fold (bignum_copy (args[0]->v_bignum), args + 1,
+                             argc - 1, bignum_sub);
+
+        intmax_t result = args[0]->v_integer;
+        size_t i = 1;
+        for (; i < argc && args[i]->type == OBJ_Integer; i++)
+          {
+            intmax_t difference;
+            if (__builtin_sub_overflow (result, args[i]->v_integer,
+                                        &difference))
+              break;
+            result = difference;
+          }
+        if (i == argc)
+          return object_new_integer (result, current_heap);
+        return exact_fold (bignum_new_int (result), args + i, argc - i,
+                           bignum_sub);
+      }
     case PROMOTED_TO_REAL:
-      double result = args->v_real;
-      for (object_t *a = args->next; a; a = a->next)
-        {
-          if (a->type == OBJ_Integer)
-            result -= a->v_integer;
-          else
-            result -= a->v_real;
-        }
-      return object_new_real (result, current_heap);
+      {
+        if (argc == 1)
+          return object_new_real (-real_arg (args[0]), current_heap);
+        double result = real_arg (args[0]);
+        for (size_t i = 1; i < argc; i++)
+          result -= real_arg (args[i]);
+        return object_new_real (result, current_heap);
+      }
     case PROMOTED_TO_COMPLEX:
-      double complex result = args->v_complex;
-      for (object_t *a = args->next; a; a = a->next)
-        {
-          if (a->type == OBJ_Integer)
-            result -= a->v_integer;
-          else if (a->type == OBJ_Real)
-            result -= a->v_real;
-          else
-            result -= a->v_complex;
-        }
-      return object_new_complex (result, current_heap);
+      {
+        if (argc == 1)
+          return object_new_complex (-complex_arg (args[0]), current_heap);
+        double complex result = complex_arg (args[0]);
+        for (size_t i = 1; i < argc; i++)
+          result -= complex_arg (args[i]);
+        return object_new_complex (result, current_heap);
+      }
     default:
       return object_nil;
     }
 }
 
 object_t *
-builtin_multiply (object_t *args, object_t *env)
+builtin_multiply (object_t **args, size_t argc, object_t *env)
 {
-  deref_symbols (args, env);
-  promotion_t promotion = assess_promotion (args, "Multiplication");
+  promotion_t promotion = assess_promotion (args, argc, "Multiplication");
   switch (promotion)
     {
     case PROMOTED_TO_NONE:
-      intmax_t result = 1;
-      for (object_t *a = args; a; a = a->next)
-        result *= a->v_integer;
-      return object_new_integer (result, current_heap);
-    case ROMOTED_TO_REAL:
-      double result = 1.0;
-      for (object_t *a = args; a; a = a->next)
-        {
-          if (a->type == OBJ_Integer)
-            result *= a->v_integer;
-          else
-            result *= a->v_real;
-        }
-      return object_new_real (result, current_heap);
+      {
+        intmax_t result = 1;
+        size_t i = 0;
+        for (; i < argc && args[i]->type == OBJ_Integer; i++)
+          {
+            intmax_t product;
+            if (__builtin_mul_overflow (result, args[i]->v_integer, &product))
+              break;
+            result = product;
+          }
+        if (i == argc)
+          return object_new_integer (result, current_heap);
+        return exact_fold (bignum_new_int (result), args + i, argc - i,
+                           bignum_mul);
+      }
+    case PROMOTED_TO_REAL:
+      {
+        double result = 1.0;
+        for (size_t i = 0; i < argc; i++)
+          result *= real_arg (args[i]);
+        return object_new_real (result, current_heap);
+      }
     case PROMOTED_TO_COMPLEX:
-      double complex result = 1.0 * I;
-      for (object_t *a = args; a; a = a->next)
-        {
-          if (a->type == OBJ_Integer)
-            result *= a->v_integer;
-          else if (a->type == OBJ_Real)
-            result *= a->v_real;
-          else
-            result *= a->v_complex;
-        }
-      return object_new_complex (result, current_heap);
+      {
+        double complex result = 1.0;
+        for (size_t i = 0; i < argc; i++)
+          result *= complex_arg (args[i]);
+        return object_new_complex (result, current_heap);
+      }
     default:
       return object_nil;
     }
 }
 
 object_t *
-builtin_divide (object_t *args, object_t *env)
+builtin_divide (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
+  if (argc == 0)
     return object_new_integer (0, current_heap);
 
-  deref_symbols (args, env);
-  promotion_t promotion = assess_promotion (args, "Division");
+  promotion_t promotion = assess_promotion (args, argc, "Division");
   switch (promotion)
     {
     case PROMOTED_TO_NONE:
-      intmax_t result = args->v_integer;
-      for (object_t *a = args->next; a; a = a->next)
-        {
-          if (a->v_integer == 0)
-            raise_runtime_error ("Division by zero");
-          result /= a->v_integer;
-        }
-      return object_new_integer (result, current_heap);
+      return exact_quotient (args, argc);
     case PROMOTED_TO_REAL:
-      double result = args->v_real;
-      for (object_t *a = args->next; a; a = a->next)
-        {
-          if (a->type == OBJ_Integer)
-            {
-              if (a->v_integer == 0)
-                raise_runtime_error ("Division by zero");
-              result -= a->v_integer;
-            }
-          else
-            {
-              if (a->v_real == 0.0)
-                raise_runtime_error ("Division by zero");
-              result -= a->v_real;
-            }
-        }
-      return object_new_real (result, current_heap);
+      {
+        double result = real_arg (args[0]);
+        for (size_t i = 1; i < argc; i++)
+          {
+            double d = real_arg (args[i]);
+            if (d == 0.0)
+              raise_runtime_error ("Division by zero");
+            result /= d;
+          }
+        return object_new_real (result, current_heap);
+      }
     case PROMOTED_TO_COMPLEX:
-      double complex result = args->v_complex;
-      for (object_t *a = args->next; a; a = a->next)
-        {
-          if (a->type == OBJ_Integer)
-            {
-              if (a->v_integer == 0)
-                raise_runtime_error ("Division by zero");
-              result -= a->v_integer;
-            }
-          else if (a->type == OBJ_Real)
-            {
-              if (a->v_real == 0.0)
-                raise_runtime_error ("Division by zero");
-              result -= a->v_real;
-            }
-          else
-            {
-              if (a->v_complex == 0.0 * I)
-                raise_runtime_error ("Division by zero");
-              result -= a->v_complex;
-            }
-        }
-      return object_new_complex (result, current_heap);
+      {
+        double complex result = complex_arg (args[0]);
+        for (size_t i = 1; i < argc; i++)
+          {
+            double complex z = complex_arg (args[i]);
+            if (z == 0.0)
+              raise_runtime_error ("Division by zero");
+            result /= z;
+          }
+        return object_new_complex (result, current_heap);
+      }
     default:
       return object_nil;
     }
 }
 
 object_t *
-builtin_quotient (object_t *args, object_t *env)
+builtin_quotient (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
+  if (argc == 0)
     return object_new_integer (0, current_heap);
 
-  deref_symbols (args, env);
-  promotion_t promotion = assess_promotion (args, "Quotient");
+  promotion_t promotion = assess_promotion (args, argc, "Quotient");
   if (promotion != PROMOTED_TO_NONE)
     raise_runtime_error ("Quotient only accepts integral values");
 
-  intmax_t result = args->v_integer;
-  for (object_t *a = args->next; a; a = a->next)
-    {
-      if (a->v_integer == 0)
-        raise_runtime_error ("Division by zero");
-      result /= a->v_integer;
-    }
-
-  return object_new_integer (result, current_heap);
+  return exact_quotient (args, argc);
 }
 
 object_t *
-builtin_modulo (object_t *args, object_t *env)
+builtin_modulo (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("Modulo takes 2 arguments");
 
-  deref_symbols (args, env);
-  promotion_t promotion = assess_promotion (args, "Modulo");
+  promotion_t promotion = assess_promotion (args, argc, "Modulo");
   if (promotion != PROMOTED_TO_NONE)
     raise_runtime_error ("Modulo only accepts integral values");
 
-  intmax_t dividend = imaxabs (args->v_integer);
-  intmax_t divisor = imaxabs (args->next->v_integer);
+  if (args[0]->type == OBJ_Bignum || args[1]->type == OBJ_Bignum)
+    return exact_remainder (args[0], args[1], true);
+
+  intmax_t dividend = args[0]->v_integer;
+  intmax_t divisor = args[1]->v_integer;
 
   if (divisor == 0)
     raise_runtime_error ("Division by zero");
+  if (divisor == -1)
+    return object_new_integer (0, current_heap);
 
   intmax_t result = dividend % divisor;
+  if (result && (result < 0) != (divisor < 0))
+    result += divisor;
 
   return object_new_integer (result, current_heap);
 }
 
 object_t *
-builtin_remainder (object_t *args, object_t *env)
+builtin_remainder (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("Remainder takes two arguments");
 
-  deref_symbols (args, env);
-  promotion_t promotion = assess_promotion (args, "Remainder");
+  promotion_t promotion = assess_promotion (args, argc, "Remainder");
   if (promotion != PROMOTED_TO_NONE)
     raise_runtime_error ("Remainder only accepts integral values");
 
-  intmax_t dividend = args->v_integer;
-  intmax_t divisor = args->next->v_integer;
+  if (args[0]->type == OBJ_Bignum || args[1]->type == OBJ_Bignum)
+    return exact_remainder (args[0], args[1], false);
+
+  intmax_t dividend = args[0]->v_integer;
+  intmax_t divisor = args[1]->v_integer;
 
   if (divisor == 0)
     raise_runtime_error ("Division by zero");
 
-  int sign = dividend / dividend;
-
-  intmax_t result = (imaxabs (dividend) % imaxabs (divisor)) * sign;
+  if (divisor == -1)
+    return object_new_integer (0, current_heap);
 
-  return object_new_integer (result, current_heap);
+  return object_new_integer (dividend % divisor, current_heap);
 }
 
-object_t *
-builtin_nums_equal (object_t *args, object_t *env)
+static double
+flonum_arg (object_t *a, const char *who)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("= takes at least two arguments");
+  if (a->type != OBJ_Real)
+    raise_runtime_error ("%s takes flonum arguments", who);
+  return a->v_real;
+}
 
-  deref_symbols (args, env);
-  promotion_t _ = assess_promotion (args, "=");
+/* The flonum operators, for calls the compiler does not see; direct calls
+   are compiled to float register code instead.  OP is one of + - * /.  */
+static object_t *
+flonum_fold (object_t **args, size_t argc, object_t *env, char op,
+             const char *who)
+{
+  if (argc == 0)
+    {
+      if (op == '-' || op == '/')
+        raise_runtime_error ("%s takes at least one argument", who);
+      return object_new_real (op == '+' ? 0.0 : 1.0, current_heap);
+    }
 
-  bool result = false;
-  for (object_t *a = args; a; a = a->next)
+  double result = flonum_arg (args[0], who);
+  if (argc == 1 && op == '-')
+    result = -result;
+  else if (argc == 1 && op == '/')
+    result = 1.0 / result;
+  for (size_t i = 1; i < argc; i++)
     {
-      for (object_t *b = args->next; b; b = b->next)
+      double v = flonum_arg (args[i], who);
+      switch (op)
         {
-          if (a->type != b->type)
-            return object_false;
-          switch (a->type)
-            {
-            case OBJ_Integer:
-              result = a->v_integer == b->v_integer;
-              continue;
-            case OBJ_Real:
-              result = a->v_real == b->v_real;
-              continue;
-            case OBJ_Complex:
-              result = a->v_complex == b->v_complex;
-              i continue;
-            }
+        case '+':
+          result += v;
+          break;
+        case '-':
+          result -= v;
+          break;
+        case '*':
+          result *= v;
+          break;
+        default:
+          result /= v;
+          break;
         }
     }
+  return object_new_real (result, current_heap);
+}
 
-  return result ? object_true : object_false;
+object_t *
+builtin_fl_add (object_t **args, size_t argc, object_t *env)
+{
+  return flonum_fold (args, argc, env, '+', "fl+");
+}
+
+object_t *
+builtin_fl_subtract (object_t **args, size_t argc, object_t *env)
+{
+  return flonum_fold (args, argc, env, '-', "fl-");
+}
+
+object_t *
+builtin_fl_multiply (object_t **args, size_t argc, object_t *env)
+{
+  return flonum_fold (args, argc, env, '*', "fl*");
 }
 
 object_t *
-builtin_nums_not_equal (object_t *args, object_t *env)
+builtin_fl_divide (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("=/= takes at least two arguments");
+  return flonum_fold (args, argc, env, '/', "fl/");
+}
 
-  deref_symbols (args, env);
-  promotion_t _ = assess_promotion (args, "=");
+/* Each argument is compared with the next and the results are combined;
+   a pair passes when the sign of their difference is one of those
+   allowed.  Any comparison with a NaN fails.  */
+static object_t *
+flonum_order (object_t **args, size_t argc, object_t *env, bool less,
+              bool equal, bool greater, const char *who)
+{
+  if (argc == 0)
+    raise_runtime_error ("%s takes at least one argument", who);
 
-  bool result = false;
-  for (object_t *a = args; a; a = a->next)
+  bool result = true;
+  for (size_t i = 0; i < argc; i++)
     {
-      for (object_t *b = args->next; b; b = b->next)
-        {
-          if (a->type != b->type)
-            return object_new_bool (true, );
-          switch (a->type)
-            {
-            case OBJ_Integer:
-              result = a->v_integer != b->v_integer;
-              continue;
-            case OBJ_Real:
-              result = a->v_real != b->v_real;
-              continue;
-            case OBJ_Complex:
-              result = a->v_complex != b->v_complex;
-              i continue;
-            }
-        }
+      double x = flonum_arg (args[i], who);
+      if (i + 1 == argc)
+        break;
+      double y = flonum_arg (args[i + 1], who);
+      if (!((less && x < y) || (equal && x == y) || (greater && x > y)))
+        result = false;
     }
-
   return result ? object_true : object_false;
 }
 
 object_t *
-builtin_nums_greater (object_t *args, object_t *env)
+builtin_fl_equal (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("> takes at least two arguments");
+  return flonum_order (args, argc, env, false, true, false, "fl=");
+}
 
-  deref_symbols (args, env);
-  promotion_t _ = assess_promotion (args, ">");
+object_t *
+builtin_fl_less (object_t **args, size_t argc, object_t *env)
+{
+  return flonum_order (args, argc, env, true, false, false, "fl<");
+}
 
-  bool result = false;
-  for (object_t *a = args; a; a = a->next)
-    {
-      for (object_t *b = args->next; b; b = b->next)
-        {
-          if (a->type != b->type)
-            return object_false;
-          switch (a->type)
-            {
-            case OBJ_Integer:
-              result = a->v_integer > b->v_integer;
-              continue;
-            case OBJ_Real:
-              result = a->v_real > b->v_real;
-              continue;
-            case OBJ_Complex:
-              result = a->v_complex > b->v_complex;
-              continue;
-            }
-        }
-    }
+object_t *
+builtin_fl_greater (object_t **args, size_t argc, object_t *env)
+{
+  return flonum_order (args, argc, env, false, false, true, "fl>");
+}
 
-  return result ? object_true : object_false;
+object_t *
+builtin_fl_less_equal (object_t **args, size_t argc, object_t *env)
+{
+  return flonum_order (args, argc, env, true, true, false, "fl<=");
 }
 
 object_t *
-builtin_nums_greater_equal (object_t *args, object_t *env)
+builtin_fl_greater_equal (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error (">= takes at least two arguments");
+  return flonum_order (args, argc, env, false, true, true, "fl>=");
+}
 
-  deref_symbols (args, env);
-  promotion_t _ = assess_promotion (args, ">=");
+object_t *
+builtin_exact_to_inexact (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("exact->inexact takes one argument");
 
-  bool result = false;
-  for (object_t *a = args; a; a = a->next)
+  switch (args[0]->type)
     {
-      for (object_t *b = args->next; b; b = b->next)
-        {
-          if (a->type != b->type)
-            return object_false;
-          switch (a->type)
-            {
-            case OBJ_Integer:
-              result = a->v_integer >= b->v_integer;
-              continue;
-            case OBJ_Real:
-              result = a->v_real >= b->v_real;
-              continue;
-            case OBJ_Complex:
-              result = a->v_complex >= b->v_complex;
-              continue;
-            }
-        }
+    case OBJ_Integer:
+    case OBJ_Bignum:
+      return object_new_real (real_arg (args[0]), current_heap);
+    case OBJ_Real:
+    case OBJ_Complex:
+      return args[0];
+    default:
+      raise_runtime_error ("exact->inexact takes a number");
+      return object_nil;
     }
+}
 
-  return result ? object_true : object_false;
+static int
+radix_arg (object_t *arg, const char *who)
+{
+  if (!arg)
+    return 10;
+  if (arg->type != OBJ_Integer || arg->v_integer < 2 || arg->v_integer > 36)
+    raise_runtime_error ("%s takes a radix from 2 to 36", who);
+  return arg->v_integer;
+}
+
+/* Digits of an exact integer in an optional radix.  Bignums past a few
+   dozen limbs are split by powers of the radix before being divided
+   down; see write_digits.  */
+object_t *
+builtin_number_to_string (object_t **args, size_t argc, object_t *env)
+{
+  if (argc == 0)
+    raise_runtime_error ("number->string takes one or two arguments");
+
+  if (!is_exact (args[0]))
+    raise_runtime_error ("number->string takes an exact integer argument");
+  int radix = radix_arg (argc > 1 ? args[1] : NULL, "number->string");
+
+  bignum_t tmp;
+  uint64_t limb;
+  size_t size;
+  uint8_t *bytes
+      = bignum_to_string (exact_arg (args[0], &tmp, &limb), radix, &size);
+  return object_new_string_from (bytes, size, current_heap);
 }
 
+/* The number a string spells as a literal in an optional radix, or #f.  */
 object_t *
-builtin_nums_lesser (object_t *args, object_t *env)
+builtin_string_to_number (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("< takes at least two arguments");
+  if (argc == 0)
+    raise_runtime_error ("string->number takes one or two arguments");
+
+  if (args[0]->type != OBJ_String)
+    raise_runtime_error ("string->number takes a string argument");
+  int radix = radix_arg (argc > 1 ? args[1] : NULL, "string->number");
+
+  string_t *str = args[0]->v_string;
+  object_t *num;
+  if (!reader_parse_number (string_bytes (str), str->size, radix, &num,
+                            current_heap))
+    return object_false;
+  return num;
+}
 
-  deref_symbols (args, env);
-  promotion_t _ = assess_promotion (args, "<");
+#define RELATION_LESS 1
+#define RELATION_EQUAL 2
+#define RELATION_GREATER 4
 
-  bool result = false;
-  for (object_t *a = args; a; a = a->next)
+/* How A relates to B, as one of the RELATION_ bits, or none of them when
+   a NaN is involved.  Unequal complex numbers are both less and greater,
+   so that only inequality holds for them; ORDERED comparisons refuse
+   them.  */
+static int
+compare_numbers (object_t *a, object_t *b, bool ordered, const char *who)
+{
+  if (is_exact (a) && is_exact (b))
     {
-      for (object_t *b = args->next; b; b = b->next)
-        {
-          if (a->type != b->type)
-            return object_false;
-          switch (a->type)
-            {
-            case OBJ_Integer:
-              result = a->v_integer < b->v_integer;
-              continue;
-            case OBJ_Real:
-              result = a->v_real < b->v_real;
-              continue;
-            case OBJ_Complex:
-              result = a->v_complex < b->v_complex;
-              continue;
-            }
-        }
+      int c = exact_compare (a, b);
+      return c < 0 ? RELATION_LESS : c > 0 ? RELATION_GREATER : RELATION_EQUAL;
     }
 
-  return result ? object_true : object_false;
+  if (a->type == OBJ_Complex || b->type == OBJ_Complex)
+    {
+      if (ordered)
+        raise_runtime_error ("%s takes real arguments", who);
+      return complex_arg (a) == complex_arg (b)
+                 ? RELATION_EQUAL
+                 : RELATION_LESS | RELATION_GREATER;
+    }
+
+  double x = real_arg (a);
+  double y = real_arg (b);
+  return x < y    ? RELATION_LESS
+         : x > y  ? RELATION_GREATER
+         : x == y ? RELATION_EQUAL
+                  : 0;
+}
+
+/* Whether every argument stands in RELATION to the next, stopping at the
+   first that does not.  */
+static object_t *
+compare_chain (object_t **args, size_t argc, int relation, bool ordered,
+               const char *who)
+{
+  if (argc < 2)
+    raise_runtime_error ("%s takes at least two arguments", who);
+
+  assess_promotion (args, argc, who);
+  for (size_t i = 0; i + 1 < argc; i++)
+    if (!(compare_numbers (args[i], args[i + 1], ordered, who) & relation))
+      return object_false;
+  return object_true;
 }
 
 object_t *
-builtin_nums_lesser_equal (object_t *args, object_t *env)
+builtin_nums_equal (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("<= takes at least two arguments");
+  return compare_chain (args, argc, RELATION_EQUAL, false, "=");
+}
 
-  deref_symbols (args, env);
-  promotion_t _ = assess_promotion (args, "<=");
+object_t *
+builtin_nums_not_equal (object_t **args, size_t argc, object_t *env)
+{
+  return compare_chain (args, argc, RELATION_LESS | RELATION_GREATER, false,
+                        "=/=");
+}
 
-  bool result = false;
-  for (object_t *a = args; a; a = a->next)
-    {
-      for (object_t *b = args->next; b; b = b->next)
-        {
-          if (a->type != b->type)
-            return object_false;
-          switch (a->type)
-            {
-            case OBJ_Integer:
-              result = a->v_integer <= b->v_integer;
-              continue;
-            case OBJ_Real:
-              result = a->v_real <= b->v_real;
-              continue;
-            case OBJ_Complex:
-              result = a->v_complex <= b->v_complex;
-              continue;
-            }
-        }
-    }
+object_t *
+builtin_nums_greater (object_t **args, size_t argc, object_t *env)
+{
+  return compare_chain (args, argc, RELATION_GREATER, true, ">");
+}
 
-  return result ? object_true : object_false;
+object_t *
+builtin_nums_greater_equal (object_t **args, size_t argc, object_t *env)
+{
+  return compare_chain (args, argc, RELATION_GREATER | RELATION_EQUAL, true,
+                        ">=");
 }
 
 object_t *
-builtin_eq (object_t *args, object_t *env)
+builtin_nums_lesser (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("eq? requires two arguments");
+  return compare_chain (args, argc, RELATION_LESS, true, "<");
+}
 
-  deref_symbols (args, env);
-  bool result = (args == args->next);
-  return result ? object_true : object_false;
+object_t *
+builtin_nums_lesser_equal (object_t **args, size_t argc, object_t *env)
+{
+  return compare_chain (args, argc, RELATION_LESS | RELATION_EQUAL, true,
+                        "<=");
 }
 
 object_t *
-builtin_eqv (object_t *args, object_t *env)
+builtin_not (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtim_error ("eqv? takes two arguments");
+  if (argc != 1)
+    raise_runtime_error ("not takes one argument");
 
-  deref_symbols (args, env);
-  if (args->type == OBJ_Integer || args->type == OBJ_Real
-      || args->type == OBJ_Complex)
-    return builtin_nums_equal (args, env);
-  else if (args->type == OBJ_String || args->type == OBJ_Symbol)
-    return builtin_strings_equal (args, env);
-  else if (args->type == OBJ_Synobj)
-    return builtin_synobjs_equal (args, env);
-  else if (args->type == OBJ_Character)
-    return builtin_characters_equal (args, env);
-  else
-    return builtin_eq (args, env);
+  return args[0]->type == OBJ_Bool && !args[0]->v_bool ? object_true
+                                                       : object_false;
 }
 
 object_t *
-builtin_equal (object_t *args, object_t *env)
+builtin_eq (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("equal? takes two arguments");
+  if (argc < 2)
+    raise_runtime_error ("eq? requires two arguments");
+
+  bool result = (args[0] == args[1]);
+  return result ? object_true : object_false;
+}
 
-  deref_symbols (args, env);
-  if (!(args->type != OBJ_Vector || args->type != OBJ_Bytevector
-        || obj->type != OBJ_Pair))
-    return builtin_eqv (args, env);
+static void
+string_pair_arg (object_t **args, size_t argc, object_t *env, const char *who)
+{
+  if (argc < 2)
+    raise_runtime_error ("%s takes two arguments", who);
 
-  if (args->type == OBJ_Vector)
-    return builtin_vectors_equal (args, env);
-  else if (args->type == OBJ_Bytevector)
-    return builtin_bytevectors_equal (args, env);
-  else if (args->type == OBJ_Pair)
-    return builtin_pairs_equal (args, env);
+  if (args[0]->type != OBJ_String || args[1]->type != OBJ_String)
+    raise_runtime_error ("%s takes two string arguments", who);
+}
 
-  return object_nil;
+/* Compares the bytes, not the hashes.  */
+object_t *
+builtin_strings_equal (object_t **args, size_t argc, object_t *env)
+{
+  string_pair_arg (args, argc, env, "string=?");
+  return string_equal (args[0]->v_string, args[1]->v_string) ? object_true
+                                                             : object_false;
+}
+
+object_t *
+builtin_strings_lesser (object_t **args, size_t argc, object_t *env)
+{
+  string_pair_arg (args, argc, env, "string<?");
+  return string_compare (args[0]->v_string, args[1]->v_string) < 0
+             ? object_true
+             : object_false;
 }
 
 object_t *
-builtin_strings_equal (object_t *args, object_t *env)
+builtin_strings_lesser_equal (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("str=? takes two arguments");
+  string_pair_arg (args, argc, env, "string<=?");
+  return string_compare (args[0]->v_string, args[1]->v_string) <= 0
+             ? object_true
+             : object_false;
+}
 
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_String || args->next->type == OBJ_String))
-    raise_runtime_error ("str=? takes two string arguments");
+object_t *
+builtin_strings_greater (object_t **args, size_t argc, object_t *env)
+{
+  string_pair_arg (args, argc, env, "string>?");
+  return string_compare (args[0]->v_string, args[1]->v_string) > 0
+             ? object_true
+             : object_false;
+}
 
-  return object_new_bools (object_equals (args, args->next), current_heap);
+object_t *
+builtin_strings_greater_equal (object_t **args, size_t argc, object_t *env)
+{
+  string_pair_arg (args, argc, env, "string>=?");
+  return string_compare (args[0]->v_string, args[1]->v_string) >= 0
+             ? object_true
+             : object_false;
 }
 
 object_t *
-builtin_synobjs_equal (object_t *args, object_t *env)
+builtin_synobjs_equal (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("syntax=? takes two arguments");
 
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Synobj || args->next->type == OBJ_Synobj))
+  if (!(args[0]->type == OBJ_Synobj || args[1]->type == OBJ_Synobj))
     raise_runtime_error ("syntax=? takes two syntax arguments");
 
-  for (object_t *d1 = args->v_synobj->datum; d1; d1 = d1->next)
+  for (object_t *d1 = args[0]->v_synobj->datum; d1; d1 = d1->next)
     {
-      for (object_t *d2 = args->next->v_synobj->datum; d2; d2 = d2->next)
+      for (object_t *d2 = args[1]->v_synobj->datum; d2; d2 = d2->next)
         {
           bool result = object_equals (d1, d2);
           if (!result)
@@ -611,363 +814,1068 @@ builtin_synobjs_equal (object_t *args, object_t *env)
 }
 
 object_t *
-builtin_characters_equal (object_t *args, object_t *env)
+builtin_characters_equal (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("char=? takes two arguments");
 
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Character || args->next->type == OBJ_Character))
+  if (args[0]->type != OBJ_Character || args[1]->type != OBJ_Character)
     raise_runtime_error ("char=? takes two character arguments");
 
-  return args->v_character == args->next->v_character ? object_true
+  return args[0]->v_char == args[1]->v_char ? object_true
                                                       : object_false;
 }
 
 object_t *
-builtin_characters_greater (object_t *args, object_t *env)
+builtin_characters_greater (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("char>? takes two arguments");
 
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Character || args->next->type == OBJ_Character))
+  if (args[0]->type != OBJ_Character || args[1]->type != OBJ_Character)
     raise_runtime_error ("char>? takes two character arguments");
 
-  return args->v_character > args->next->v_character ? object_true
+  return args[0]->v_char > args[1]->v_char ? object_true
                                                      : object_false;
 }
 
 object_t *
-builtin_characters_greater_equal (object_t *args, object_t *env)
+builtin_characters_greater_equal (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("char>=? takes two arguments");
 
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Character || args->next->type == OBJ_Character))
+  if (args[0]->type != OBJ_Character || args[1]->type != OBJ_Character)
     raise_runtime_error ("char>=? takes two character arguments");
 
-  return args->v_character >= args->next->v_character ? object_true
+  return args[0]->v_char >= args[1]->v_char ? object_true
                                                       : object_false;
 }
 
 object_t *
-builtin_characters_lesser (object_t *args, object_t *env)
+builtin_characters_lesser (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("char<? takes two arguments");
 
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Character || args->next->type == OBJ_Character))
+  if (args[0]->type != OBJ_Character || args[1]->type != OBJ_Character)
     raise_runtime_error ("char<? takes two character arguments");
 
-  return args->v_character < args->next->v_character ? object_true
+  return args[0]->v_char < args[1]->v_char ? object_true
                                                      : object_false;
 }
 
 object_t *
-builtin_characters_lesser_equal (object_t *args, object_t *env)
+builtin_characters_lesser_equal (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("char<=? takes two arguments");
 
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Character || args->next->type == OBJ_Character))
+  if (args[0]->type != OBJ_Character || args[1]->type != OBJ_Character)
     raise_runtime_error ("char<=? takes two character arguments");
 
-  return args->v_character <= args->next->v_character ? object_true
+  return args[0]->v_char <= args[1]->v_char ? object_true
                                                       : object_false;
 }
 
-object_t *
-builtin_vectors_equal (object_t *args, object_t *env)
+/* The character argument of a one-argument char procedure.  */
+static char32_t
+char_arg (object_t **args, size_t argc, object_t *env, const char *who)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("vector=? takes two arguments");
-
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Vector || args->next->type == OBJ_Vector))
-    raise_runtime_error ("vector=? takes two vector arguments");
+  if (argc == 0)
+    raise_runtime_error ("%s takes one argument", who);
 
-  for (size_t i = 0; i < args->v_vector->count; i++)
-    {
-      for (size_t j = 0; j < args->next->v_vector->count; j++)
-        {
-          bool result = object_equals (args->v_vector->vals[i], current_heap);
-                                       args->next->v_vector->vals[i]);
-                                       if (!result)
-                                         return object_false;
-        }
-    }
-  return object_true;
+  if (args[0]->type != OBJ_Character)
+    raise_runtime_error ("%s takes a character argument", who);
+  return args[0]->v_char;
 }
 
 object_t *
-builtin_bytevectors_equal (object_t *args, object_t *env)
+builtin_char_upcase (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("bytevector=? takes two arguments");
-
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Bytevector || args->next->type == OBJ_Bytevector))
-    raise_runtime_error ("bytevector=? takes two bytevector arguments");
-
-  for (size_t i = 0; i < args->v_bytevector->count; i++)
-    {
-      for (size_t j = 0; j < args->next->v_bytevector->count; j++)
-        {
-          bool result = args->v_bytevector->vals[i]
-                        == args->next->v_bytevector->vals[j];
-          if (!result)
-            return object_false;
-        }
-    }
-  return object_true;
+  char32_t ch = char_arg (args, argc, env, "char-upcase");
+  return object_new_character (unicode_upcase (ch), current_heap);
 }
 
 object_t *
-builtin_string_ref (object_t *args, object_t *env)
+builtin_char_downcase (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("string-ref takes two arguments");
-
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_String || args->next->type == OBJ_Integer))
-    raise_runtime_error ("string-ref takes a string, and an integer argument");
-
-  const char32_t *buffz = args->v_buffz;
-  intmax_t idx = args->next->v_integer;
-
-  return object_new_character (buffz[idx], current_heap);
+  char32_t ch = char_arg (args, argc, env, "char-downcase");
+  return object_new_character (unicode_downcase (ch), current_heap);
 }
 
 object_t *
-builtin_string_length (object_t *args, object_t *env)
+builtin_char_foldcase (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
-    raise_runtime_error ("string-length takes one argument");
+  char32_t ch = char_arg (args, argc, env, "char-foldcase");
+  return object_new_character (unicode_foldcase (ch), current_heap);
+}
 
-  deref_symbols (args, env);
-  if (args->type != OBJ_String)
-    raise_runtime_error ("string-length takes a string argument");
+object_t *
+builtin_char_alphabetic (object_t **args, size_t argc, object_t *env)
+{
+  char32_t ch = char_arg (args, argc, env, "char-alphabetic?");
+  return unicode_alphabetic (ch) ? object_true : object_false;
+}
 
-  const char32_t *buffz = args->v_buffz;
-  intmax_t length = u32strlen (buffz);
+object_t *
+builtin_char_numeric (object_t **args, size_t argc, object_t *env)
+{
+  char32_t ch = char_arg (args, argc, env, "char-numeric?");
+  return unicode_numeric (ch) ? object_true : object_false;
+}
 
-  return object_new_integer (length, current_heap);
+object_t *
+builtin_char_whitespace (object_t **args, size_t argc, object_t *env)
+{
+  char32_t ch = char_arg (args, argc, env, "char-whitespace?");
+  return unicode_whitespace (ch) ? object_true : object_false;
 }
 
 object_t *
-builtin_string_append (object_t *args, object_t *env)
+builtin_char_upper_case (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
-    return object_nil;
+  char32_t ch = char_arg (args, argc, env, "char-upper-case?");
+  return unicode_upper_case (ch) ? object_true : object_false;
+}
 
-  if (!args->next)
-    return args;
+object_t *
+builtin_char_lower_case (object_t **args, size_t argc, object_t *env)
+{
+  char32_t ch = char_arg (args, argc, env, "char-lower-case?");
+  return unicode_lower_case (ch) ? object_true : object_false;
+}
 
-  deref_symbols (args, env);
+/* The value of a decimal digit in any script, or #f.  */
+object_t *
+builtin_digit_value (object_t **args, size_t argc, object_t *env)
+{
+  int value = unicode_digit_value (char_arg (args, argc, env, "digit-value"));
+  if (value < 0)
+    return object_false;
+  return object_new_integer (value, current_heap);
+}
 
-  if (args->type != OBJ_String)
-    raise_runtime_error ("string-append takes a string argument");
+object_t *
+builtin_eqv (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2)
+    raise_runtime_error ("eqv? takes two arguments");
+
+  object_t *a = args[0];
+  object_t *b = args[1];
+  if (a == b)
+    return object_true;
+  if (a->type != b->type)
+    return object_false;
+
+  /* Symbols are interned, so only numbers, characters and booleans can be
+     eqv? without being the same object.  */
+  bool result;
+  switch (a->type)
+    {
+    case OBJ_Integer:
+      result = a->v_integer == b->v_integer;
+      break;
+    case OBJ_Bignum:
+      result = !bignum_compare (a->v_bignum, b->v_bignum);
+      break;
+    case OBJ_Real:
+      result = a->v_real == b->v_real;
+      break;
+    case OBJ_Complex:
+      result = a->v_complex == b->v_complex;
+      break;
+    case OBJ_Character:
+      result = a->v_char == b->v_char;
+      break;
+    case OBJ_Bool:
+      result = a->v_bool == b->v_bool;
+      break;
+    case OBJ_Nil:
+      result = true;
+      break;
+    default:
+      result = false;
+      break;
+    }
+  return result ? object_true : object_false;
+}
 
-  char32_t *buffz = u32strndup (args->v_string, -1);
-  for (object_t *a = args->next; a; a = a->next)
+/* Whether A and B are equal?: pairs and vectors are compared element by
+   element, down the spine of a list without recursing, strings and
+   bytevectors by content, and anything else as by eqv?.  */
+static bool
+objects_equal (object_t *a, object_t *b)
+{
+  for (;;)
     {
-      if (a->type != OBJ_String)
-        raise_runtime_error ("string-append takes string arguments");
+      if (a == b)
+        return true;
+      if (a->type != b->type)
+        return false;
 
-      const char32_t *a_buffz = u32strndup (a->v_string, -1);
-      buffz = u32strncat (buffz, a_buffz, -1);
+      switch (a->type)
+        {
+        case OBJ_Pair:
+          if (!objects_equal (a->v_pair->first, b->v_pair->first))
+            return false;
+          a = a->v_pair->rest;
+          b = b->v_pair->rest;
+          continue;
+        case OBJ_Vector:
+          if (a->v_vector->count != b->v_vector->count)
+            return false;
+          for (size_t i = 0; i < a->v_vector->count; i++)
+            if (!objects_equal (a->v_vector->vals[i], b->v_vector->vals[i]))
+              return false;
+          return true;
+        case OBJ_Bytevector:
+          return a->v_bytevector->count == b->v_bytevector->count
+                 && !memcmp (a->v_bytevector->vals, b->v_bytevector->vals,
+                             a->v_bytevector->count);
+        case OBJ_String:
+          return string_equal (a->v_string, b->v_string);
+        default:
+          {
+            object_t *pair[] = { a, b };
+            return builtin_eqv (pair, 2, NULL) == object_true;
+          }
+        }
     }
-
-  return object_new_string ((const char32_t *)buffz, current_heap);
 }
 
 object_t *
-builtin_substring (object_t *args, object_t *env)
+builtin_equal (object_t **args, size_t argc, object_t *env)
 {
-  if (!args | !args->next || !args->next->next)
-    raise_runtime_error ("substring takes three arguments");
-
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_String || args->next->type == OBJ_Integer
-        || args->next->next->type == OBJ_Integer))
-    raise_runtime_error ("substring takes a string, an two integer arguments");
-
-  const char32_t *buffz = args->v_string;
-  intmax_t start = args->next->v_integer;
-  intmax_t end = args->next->next->v_integer;
+  if (argc < 2)
+    raise_runtime_error ("equal? takes two arguments");
 
-  return object_new_string (u32substring (buffz, start, end), current_heap);
+  return objects_equal (args[0], args[1]) ? object_true : object_false;
 }
 
 object_t *
-builtin_list_ref (object_t *args, object_t *env)
+builtin_vectors_equal (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
-    raise_runtime_error ("list-ref takes two arguments");
+  if (argc < 2)
+    raise_runtime_error ("vector=? takes two arguments");
 
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Pair || args->next->type == OBJ_Integer))
+  if (args[0]->type != OBJ_Vector || args[1]->type != OBJ_Vector)
+    raise_runtime_error ("vector=? takes two vector arguments");
+
+  return objects_equal (args[0], args[1]) ? object_true : object_false;
+}
+
+object_t *
+builtin_bytevectors_equal (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2)
+    raise_runtime_error ("bytevector=? takes two arguments");
+
+  if (args[0]->type != OBJ_Bytevector || args[1]->type != OBJ_Bytevector)
+    raise_runtime_error ("bytevector=? takes two bytevector arguments");
+
+  return objects_equal (args[0], args[1]) ? object_true : object_false;
+}
+
+object_t *
+builtin_string_ref (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2)
+    raise_runtime_error ("string-ref takes two arguments");
+
+  if (args[0]->type != OBJ_String || args[1]->type != OBJ_Integer)
+    raise_runtime_error ("string-ref takes a string, and an integer argument");
+
+  string_t *str = args[0]->v_string;
+  intmax_t idx = args[1]->v_integer;
+  if (idx < 0 || (size_t)idx >= str->length)
+    raise_runtime_error ("string-ref index out of range");
+
+  return object_new_character (string_ref (str, idx), current_heap);
+}
+
+object_t *
+builtin_string_length (object_t **args, size_t argc, object_t *env)
+{
+  if (argc == 0)
+    raise_runtime_error ("string-length takes one argument");
+
+  if (args[0]->type != OBJ_String)
+    raise_runtime_error ("string-length takes a string argument");
+
+  return object_new_integer (args[0]->v_string->length, current_heap);
+}
+
+/* Builds a balanced tree over the arguments rather than copying them;
+   see string_concat.  */
+object_t *
+builtin_string_append (object_t **args, size_t argc, object_t *env)
+{
+  if (argc == 0)
+    return object_nil;
+
+  if (argc == 1)
+    return args[0];
+
+  for (size_t i = 0; i < argc; i++)
+    if (args[i]->type != OBJ_String)
+      raise_runtime_error ("string-append takes string arguments");
+
+  object_t *result = args[0];
+  for (size_t i = 1; i < argc; i++)
+    result = string_concat (result, args[i], current_heap);
+  return result;
+}
+
+object_t *
+builtin_substring (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 3)
+    raise_runtime_error ("substring takes three arguments");
+
+  if (args[0]->type != OBJ_String || args[1]->type != OBJ_Integer
+      || args[2]->type != OBJ_Integer)
+    raise_runtime_error ("substring takes a string, an two integer arguments");
+
+  string_t *str = args[0]->v_string;
+  intmax_t start = args[1]->v_integer;
+  intmax_t end = args[2]->v_integer;
+  if (start < 0 || end < start || (size_t)end > str->length)
+    raise_runtime_error ("substring bounds out of range");
+
+  return string_slice (args[0], start, end, current_heap);
+}
+
+/* Index of the first occurrence of a character in a string, or #f.  */
+object_t *
+builtin_string_index (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2)
+    raise_runtime_error ("string-index takes two arguments");
+
+  if (args[0]->type != OBJ_String || args[1]->type != OBJ_Character)
+    raise_runtime_error ("string-index takes a string, and a character "
+                         "argument");
+
+  uint8_t ch[4];
+  size_t m = utf8_encode (args[1]->v_char, ch);
+  string_t *str = args[0]->v_string;
+  size_t pos = string_find (str, ch, m, 0);
+  if (pos == SEARCH_NONE)
+    return object_false;
+  return object_new_integer (string_index (str, pos), current_heap);
+}
+
+/* Index of the first occurrence of the second string in the first, or
+   #f.  */
+object_t *
+builtin_string_contains (object_t **args, size_t argc, object_t *env)
+{
+  string_pair_arg (args, argc, env, "string-contains");
+
+  string_t *str = args[0]->v_string, *pat = args[1]->v_string;
+  size_t pos = string_find (str, string_bytes (pat), pat->size, 0);
+  if (pos == SEARCH_NONE)
+    return object_false;
+  return object_new_integer (string_index (str, pos), current_heap);
+}
+
+/* Indices of the non-overlapping occurrences of the second string in the
+   first, in order.  An empty pattern matches before every character and
+   at the end.  */
+object_t *
+builtin_string_search_all (object_t **args, size_t argc, object_t *env)
+{
+  string_pair_arg (args, argc, env, "string-search-all");
+
+  string_t *str = args[0]->v_string, *pat = args[1]->v_string;
+  const uint8_t *bytes = string_bytes (str);
+  const uint8_t *needle = string_bytes (pat);
+  object_t *result = object_nil, *tail = NULL;
+  size_t from = 0, last = 0, index = 0;
+  for (;;)
+    {
+      size_t pos = string_find (str, needle, pat->size, from);
+      if (pos == SEARCH_NONE)
+        break;
+      index += str->ascii ? pos - last
+                          : search_count_chars (bytes + last, pos - last);
+      last = pos;
+
+      object_t *cell = object_new_pair (
+          object_new_integer (index, current_heap), object_nil, current_heap);
+      if (tail)
+        tail->v_pair->rest = cell;
+      else
+        result = cell;
+      tail = cell;
+
+      if (pos == str->size)
+        break;
+      from = pat->size ? pos + pat->size
+                       : pos + utf8_sequence_length (bytes[pos]);
+    }
+  return result;
+}
+
+static object_t *
+string_convert (object_t **args, size_t argc, object_t *env,
+                enum UnicodeCase mode, const char *who)
+{
+  if (argc == 0)
+    raise_runtime_error ("%s takes one argument", who);
+
+  if (args[0]->type != OBJ_String)
+    raise_runtime_error ("%s takes a string argument", who);
+
+  string_t *str = args[0]->v_string;
+  size_t size;
+  uint8_t *bytes = unicode_convert (string_bytes (str), str->size, mode, &size);
+  return object_new_string_from (bytes, size, current_heap);
+}
+
+/* The full mappings, so a string may change length: "straße" upcases to
+   "STRASSE".  */
+object_t *
+builtin_string_upcase (object_t **args, size_t argc, object_t *env)
+{
+  return string_convert (args, argc, env, UNICODE_Upcase, "string-upcase");
+}
+
+object_t *
+builtin_string_downcase (object_t **args, size_t argc, object_t *env)
+{
+  return string_convert (args, argc, env, UNICODE_Downcase, "string-downcase");
+}
+
+object_t *
+builtin_string_foldcase (object_t **args, size_t argc, object_t *env)
+{
+  return string_convert (args, argc, env, UNICODE_Foldcase, "string-foldcase");
+}
+
+/* A compiled regexp, or a pattern string compiled on the spot.  */
+static regexp_t *
+regexp_arg (object_t *arg, const char *who)
+{
+  if (arg->type == OBJ_Regexp)
+    return arg->v_regexp;
+  if (arg->type != OBJ_String)
+    raise_runtime_error ("%s takes a regexp or a pattern string", who);
+
+  const char *error;
+  regexp_t *re = regexp_compile (string_bytes (arg->v_string),
+                                 arg->v_string->size, &error);
+  if (!re)
+    raise_runtime_error ("%s: %s", who, error);
+  object_new_regexp (re, current_heap);
+  return re;
+}
+
+object_t *
+builtin_regexp_compile (object_t **args, size_t argc, object_t *env)
+{
+  if (argc == 0)
+    raise_runtime_error ("regexp-compile takes one argument");
+
+  if (args[0]->type != OBJ_String)
+    raise_runtime_error ("regexp-compile takes a string argument");
+
+  const char *error;
+  regexp_t *re = regexp_compile (string_bytes (args[0]->v_string),
+                                 args[0]->v_string->size, &error);
+  if (!re)
+    raise_runtime_error ("regexp-compile: %s", error);
+  return object_new_regexp (re, current_heap);
+}
+
+/* Whether the whole string matches.  */
+object_t *
+builtin_regexp_match (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2)
+    raise_runtime_error ("regexp-match takes two arguments");
+
+  regexp_t *re = regexp_arg (args[0], "regexp-match");
+  if (args[1]->type != OBJ_String)
+    raise_runtime_error ("regexp-match takes a string argument");
+
+  string_t *str = args[1]->v_string;
+  return regexp_match (re, string_bytes (str), str->size) ? object_true
+                                                          : object_false;
+}
+
+/* The bounds of the leftmost match at or after an optional start index,
+   as a pair of character indices, or #f.  */
+object_t *
+builtin_regexp_search (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2)
+    raise_runtime_error ("regexp-search takes two or three arguments");
+
+  regexp_t *re = regexp_arg (args[0], "regexp-search");
+  if (args[1]->type != OBJ_String)
+    raise_runtime_error ("regexp-search takes a string argument");
+
+  string_t *str = args[1]->v_string;
+  size_t from = 0;
+  object_t *start_arg = argc > 2 ? args[2] : NULL;
+  if (start_arg)
+    {
+      if (start_arg->type != OBJ_Integer || start_arg->v_integer < 0
+          || (size_t)start_arg->v_integer > str->length)
+        raise_runtime_error ("regexp-search start index out of range");
+      from = string_offset (str, start_arg->v_integer);
+    }
+
+  size_t start, end;
+  if (!regexp_search (re, string_bytes (str), str->size, from, &start, &end))
+    return object_false;
+  return object_new_pair (
+      object_new_integer (string_index (str, start), current_heap),
+      object_new_integer (string_index (str, end), current_heap),
+      current_heap);
+}
+
+/* Replace every non-overlapping match with a literal replacement
+   string.  After an empty match the search moves on by one character
+   so that it cannot match there again.  */
+object_t *
+builtin_regexp_replace (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 3)
+    raise_runtime_error ("regexp-replace takes three arguments");
+
+  regexp_t *re = regexp_arg (args[0], "regexp-replace");
+  if (args[1]->type != OBJ_String || args[2]->type != OBJ_String)
+    raise_runtime_error ("regexp-replace takes two string arguments");
+
+  string_t *str = args[1]->v_string, *rep = args[2]->v_string;
+  const uint8_t *bytes = string_bytes (str);
+  const uint8_t *with = string_bytes (rep);
+  size_t n = str->size;
+
+  size_t size = 0, cap = n + 1;
+  uint8_t *out = malloc (cap);
+  size_t from = 0, copied = 0, start, end;
+  while (from <= n && regexp_search (re, bytes, n, from, &start, &end))
+    {
+      size_t need = size + (start - copied) + rep->size + (n - end) + 1;
+      if (need > cap)
+        {
+          cap = need > 2 * cap ? need : 2 * cap;
+          out = realloc (out, cap);
+        }
+      memcpy (out + size, bytes + copied, start - copied);
+      size += start - copied;
+      memcpy (out + size, with, rep->size);
+      size += rep->size;
+      copied = end;
+
+      if (end > start)
+        from = end;
+      else if (end < n)
+        from = end + utf8_sequence_length (bytes[end]);
+      else
+        break;
+    }
+  memcpy (out + size, bytes + copied, n - copied);
+  size += n - copied;
+  return object_new_string_from (out, size, current_heap);
+}
+
+object_t *
+builtin_list_ref (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2)
+    raise_runtime_error ("list-ref takes two arguments");
+
+  if (args[0]->type != OBJ_Pair || args[1]->type != OBJ_Integer)
     raise_runtime_error ("list-ref takes a list, and an integer as argument");
 
-  intmax_t idx = args->next->v_integer;
-  object_t *current = args;
+  intmax_t idx = args[1]->v_integer;
+  object_t *current = args[0];
 
-  while (idx && current->type == OBJ_Pair && current->rest->type != OBJ_Nil)
+  while (idx > 0 && current->type == OBJ_Pair)
     {
       idx--;
-      current = current->rest;
+      current = current->v_pair->rest;
     }
 
-  if (current && current->type == OBJ_Pair)
-    return current->first;
-
-  return object_nil;
+  if (idx < 0 || current->type != OBJ_Pair)
+    raise_runtime_error ("list-ref index out of range");
+  return current->v_pair->first;
 }
 
 object_t *
-builtin_vector_ref (object_t *args, object_t *env)
+builtin_vector_ref (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("vector-ref takes two arguments");
 
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Vector || args->next->type == OBJ_Integer))
+  if (!(args[0]->type == OBJ_Vector || args[1]->type == OBJ_Integer))
     raise_runtime_error ("vector-ref takes a vector, and an integer argument");
 
-  vector_t *vec = args->v_vector;
-  intmax_t idx = args->next->v_integer;
+  vector_t *vec = args[0]->v_vector;
+  intmax_t idx = args[1]->v_integer;
 
   return vec->vals[idx];
 }
 
 object_t *
-builtin_bytevector_ref (object_t *args, object_t *env)
+builtin_bytevector_ref (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("bytevector-ref takes two arguments");
 
-  deref_symbols (args, env);
-  if (!(args->type == OBJ_Bytevector || args->next->type == OBJ_Integer))
+  if (!(args[0]->type == OBJ_Bytevector || args[1]->type == OBJ_Integer))
     raise_runtime_error (
         "bytevector-ref takes a bytevector, and an integer argument");
 
-  bytevector_t *bvec = args->v_bytevector;
-  intmax_t idx = args->next->v_integer;
+  bytevector_t *bvec = args[0]->v_bytevector;
+  intmax_t idx = args[1]->v_integer;
+
+  return object_new_integer (bvec->vals[idx], current_heap);
+}
+
+/* SRFI 4 vectors.  A u8vector is a bytevector; the other types are
+   numvectors holding their elements unboxed.  */
+static object_t *
+numvector_new (enum NumvecType type, size_t n)
+{
+  if (type == NUMVEC_U8)
+    {
+      object_t *bv = object_new_bytevector (n, current_heap);
+      bv->v_bytevector->count = n;
+      return bv;
+    }
+  return object_new_numvector (numvec_new (type, n), current_heap);
+}
+
+static bool
+is_numvector (object_t *v, enum NumvecType type)
+{
+  if (type == NUMVEC_U8)
+    return v->type == OBJ_Bytevector;
+  return v->type == OBJ_Numvector && v->v_numvector->type == type;
+}
+
+static void
+numvector_arg (object_t *v, enum NumvecType type, const char *who)
+{
+  if (!is_numvector (v, type))
+    raise_runtime_error ("%s takes a vector of its type", who);
+}
+
+static size_t
+numvector_count (object_t *v)
+{
+  return v->type == OBJ_Bytevector ? v->v_bytevector->count
+                                   : v->v_numvector->count;
+}
+
+static size_t
+numvector_index (object_t *v, object_t *i, const char *who)
+{
+  if (i->type != OBJ_Integer || i->v_integer < 0
+      || (uintmax_t)i->v_integer >= numvector_count (v))
+    raise_runtime_error ("%s index out of range", who);
+  return i->v_integer;
+}
+
+static object_t *
+numvector_get (object_t *v, size_t i)
+{
+  if (v->type == OBJ_Bytevector)
+    return object_new_integer (v->v_bytevector->vals[i], current_heap);
+
+  void *vals = v->v_numvector->vals;
+  switch (v->v_numvector->type)
+    {
+    case NUMVEC_S8:
+      return object_new_integer (((int8_t *)vals)[i], current_heap);
+    case NUMVEC_U16:
+      return object_new_integer (((uint16_t *)vals)[i], current_heap);
+    case NUMVEC_S16:
+      return object_new_integer (((int16_t *)vals)[i], current_heap);
+    case NUMVEC_U32:
+      return object_new_integer (((uint32_t *)vals)[i], current_heap);
+    case NUMVEC_S32:
+      return object_new_integer (((int32_t *)vals)[i], current_heap);
+    case NUMVEC_U64:
+      {
+        uint64_t limb = ((uint64_t *)vals)[i];
+        if (limb <= INTMAX_MAX)
+          return object_new_integer (limb, current_heap);
+        bignum_t tmp = { .negative = false, .size = 1, .limbs = &limb };
+        return object_new_bignum (bignum_copy (&tmp), current_heap);
+      }
+    case NUMVEC_S64:
+      return object_new_integer (((int64_t *)vals)[i], current_heap);
+    case NUMVEC_F32:
+      return object_new_real (((float *)vals)[i], current_heap);
+    default:
+      return object_new_real (((double *)vals)[i], current_heap);
+    }
+}
+
+static bool
+in_range (object_t *x, intmax_t lo, intmax_t hi)
+{
+  return x->type == OBJ_Integer && x->v_integer >= lo && x->v_integer <= hi;
+}
+
+/* Store X as element I of V, which must hold it exactly; the float types
+   take any real number.  */
+static void
+numvector_put (object_t *v, size_t i, object_t *x, const char *who)
+{
+  enum NumvecType type
+      = v->type == OBJ_Bytevector ? NUMVEC_U8 : v->v_numvector->type;
+  void *vals = v->type == OBJ_Bytevector ? v->v_bytevector->vals
+                                         : v->v_numvector->vals;
+  bool ok;
+  switch (type)
+    {
+    case NUMVEC_U8:
+      if ((ok = in_range (x, 0, UINT8_MAX)))
+        ((uint8_t *)vals)[i] = x->v_integer;
+      break;
+    case NUMVEC_S8:
+      if ((ok = in_range (x, INT8_MIN, INT8_MAX)))
+        ((int8_t *)vals)[i] = x->v_integer;
+      break;
+    case NUMVEC_U16:
+      if ((ok = in_range (x, 0, UINT16_MAX)))
+        ((uint16_t *)vals)[i] = x->v_integer;
+      break;
+    case NUMVEC_S16:
+      if ((ok = in_range (x, INT16_MIN, INT16_MAX)))
+        ((int16_t *)vals)[i] = x->v_integer;
+      break;
+    case NUMVEC_U32:
+      if ((ok = in_range (x, 0, UINT32_MAX)))
+        ((uint32_t *)vals)[i] = x->v_integer;
+      break;
+    case NUMVEC_S32:
+      if ((ok = in_range (x, INT32_MIN, INT32_MAX)))
+        ((int32_t *)vals)[i] = x->v_integer;
+      break;
+    case NUMVEC_U64:
+      if ((ok = in_range (x, 0, INTMAX_MAX)))
+        ((uint64_t *)vals)[i] = x->v_integer;
+      else if ((ok = x->type == OBJ_Bignum && !x->v_bignum->negative
+                     && x->v_bignum->size == 1))
+        ((uint64_t *)vals)[i] = x->v_bignum->limbs[0];
+      break;
+    case NUMVEC_S64:
+      if ((ok = x->type == OBJ_Integer))
+        ((int64_t *)vals)[i] = x->v_integer;
+      break;
+    case NUMVEC_F32:
+      if ((ok = is_exact (x) || x->type == OBJ_Real))
+        ((float *)vals)[i] = real_arg (x);
+      break;
+    default:
+      if ((ok = is_exact (x) || x->type == OBJ_Real))
+        ((double *)vals)[i] = real_arg (x);
+      break;
+    }
+  if (!ok)
+    raise_runtime_error ("%s value does not fit the vector's type", who);
+}
+
+static object_t *
+numvector_make (object_t **args, size_t argc, object_t *env,
+                enum NumvecType type, const char *who)
+{
+  if (argc == 0)
+    raise_runtime_error ("%s takes one or two arguments", who);
+
+  if (args[0]->type != OBJ_Integer || args[0]->v_integer < 0)
+    raise_runtime_error ("%s takes a length", who);
+
+  object_t *v = numvector_new (type, args[0]->v_integer);
+  if (argc > 1)
+    for (size_t i = 0; i < (size_t)args[0]->v_integer; i++)
+      numvector_put (v, i, args[1], who);
+  return v;
+}
+
+static object_t *
+numvector_of (object_t **args, size_t argc, object_t *env,
+              enum NumvecType type, const char *who)
+{
+  object_t *v = numvector_new (type, argc);
+  for (size_t i = 0; i < argc; i++)
+    numvector_put (v, i, args[i], who);
+  return v;
+}
+
+static object_t *
+numvector_p (object_t **args, size_t argc, object_t *env,
+             enum NumvecType type, const char *who)
+{
+  if (argc != 1)
+    raise_runtime_error ("%s takes one argument", who);
+
+  return is_numvector (args[0], type) ? object_true : object_false;
+}
+
+static object_t *
+numvector_length (object_t **args, size_t argc, object_t *env,
+                  enum NumvecType type, const char *who)
+{
+  if (argc != 1)
+    raise_runtime_error ("%s takes one argument", who);
 
-  return object_new_byte (bvec->vals[idx], current_heap);
+  numvector_arg (args[0], type, who);
+  return object_new_integer (numvector_count (args[0]), current_heap);
 }
 
+static object_t *
+numvector_ref (object_t **args, size_t argc, object_t *env,
+               enum NumvecType type, const char *who)
+{
+  if (argc < 2)
+    raise_runtime_error ("%s takes two arguments", who);
+
+  numvector_arg (args[0], type, who);
+  return numvector_get (args[0], numvector_index (args[0], args[1], who));
+}
+
+static object_t *
+numvector_set (object_t **args, size_t argc, object_t *env,
+               enum NumvecType type, const char *who)
+{
+  if (argc < 3)
+    raise_runtime_error ("%s takes three arguments", who);
+
+  numvector_arg (args[0], type, who);
+  numvector_put (args[0], numvector_index (args[0], args[1], who),
+                 args[2], who);
+  return object_nil;
+}
+
+static object_t *
+numvector_to_list (object_t **args, size_t argc, object_t *env,
+                   enum NumvecType type, const char *who)
+{
+  if (argc != 1)
+    raise_runtime_error ("%s takes one argument", who);
+
+  numvector_arg (args[0], type, who);
+  object_t *result = object_nil;
+  for (size_t i = numvector_count (args[0]); i > 0; i--)
+    result = object_new_pair (numvector_get (args[0], i - 1), result,
+                              current_heap);
+  return result;
+}
+
+static object_t *
+list_to_numvector (object_t **args, size_t argc, object_t *env,
+                   enum NumvecType type, const char *who)
+{
+  if (argc != 1)
+    raise_runtime_error ("%s takes one argument", who);
+
+  size_t n = 0;
+  object_t *lst = args[0];
+  for (; lst->type == OBJ_Pair; lst = cdr (lst))
+    n++;
+  if (lst->type != OBJ_Nil)
+    raise_runtime_error ("%s takes a list", who);
+
+  object_t *v = numvector_new (type, n);
+  size_t i = 0;
+  for (lst = args[0]; lst->type == OBJ_Pair; lst = cdr (lst))
+    numvector_put (v, i++, car (lst), who);
+  return v;
+}
+
+#define NUMVECTOR_BUILTIN(name, helper, TYPE, who)                            \
+  object_t *name (object_t **args, size_t argc, object_t *env)              \
+  {                                                                           \
+    return helper (args, argc, env, TYPE, who);                               \
+  }
+
+/* The eight SRFI 4 procedures for element type TAG.  */
+#define NUMVECTOR_BUILTINS(tag, TYPE)                                         \
+  NUMVECTOR_BUILTIN (builtin_make_##tag##vector, numvector_make, TYPE,        \
+                     "make-" #tag "vector")                                   \
+  NUMVECTOR_BUILTIN (builtin_##tag##vector, numvector_of, TYPE,               \
+                     #tag "vector")                                           \
+  NUMVECTOR_BUILTIN (builtin_##tag##vector_p, numvector_p, TYPE,              \
+                     #tag "vector?")                                          \
+  NUMVECTOR_BUILTIN (builtin_##tag##vector_length, numvector_length, TYPE,    \
+                     #tag "vector-length")                                    \
+  NUMVECTOR_BUILTIN (builtin_##tag##vector_ref, numvector_ref, TYPE,          \
+                     #tag "vector-ref")                                       \
+  NUMVECTOR_BUILTIN (builtin_##tag##vector_set, numvector_set, TYPE,          \
+                     #tag "vector-set!")                                      \
+  NUMVECTOR_BUILTIN (builtin_##tag##vector_to_list, numvector_to_list, TYPE,  \
+                     #tag "vector->list")                                     \
+  NUMVECTOR_BUILTIN (builtin_list_to_##tag##vector, list_to_numvector, TYPE,  \
+                     "list->" #tag "vector")
+
+NUMVECTOR_BUILTINS (u8, NUMVEC_U8)
+NUMVECTOR_BUILTINS (s8, NUMVEC_S8)
+NUMVECTOR_BUILTINS (u16, NUMVEC_U16)
+NUMVECTOR_BUILTINS (s16, NUMVEC_S16)
+NUMVECTOR_BUILTINS (u32, NUMVEC_U32)
+NUMVECTOR_BUILTINS (s32, NUMVEC_S32)
+NUMVECTOR_BUILTINS (u64, NUMVEC_U64)
+NUMVECTOR_BUILTINS (s64, NUMVEC_S64)
+NUMVECTOR_BUILTINS (f32, NUMVEC_F32)
+NUMVECTOR_BUILTINS (f64, NUMVEC_F64)
+
+static double *
+f64_arg (object_t *v, const char *who)
+{
+  numvector_arg (v, NUMVEC_F64, who);
+  return v->v_numvector->vals;
+}
+
+/* Bulk f64 operations run in numvec's vector kernels.  `f64vector-map!'
+   calls back into Scheme and is compiled as a primitive instead.  */
 object_t *
-builtin_cons (object_t *args, object_t *env)
+builtin_f64vector_add (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
+    raise_runtime_error ("f64vector-add! takes two arguments");
+
+  double *dst = f64_arg (args[0], "f64vector-add!");
+  double *src = f64_arg (args[1], "f64vector-add!");
+  size_t n = args[0]->v_numvector->count;
+  if (args[1]->v_numvector->count != n)
+    raise_runtime_error ("f64vector-add! takes vectors of equal length");
+
+  numvec_f64_add (dst, src, n);
+  return args[0];
+}
+
+object_t *
+builtin_f64vector_scale (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2)
+    raise_runtime_error ("f64vector-scale! takes two arguments");
+
+  double *dst = f64_arg (args[0], "f64vector-scale!");
+  if (!is_exact (args[1]) && args[1]->type != OBJ_Real)
+    raise_runtime_error ("f64vector-scale! takes a real factor");
+
+  numvec_f64_scale (dst, real_arg (args[1]), args[0]->v_numvector->count);
+  return args[0];
+}
+
+object_t *
+builtin_f64vector_dot (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2)
+    raise_runtime_error ("f64vector-dot takes two arguments");
+
+  double *a = f64_arg (args[0], "f64vector-dot");
+  double *b = f64_arg (args[1], "f64vector-dot");
+  size_t n = args[0]->v_numvector->count;
+  if (args[1]->v_numvector->count != n)
+    raise_runtime_error ("f64vector-dot takes vectors of equal length");
+
+  return object_new_real (numvec_f64_dot (a, b, n), current_heap);
+}
+
+object_t *
+builtin_f64vector_sum (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("f64vector-sum takes one argument");
+
+  double *a = f64_arg (args[0], "f64vector-sum");
+  return object_new_real (numvec_f64_sum (a, args[0]->v_numvector->count),
+                          current_heap);
+}
+
+object_t *
+builtin_cons (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2)
     raise_runtime_error ("cons takes two arguments");
 
-  deref_symbols (args, env);
-  object_t *first = args;
-  object_t *rest = args->next;
+  object_t *first = args[0];
+  object_t *rest = args[1];
 
   return object_new_pair (first, rest, current_heap);
 }
 
 object_t *
-builtin_car (object_t *args, object_t *env)
+builtin_car (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
+  if (argc == 0)
     raise_runtime_error ("car takes one argument");
 
-  deref_symbols (args, env);
-  if (args->type != OBJ_Pair)
+  if (args[0]->type != OBJ_Pair)
     raise_runtime_error ("car takes a pair argument");
 
-  return args->v_pair->first;
+  return args[0]->v_pair->first;
 }
 
 object_t *
-builtin_cdr (object_t *args, object_t *env)
+builtin_cdr (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
+  if (argc == 0)
     raise_runtime_error ("cdr takes one argument");
 
-  deref_symbols (args, env);
-  if (args->type != OBJ_Pair)
+  if (args[0]->type != OBJ_Pair)
     raise_runtime_error ("cdr takes a pair argument");
 
-  return args->v_pair->rest;
+  return args[0]->v_pair->rest;
 }
 
 object_t *
-builtin_length (object_t *args, object_t *env)
+builtin_length (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
+  if (argc == 0)
     raise_runtime_error ("length takes one argument");
 
-  deref_symbols (args, env);
-  if (args->type != OBJ_Pair)
-    raise_runtime_error ("length takes a list as argument");
-
-  intmax_t len = 1;
-  object_t *current = args;
-
-  while (current->type == OBJ_Pair && current->rest->type != OBJ_Nil)
+  intmax_t len = 0;
+  object_t *current = args[0];
+  while (current->type == OBJ_Pair)
     {
       len++;
-      current = current->rest;
+      current = current->v_pair->rest;
     }
 
+  if (current->type != OBJ_Nil)
+    raise_runtime_error ("length takes a list as argument");
   return object_new_integer (len, current_heap);
 }
 
 object_t *
-builtin_list (object_t *args, object_t *env)
+builtin_list (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
+  if (argc == 0)
     raise_runtime_error ("list takes at least one argument");
 
-  object_t *result = object_new_pair (args, object_nil, current_heap);
-  object_t *tail = result;
-  args = args->next;
-
-  while (args)
-    {
-      object_t *new_pair = object_new_pair (args, object_nil, current_heap);
-      tail->v_pair->rest = new_pair;
-      tail = new_pair;
-      args = args->next;
-    }
+  object_t *result = object_nil;
+  for (size_t i = argc; i > 0; i--)
+    result = object_new_pair (args[i - 1], result, current_heap);
 
   return result;
 }
 
 object_t *
-builtin_append (object_t *args, object_t *env)
+builtin_append (object_t **args, size_t argc, object_t *env)
 {
-  deref_symbols (args, env);
-
-  if (!args)
+  if (argc == 0)
     return object_nil;
 
-  if (!args->next)
-    return args;
+  if (argc == 1)
+    return args[0];
 
-  size_t num_args = 1;
-  object_t *cursor = args;
-  for (cursor = args->next; cursor; cursor = cursor->next)
-    num_args++;
-
-  object_t **args_array = malloc (num_args * sizeof (object_t *));
-  size_t i = 0;
-  for (cursor = args; cursor; cursor = cursor->next)
-    args_array[i++] = cursor;
-
-  object_t *result = args_array[num_args - 1];
-  for (size_t j = num_args - 2; j >= 0; j--)
+  object_t *result = args[argc - 1];
+  for (size_t j = argc - 1; j-- > 0;)
     {
-      object_t *lst = args_array[j];
+      object_t *lst = args[j];
 
       if (lst->type == OBJ_Nil)
         continue;
@@ -983,10 +1891,10 @@ builtin_append (object_t *args, object_t *env)
       while (old_rest->type == OBJ_Pair)
         {
           object_t *new_pair
-              = object_new_pair (old_rest->v_pair->first, NULL, current_head);
+              = object_new_pair (old_rest->v_pair->first, NULL, current_heap);
           new_tail->v_pair->rest = new_pair;
           new_tail = new_pair;
-          old_rest = old_rest->v_pair->rest
+          old_rest = old_rest->v_pair->rest;
         }
 
       if (old_rest->type != OBJ_Nil)
@@ -997,21 +1905,20 @@ builtin_append (object_t *args, object_t *env)
       result = new_head;
     }
 
-  free (args_array);
   return result;
 }
 
 object_t *
-builtin_set (object_t *args, object_t *env)
+builtin_set (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || !args->next)
+  if (argc < 2)
     raise_runtime_error ("set! takes two arguments");
 
-  if (args->type != OBJ_Symbol)
+  if (args[0]->type != OBJ_Symbol)
     raise_runtime_error ("set! takes a symbol as first argument");
 
-  object_t *key = args;
-  object_t *val = args->next;
+  object_t *key = args[0];
+  object_t *val = args[1];
 
   environ_install (env->v_environ, key, val);
 
@@ -1019,33 +1926,637 @@ builtin_set (object_t *args, object_t *env)
 }
 
 object_t *
-builtin_apply (object_t *args, object_t *env)
+builtin_apply (object_t **args, size_t argc, object_t *env)
 {
-  if (!args)
+  if (argc == 0)
     raise_runtime_error ("apply takes at least one argument");
 
-  deref_symbols (args, env);
-  if (args->type != OBJ_Procedure)
-    raise_runtime_error ("apply takes a procedure argument");
+  switch (args[0]->type)
+    {
+    case OBJ_Procedure:
+    case OBJ_Closure:
+    case OBJ_Builtin:
+    case OBJ_Conti:
+      break;
+    default:
+      raise_runtime_error ("apply takes a procedure argument");
+    }
+
+  /* The arguments between the procedure and the last are passed as they
+     are, the last, a list, spread out after them.  */
+  size_t n = argc > 1 ? argc - 2 : 0;
+  object_t *lst = argc > 1 ? args[argc - 1] : object_nil;
+  for (object_t *p = lst; p->type == OBJ_Pair; p = p->v_pair->rest)
+    n++;
+  object_t **argv = malloc ((n ? n : 1) * sizeof (object_t *));
+  size_t i = 0;
+  for (; i + 2 < argc; i++)
+    argv[i] = args[i + 1];
+  for (; lst->type == OBJ_Pair; lst = lst->v_pair->rest)
+    argv[i++] = lst->v_pair->first;
+  if (lst->type != OBJ_Nil)
+    {
+      free (argv);
+      raise_runtime_error ("apply takes a list as last argument");
+    }
+
+  object_t *result = eval_apply (current_interp, args[0], n, argv);
+  free (argv);
+  return result;
+}
+
+object_t *
+builtin_quote (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("quote takes exactly one argument");
 
-  procedure_t *proc = args->v_procedure;
-  object_t *proc_args = args->next;
+  return args[0];
+}
 
-  if (proc->closure)
+/* Append a short external representation of OBJ to BUF, which holds
+   *LEN of SIZE bytes.  Only atoms are spelled out.  */
+static void
+describe (object_t *obj, char *buf, size_t size, size_t *len)
+{
+  int n;
+  switch (obj->type)
     {
-      eval_closure (proc->value->v_closure, proc_args, env);
+    case OBJ_Symbol:
+      {
+        size_t bytes;
+        uint8_t *id = string_encode (obj->v_symbol->id,
+                                     u32strlen (obj->v_symbol->id), &bytes);
+        n = snprintf (buf + *len, size - *len, " %s", (char *)id);
+        free (id);
+        break;
+      }
+    case OBJ_String:
+      n = snprintf (buf + *len, size - *len, " \"%.*s\"",
+                    (int)obj->v_string->size,
+                    (const char *)string_bytes (obj->v_string));
+      break;
+    case OBJ_Integer:
+      n = snprintf (buf + *len, size - *len, " %jd", obj->v_integer);
+      break;
+    case OBJ_Real:
+      n = snprintf (buf + *len, size - *len, " %g", obj->v_real);
+      break;
+    case OBJ_Bool:
+      n = snprintf (buf + *len, size - *len, obj->v_bool ? " #t" : " #f");
+      break;
+    case OBJ_Nil:
+      n = snprintf (buf + *len, size - *len, " ()");
+      break;
+    default:
+      n = snprintf (buf + *len, size - *len, " #<object>");
+      break;
     }
-  else
+  if (n > 0)
+    *len = *len + n < size ? *len + n : size - 1;
+}
+
+/* Raise an error whose message is the string MESSAGE followed by the
+   irritants.  */
+object_t *
+builtin_error (object_t **args, size_t argc, object_t *env)
+{
+  if (argc == 0 || args[0]->type != OBJ_String)
+    raise_runtime_error ("error takes a message string");
+
+  char buf[ERROR_MESSAGE_SIZE];
+  size_t len = 0;
+  int n = snprintf (buf, sizeof buf, "%.*s", (int)args[0]->v_string->size,
+                    (const char *)string_bytes (args[0]->v_string));
+  if (n > 0)
+    len = (size_t)n < sizeof buf ? (size_t)n : sizeof buf - 1;
+  for (size_t i = 1; i < argc; i++)
+    describe (args[i], buf, sizeof buf, &len);
+  raise_runtime_error ("%s", buf);
+}
+
+/* Read the next datum from a port, or #f at the end of input.  The port
+   keeps its reader, and with it any input read ahead, between calls.  */
+object_t *
+builtin_read (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("read takes exactly one argument");
+
+  if (args[0]->type != OBJ_Port || !args[0]->v_port->read)
+    raise_runtime_error ("read takes an input port argument");
+
+  port_t *port = args[0]->v_port;
+  if (!port->reader)
+    port->reader = reader_port (port, current_heap);
+
+  object_t *datum = reader_read (port->reader);
+  return datum ? datum : object_false;
+}
+
+static port_t *
+input_port_arg (object_t *arg, const char *who)
+{
+  if (arg->type != OBJ_Port || !arg->v_port->read)
+    raise_runtime_error ("%s takes an input port argument", who);
+  return arg->v_port;
+}
+
+/* Fill BV from START to END with bytes from a port, returning how many
+   were read, or #f at the end of input.  Whatever the port has buffered
+   is used first; a request at least as large as its buffer then reads
+   straight into the bytevector.  */
+object_t *
+builtin_read_bytevector_bang (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2 || argc > 4)
+    raise_runtime_error ("read-bytevector! takes two to four arguments");
+
+  if (args[0]->type != OBJ_Bytevector)
+    raise_runtime_error ("read-bytevector! takes a bytevector argument");
+
+  bytevector_t *bv = args[0]->v_bytevector;
+  if (bv->mapped)
+    raise_runtime_error ("read-bytevector! cannot fill a mapped bytevector");
+  port_t *port = input_port_arg (args[1], "read-bytevector!");
+  object_t *start_arg = argc > 2 ? args[2] : NULL;
+  object_t *end_arg = argc > 3 ? args[3] : NULL;
+  if ((start_arg && start_arg->type != OBJ_Integer)
+      || (end_arg && end_arg->type != OBJ_Integer))
+    raise_runtime_error ("read-bytevector! takes integer bounds");
+
+  intmax_t start = start_arg ? start_arg->v_integer : 0;
+  intmax_t end = end_arg ? end_arg->v_integer : (intmax_t)bv->count;
+  if (start < 0 || end < start || (size_t)end > bv->count)
+    raise_runtime_error ("read-bytevector! bounds out of range");
+  if (start == end)
+    return object_new_integer (0, current_heap);
+
+  ssize_t n = port_read (port, bv->vals + start, end - start);
+  if (n < 0)
+    raise_runtime_error ("read failed");
+
+  return n ? object_new_integer (n, current_heap) : object_false;
+}
+
+object_t *
+builtin_read_line (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("read-line takes exactly one argument");
+
+  port_t *port = input_port_arg (args[0], "read-line");
+
+  size_t size;
+  uint8_t *text = port_read_line (port, &size);
+  if (!text)
+    return object_false;
+
+  return object_new_string_from (text, size, current_heap);
+}
+
+object_t *
+builtin_read_string (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 2)
+    raise_runtime_error ("read-string takes two arguments");
+
+  if (args[0]->type != OBJ_Integer || args[0]->v_integer < 0)
+    raise_runtime_error ("read-string takes a non-negative integer argument");
+  port_t *port = input_port_arg (args[1], "read-string");
+
+  size_t size;
+  uint8_t *text = port_read_string (port, args[0]->v_integer, &size);
+  if (!text)
+    return object_false;
+
+  return object_new_string_from (text, size, current_heap);
+}
+
+object_t *
+builtin_flush_output_port (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("flush-output-port takes exactly one argument");
+
+  if (args[0]->type != OBJ_Port
+      || !(args[0]->v_port->write || args[0]->v_port->append))
+    raise_runtime_error ("flush-output-port takes an output port argument");
+
+  if (!port_flush (args[0]->v_port))
+    raise_runtime_error ("write failed");
+  return object_nil;
+}
+
+/* Small writes are gathered in the port's buffer; anything at least as
+   large as the buffer goes straight from the bytevector to the
+   descriptor.  */
+object_t *
+builtin_write_bytevector (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 2)
+    raise_runtime_error ("write-bytevector takes two arguments");
+
+  if (args[0]->type != OBJ_Bytevector)
+    raise_runtime_error ("write-bytevector takes a bytevector argument");
+  if (args[1]->type != OBJ_Port
+      || !(args[1]->v_port->write || args[1]->v_port->append))
+    raise_runtime_error ("write-bytevector takes an output port argument");
+
+  bytevector_t *bv = args[0]->v_bytevector;
+  if (port_write (args[1]->v_port, bv->vals, bv->count) < 0)
+    raise_runtime_error ("write failed");
+  return object_nil;
+}
+
+object_t *
+builtin_set_port_buffer_size (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 2)
+    raise_runtime_error ("set-port-buffer-size! takes two arguments");
+
+  if (args[0]->type != OBJ_Port)
+    raise_runtime_error ("set-port-buffer-size! takes a port argument");
+  if (args[1]->type != OBJ_Integer || args[1]->v_integer <= 0)
+    raise_runtime_error ("set-port-buffer-size! takes a positive integer "
+                         "argument");
+
+  port_set_buffer_size (args[0]->v_port, args[1]->v_integer);
+  return object_nil;
+}
+
+/* Copy everything left in one port, or at most COUNT bytes of it, to
+   another, returning how many bytes were copied.  The data never passes
+   through the heap.  */
+object_t *
+builtin_copy_port (object_t **args, size_t argc, object_t *env)
+{
+  if (argc < 2 || argc > 3)
+    raise_runtime_error ("copy-port takes two or three arguments");
+
+  port_t *src = input_port_arg (args[0], "copy-port");
+  object_t *dst = args[1];
+  if (dst->type != OBJ_Port || !(dst->v_port->write || dst->v_port->append))
+    raise_runtime_error ("copy-port takes an output port argument");
+
+  size_t limit = SIZE_MAX;
+  object_t *count = argc > 2 ? args[2] : NULL;
+  if (count)
     {
-      eval_builtin (proc->value->v_builtin, proc_args, env);
+      if (count->type != OBJ_Integer || count->v_integer < 0)
+        raise_runtime_error ("copy-port takes a non-negative integer count");
+      limit = count->v_integer;
     }
+
+  ssize_t n = port_copy (dst->v_port, src, limit);
+  if (n < 0)
+    raise_runtime_error ("copy failed");
+  return object_new_integer (n, current_heap);
+}
+
+static void
+path_arg (object_t *arg, char *path, const char *who)
+{
+  if (arg->type != OBJ_String)
+    raise_runtime_error ("%s takes a string argument", who);
+  if (arg->v_string->size > PATH_MAX)
+    raise_runtime_error ("%s: path too long", who);
+  memcpy (path, string_bytes (arg->v_string), arg->v_string->size);
+  path[arg->v_string->size] = '\0';
+}
+
+/* The file ports under their R7RS names.  Text and binary ports differ
+   only in what they accept, so each pair shares one opener.  */
+static object_t *
+open_file (object_t **args, size_t argc, object_t *env, bool read,
+           bool binary, const char *who)
+{
+  if (argc != 1)
+    raise_runtime_error ("%s takes exactly one argument", who);
+
+  char path[PATH_MAX + 1];
+  path_arg (args[0], path, who);
+  return object_new_port (path, read, !read, false, binary, current_heap);
 }
 
 object_t *
-builtin_quote (object_t *args, object_t *env)
+builtin_open_input_file (object_t **args, size_t argc, object_t *env)
 {
-  if (!args || args->next)
-    raise_runtime_error ("quote takes exactly one argument");
+  return open_file (args, argc, env, true, false, "open-input-file");
+}
+
+object_t *
+builtin_open_binary_input_file (object_t **args, size_t argc, object_t *env)
+{
+  return open_file (args, argc, env, true, true, "open-binary-input-file");
+}
+
+object_t *
+builtin_open_output_file (object_t **args, size_t argc, object_t *env)
+{
+  return open_file (args, argc, env, false, false, "open-output-file");
+}
+
+object_t *
+builtin_open_binary_output_file (object_t **args, size_t argc, object_t *env)
+{
+  return open_file (args, argc, env, false, true, "open-binary-output-file");
+}
+
+object_t *
+builtin_open_mapped_input_port (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("open-mapped-input-port takes exactly one argument");
+
+  char path[PATH_MAX + 1];
+  path_arg (args[0], path, "open-mapped-input-port");
+  return object_new_port_mapped (path, current_heap);
+}
+
+/* The bytevector reads straight out of the page cache; nothing is copied
+   onto the heap, and the mapping goes when the bytevector is collected.
+   Bytevectors made this way are read-only.  */
+object_t *
+builtin_file_to_bytevector_mapped (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("file->bytevector/mapped takes exactly one argument");
+
+  char path[PATH_MAX + 1];
+  path_arg (args[0], path, "file->bytevector/mapped");
+  size_t size;
+  uint8_t *map = port_map_file (path, &size, MADV_NORMAL);
+  return object_new_bytevector_mapped (map, size, current_heap);
+}
 
-  return args;
+static port_t *
+memory_port_arg (object_t *arg, const char *who)
+{
+  if (arg->type != OBJ_Port || !arg->v_port->memory || !arg->v_port->write)
+    raise_runtime_error ("%s takes an output string or bytevector port", who);
+  return arg->v_port;
+}
+
+object_t *
+builtin_open_input_string (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("open-input-string takes exactly one argument");
+
+  if (args[0]->type != OBJ_String)
+    raise_runtime_error ("open-input-string takes a string argument");
+
+  object_t *port = object_new_port_memory (true, false, false, current_heap);
+  port_write (port->v_port, string_bytes (args[0]->v_string),
+              args[0]->v_string->size);
+  return port;
+}
+
+object_t *
+builtin_open_input_bytevector (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("open-input-bytevector takes exactly one argument");
+
+  if (args[0]->type != OBJ_Bytevector)
+    raise_runtime_error ("open-input-bytevector takes a bytevector argument");
+
+  object_t *port = object_new_port_memory (true, false, true, current_heap);
+  port_write (port->v_port, args[0]->v_bytevector->vals,
+              args[0]->v_bytevector->count);
+  return port;
+}
+
+object_t *
+builtin_open_output_string (object_t **args, size_t argc, object_t *env)
+{
+  if (argc)
+    raise_runtime_error ("open-output-string takes no arguments");
+
+  return object_new_port_memory (false, true, false, current_heap);
+}
+
+object_t *
+builtin_open_output_bytevector (object_t **args, size_t argc, object_t *env)
+{
+  if (argc)
+    raise_runtime_error ("open-output-bytevector takes no arguments");
+
+  return object_new_port_memory (false, true, true, current_heap);
+}
+
+/* The string takes over the port's buffer as it is, which needs no
+   conversion now that both hold UTF-8; the port only copies it back if it
+   is written to again.  A buffer already handed to a bytevector, or not
+   valid UTF-8, is copied instead.  */
+object_t *
+builtin_get_output_string (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("get-output-string takes exactly one argument");
+
+  port_t *port = memory_port_arg (args[0], "get-output-string");
+  if (port->shared && port->shared->type == OBJ_String)
+    return port->shared;
+  if (port->shared || !string_valid (port->buf, port->end))
+    return object_new_string_utf8 (port->buf, port->end, current_heap);
+
+  size_t size;
+  uint8_t *bytes = port_share (port, NULL, &size);
+  port->shared = object_new_string_from (bytes, size, current_heap);
+  return port->shared;
+}
+
+/* Like get-output-string, without the need for valid UTF-8.  */
+object_t *
+builtin_get_output_bytevector (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 1)
+    raise_runtime_error ("get-output-bytevector takes exactly one argument");
+
+  port_t *port = memory_port_arg (args[0], "get-output-bytevector");
+  if (port->shared && port->shared->type == OBJ_Bytevector)
+    return port->shared;
+  if (port->shared)
+    {
+      object_t *bv = object_new_bytevector (port->end, current_heap);
+      memcpy (bv->v_bytevector->vals, port->buf, port->end);
+      bv->v_bytevector->count = port->end;
+      return bv;
+    }
+
+  object_t *bv = object_new_bytevector_from (NULL, 0, current_heap);
+  size_t n;
+  bv->v_bytevector->vals = port_share (port, bv, &n);
+  bv->v_bytevector->size = bv->v_bytevector->count = n;
+  return bv;
+}
+
+object_t *
+builtin_write_string (object_t **args, size_t argc, object_t *env)
+{
+  if (argc != 2)
+    raise_runtime_error ("write-string takes two arguments");
+
+  if (args[0]->type != OBJ_String)
+    raise_runtime_error ("write-string takes a string argument");
+  if (args[1]->type != OBJ_Port
+      || !(args[1]->v_port->write || args[1]->v_port->append))
+    raise_runtime_error ("write-string takes an output port argument");
+
+  if (port_write (args[1]->v_port, string_bytes (args[0]->v_string),
+                  args[0]->v_string->size)
+      < 0)
+    raise_runtime_error ("write failed");
+  return object_nil;
+}
+
+/* The entries for the eight SRFI 4 procedures of element type TAG.  */
+#define NUMVECTOR_ENTRIES(tag)                                                \
+  { "make-" #tag "vector", builtin_make_##tag##vector },                      \
+  { #tag "vector", builtin_##tag##vector },                                   \
+  { #tag "vector?", builtin_##tag##vector_p },                                \
+  { #tag "vector-length", builtin_##tag##vector_length },                     \
+  { #tag "vector-ref", builtin_##tag##vector_ref },                           \
+  { #tag "vector-set!", builtin_##tag##vector_set },                          \
+  { #tag "vector->list", builtin_##tag##vector_to_list },                     \
+  { "list->" #tag "vector", builtin_list_to_##tag##vector }
+
+/* Every builtin under the name programs call it by.  Builtin objects point
+   at their entry's function, so the table lives as long as the process.
+   Forms the compiler handles itself, such as `set!' and `quote', are not
+   here, nor are the fiber and parallel primitives, which it compiles to
+   instructions of their own.  */
+static const struct
+{
+  const char *name;
+  primfn_t fn;
+} builtins[] = {
+  { "+", builtin_add },
+  { "-", builtin_subtract },
+  { "*", builtin_multiply },
+  { "/", builtin_divide },
+  { "quotient", builtin_quotient },
+  { "modulo", builtin_modulo },
+  { "remainder", builtin_remainder },
+  { "fl+", builtin_fl_add },
+  { "fl-", builtin_fl_subtract },
+  { "fl*", builtin_fl_multiply },
+  { "fl/", builtin_fl_divide },
+  { "fl=", builtin_fl_equal },
+  { "fl<", builtin_fl_less },
+  { "fl>", builtin_fl_greater },
+  { "fl<=", builtin_fl_less_equal },
+  { "fl>=", builtin_fl_greater_equal },
+  { "exact->inexact", builtin_exact_to_inexact },
+  { "inexact", builtin_exact_to_inexact },
+  { "number->string", builtin_number_to_string },
+  { "string->number", builtin_string_to_number },
+  { "=", builtin_nums_equal },
+  { ">", builtin_nums_greater },
+  { ">=", builtin_nums_greater_equal },
+  { "<", builtin_nums_lesser },
+  { "<=", builtin_nums_lesser_equal },
+  { "not", builtin_not },
+  { "eq?", builtin_eq },
+  { "eqv?", builtin_eqv },
+  { "equal?", builtin_equal },
+  { "string=?", builtin_strings_equal },
+  { "string<?", builtin_strings_lesser },
+  { "string<=?", builtin_strings_lesser_equal },
+  { "string>?", builtin_strings_greater },
+  { "string>=?", builtin_strings_greater_equal },
+  { "char=?", builtin_characters_equal },
+  { "char>?", builtin_characters_greater },
+  { "char>=?", builtin_characters_greater_equal },
+  { "char<?", builtin_characters_lesser },
+  { "char<=?", builtin_characters_lesser_equal },
+  { "char-upcase", builtin_char_upcase },
+  { "char-downcase", builtin_char_downcase },
+  { "char-foldcase", builtin_char_foldcase },
+  { "char-alphabetic?", builtin_char_alphabetic },
+  { "char-numeric?", builtin_char_numeric },
+  { "char-whitespace?", builtin_char_whitespace },
+  { "char-upper-case?", builtin_char_upper_case },
+  { "char-lower-case?", builtin_char_lower_case },
+  { "digit-value", builtin_digit_value },
+  { "string-ref", builtin_string_ref },
+  { "string-length", builtin_string_length },
+  { "string-append", builtin_string_append },
+  { "substring", builtin_substring },
+  { "string-index", builtin_string_index },
+  { "string-contains", builtin_string_contains },
+  { "string-search-all", builtin_string_search_all },
+  { "string-upcase", builtin_string_upcase },
+  { "string-downcase", builtin_string_downcase },
+  { "string-foldcase", builtin_string_foldcase },
+  { "regexp-compile", builtin_regexp_compile },
+  { "regexp-match", builtin_regexp_match },
+  { "regexp-search", builtin_regexp_search },
+  { "regexp-replace", builtin_regexp_replace },
+  { "list-ref", builtin_list_ref },
+  { "vector-ref", builtin_vector_ref },
+  { "bytevector-u8-ref", builtin_bytevector_ref },
+  { "f64vector-add!", builtin_f64vector_add },
+  { "f64vector-scale!", builtin_f64vector_scale },
+  { "f64vector-dot", builtin_f64vector_dot },
+  { "f64vector-sum", builtin_f64vector_sum },
+  { "cons", builtin_cons },
+  { "car", builtin_car },
+  { "cdr", builtin_cdr },
+  { "length", builtin_length },
+  { "list", builtin_list },
+  { "append", builtin_append },
+  { "error", builtin_error },
+  { "read", builtin_read },
+  { "read-bytevector!", builtin_read_bytevector_bang },
+  { "read-line", builtin_read_line },
+  { "read-string", builtin_read_string },
+  { "flush-output-port", builtin_flush_output_port },
+  { "write-bytevector", builtin_write_bytevector },
+  { "write-string", builtin_write_string },
+  { "set-port-buffer-size!", builtin_set_port_buffer_size },
+  { "copy-port", builtin_copy_port },
+  { "open-input-file", builtin_open_input_file },
+  { "open-binary-input-file", builtin_open_binary_input_file },
+  { "open-output-file", builtin_open_output_file },
+  { "open-binary-output-file", builtin_open_binary_output_file },
+  { "open-mapped-input-port", builtin_open_mapped_input_port },
+  { "file->bytevector/mapped", builtin_file_to_bytevector_mapped },
+  { "open-input-string", builtin_open_input_string },
+  { "open-input-bytevector", builtin_open_input_bytevector },
+  { "open-output-string", builtin_open_output_string },
+  { "open-output-bytevector", builtin_open_output_bytevector },
+  { "get-output-string", builtin_get_output_string },
+  { "get-output-bytevector", builtin_get_output_bytevector },
+  NUMVECTOR_ENTRIES (u8),
+  NUMVECTOR_ENTRIES (s8),
+  NUMVECTOR_ENTRIES (u16),
+  NUMVECTOR_ENTRIES (s16),
+  NUMVECTOR_ENTRIES (u32),
+  NUMVECTOR_ENTRIES (s32),
+  NUMVECTOR_ENTRIES (u64),
+  NUMVECTOR_ENTRIES (s64),
+  NUMVECTOR_ENTRIES (f32),
+  NUMVECTOR_ENTRIES (f64),
+};
+
+/* Bind every builtin in ENV, normally the toplevel of a new interpreter.  */
+void
+builtin_install (environ_t *env, heap_t *heap)
+{
+  for (size_t i = 0; i < sizeof (builtins) / sizeof (builtins[0]); i++)
+    {
+      const char *name = builtins[i].name;
+      size_t len = strlen (name);
+      char32_t id[MAX_PRIM_NAME + 1];
+      for (size_t j = 0; j < len; j++)
+        id[j] = (unsigned char)name[j];
+      id[len] = U'\0';
+
+      environ_install (env, object_intern_symbol (id, len, heap),
+                       object_new_builtin (name, (primfn_t *)&builtins[i].fn,
+                                           heap));
+    }
 }
@@ -0,0 +1,9 @@
+#ifndef BUILTIN_H
+#define BUILTIN_H
+
+#include "heap.h"
+#include "object.h"
+
+void builtin_install (environ_t *env, heap_t *heap);
+
+#endif
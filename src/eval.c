@@ -1,4 +1,3103 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "bignum.h"
 #include "eval.h"
+#include "heap.h"
+#include "interp.h"
+#include "isolate.h"
+#include "numvec.h"
 #include "object.h"
+#include "pool.h"
+#include "port.h"
 #include "reader.h"
+#include "utils.h"
+
+#define MAX_OPERANDS 4
+#define DISPATCH_MIN_KEYS 4
+
+#define CONTI_FULL 0
+#define CONTI_ONESHOT 1
+#define CONTI_DELIMITED 2
+
+#define FIBER_Spawn 0
+#define FIBER_Yield 1
+#define FIBER_Sleep 2
+#define FIBER_Channel 3
+#define FIBER_Send 4
+#define FIBER_Recv 5
+#define FIBER_Read 6
+#define FIBER_Write 7
+#define FIBER_Exit 8
+#define FIBER_IsolateSpawn 9
+#define FIBER_IsolateSend 10
+#define FIBER_IsolateRecv 11
+#define FIBER_IsolateJoin 12
+#define FIBER_IsolateParent 13
+
+#define PAR_Future 0
+#define PAR_Touch 1
+#define PAR_Map 2
+#define PAR_ForEach 3
+#define PAR_Reduce 4
+
+#define PARALLEL_CHUNKS_PER_THREAD 4
+
+#define BULK_F64Map 0
+
+#define FL_Add 0
+#define FL_Sub 1
+#define FL_Mul 2
+#define FL_Div 3
+
+#define FL_Equal 0
+#define FL_Less 1
+#define FL_Greater 2
+#define FL_LessEqual 3
+#define FL_GreaterEqual 4
+
+#define FLONUM_REGISTERS 16
+
+#define EVAL_DEADLINE_INTERVAL 65536
+
+#define SP (stk->base + stk->count)
+#define LOCAL(o) (stk->objs[(intmax_t)(f - stk->base) + (o)])
+#define OPERAND_INT(x, i) (operand ((x), (i))->v_integer)
+
+/* Burn one unit of fuel at a call or backward jump, the only places a
+   script can loop, and return to the host if it asks to be preempted.  */
+#define VM_TICK()                                                             \
+  do                                                                          \
+    if (--fuel <= 0 && !(x = vm_preempt (interp, x, &a, &f, &c, &fuel)))      \
+      return NULL;                                                            \
+  while (0)
+
+/* Stop for a collection, or for another thread that needs the heap to
+   itself.  Like VM_TICK this only runs where control transfers, at jumps,
+   calls and returns, so straight-line code pays nothing for it.  */
+#define VM_SAFEPOINT()                                                        \
+  do                                                                          \
+    if (atomic_load_explicit (&heap->stop, memory_order_acquire)              \
+        || atomic_load_explicit (&heap->collect, memory_order_relaxed))       \
+      {                                                                       \
+        interp->accumulator = a;                                              \
+        interp->next_expr = x;                                                \
+        interp->closure = c;                                                  \
+        heap_maybe_collect (heap);                                            \
+        heap_safepoint (heap);                                                \
+      }                                                                       \
+  while (0)
+
+static object_t *compile (interp_t *interp, object_t *x, scope_t *scope,
+                          size_t depth, object_t *next);
+static void scan (interp_t *interp, object_t *x, object_t *bound,
+                  int lambdas, bool tail, scan_t *st);
+
+static bool
+u32streq (const char32_t *s1, const char32_t *s2)
+{
+  while (*s1 && *s1 == *s2)
+    {
+      s1++;
+      s2++;
+    }
+  return *s1 == *s2;
+}
+
+static inline bool
+symbol_is (object_t *x, const char32_t *id)
+{
+  return x->type == OBJ_Symbol && u32streq (x->v_symbol->id, id);
+}
+
+static inline bool
+symbols_equal (object_t *sym1, object_t *sym2)
+{
+  return u32streq (sym1->v_symbol->id, sym2->v_symbol->id);
+}
+
+static inline object_t *
+symbol (interp_t *interp, const char32_t *id)
+{
+  return object_intern_symbol (id, u32strlen (id), interp->heap);
+}
+
+static inline object_t *
+pair (interp_t *interp, object_t *first, object_t *rest)
+{
+  return object_new_pair (first, rest, interp->heap);
+}
+
+static inline object_t *
+fixnum (interp_t *interp, intmax_t value)
+{
+  return object_new_integer (value, interp->heap);
+}
+
+static inline bool
+is_false (object_t *obj)
+{
+  return obj->type == OBJ_Bool && !obj->v_bool;
+}
+
+static bool
+memq_symbol (object_t *sym, object_t *lst)
+{
+  for (; lst->type == OBJ_Pair; lst = cdr (lst))
+    if (symbols_equal (sym, car (lst)))
+      return true;
+  return false;
+}
+
+static object_t *
+list_nreverse (object_t *lst)
+{
+  object_t *result = object_nil;
+  while (lst->type == OBJ_Pair)
+    {
+      object_t *rest = lst->v_pair->rest;
+      lst->v_pair->rest = result;
+      result = lst;
+      lst = rest;
+    }
+  return result;
+}
+
+/* Instructions are lists of the form (OPCODE OPERAND ... NEXT), where NEXT
+   is the instruction to continue with.  */
+static object_t *
+insn (interp_t *interp, opcode_t op, size_t n, ...)
+{
+  object_t *operands[MAX_OPERANDS];
+  va_list args;
+  va_start (args, n);
+  for (size_t i = 0; i < n; i++)
+    operands[i] = va_arg (args, object_t *);
+  va_end (args);
+
+  object_t *code = object_nil;
+  for (size_t i = n; i > 0; i--)
+    code = pair (interp, operands[i - 1], code);
+
+  return pair (interp, object_new_opcode (op, interp->heap), code);
+}
+
+static inline object_t *
+operand (object_t *x, size_t i)
+{
+  x = x->v_pair->rest;
+  while (i--)
+    x = x->v_pair->rest;
+  return x->v_pair->first;
+}
+
+static inline bool
+is_tail (object_t *next)
+{
+  return car (next)->v_opcode == OP_Return;
+}
+
+static binding_t *
+scope_lookup (scope_t *scope, object_t *sym)
+{
+  for (binding_t *b = scope->bindings; b; b = b->next)
+    if (symbols_equal (b->name, sym))
+      return b;
+  return NULL;
+}
+
+/* Derived syntax is rewritten into the core forms understood by the
+   compiler.  Returns X itself when it is not a derived form.  */
+static object_t *
+expand_derived (interp_t *interp, object_t *x)
+{
+  heap_t *heap = interp->heap;
+  object_t *head = car (x);
+  object_t *rest = cdr (x);
+
+  if (symbol_is (head, U"let*"))
+    {
+      object_t *bindings = car (rest);
+      if (bindings->type != OBJ_Pair || cdr (bindings)->type != OBJ_Pair)
+        return pair (interp, symbol (interp, U"let"), rest);
+
+      object_t *inner = pair (interp, head, pair (interp, cdr (bindings),
+                                                   cdr (rest)));
+      return create_list (heap, 3, symbol (interp, U"let"),
+                          create_list (heap, 1, car (bindings)), inner);
+    }
+
+  if (symbol_is (head, U"letrec") || symbol_is (head, U"letrec*"))
+    {
+      object_t *vars = object_nil;
+      object_t *body = object_nil;
+      for (object_t *b = car (rest); b->type == OBJ_Pair; b = cdr (b))
+        {
+          object_t *var = car (car (b));
+          vars = pair (interp, create_list (heap, 2, var, object_false), vars);
+          body = pair (interp,
+                       create_list (heap, 3, symbol (interp, U"set!"), var,
+                                    car (cdr (car (b)))),
+                       body);
+        }
+      body = pair (interp,
+                   pair (interp, symbol (interp, U"let"),
+                         pair (interp, object_nil, cdr (rest))),
+                   body);
+      return pair (interp, symbol (interp, U"let"),
+                   pair (interp, list_nreverse (vars), list_nreverse (body)));
+    }
+
+  if (symbol_is (head, U"let") && car (rest)->type == OBJ_Symbol)
+    {
+      object_t *name = car (rest);
+      object_t *vars = object_nil;
+      object_t *inits = object_nil;
+      for (object_t *b = car (cdr (rest)); b->type == OBJ_Pair; b = cdr (b))
+        {
+          vars = pair (interp, car (car (b)), vars);
+          inits = pair (interp, car (cdr (car (b))), inits);
+        }
+
+      object_t *lambda = pair (interp, symbol (interp, U"lambda"),
+                               pair (interp, list_nreverse (vars),
+                                     cdr (cdr (rest))));
+      object_t *letrec = create_list (
+          heap, 3, symbol (interp, U"letrec"),
+          create_list (heap, 1, create_list (heap, 2, name, lambda)), name);
+      return pair (interp, letrec, list_nreverse (inits));
+    }
+
+  if (symbol_is (head, U"cond"))
+    {
+      if (rest->type != OBJ_Pair)
+        return object_nil;
+
+      object_t *clause = car (rest);
+      object_t *test = car (clause);
+      object_t *body = cdr (clause);
+      object_t *otherwise = cdr (rest)->type == OBJ_Pair
+                                ? pair (interp, head, cdr (rest))
+                                : object_nil;
+
+      if (symbol_is (test, U"else"))
+        return pair (interp, symbol (interp, U"begin"), body);
+      if (body->type != OBJ_Pair)
+        return create_list (heap, 3, symbol (interp, U"or"), test, otherwise);
+      if (symbol_is (car (body), U"=>"))
+        {
+          object_t *tmp = symbol (interp, U" cond-tmp");
+          return create_list (
+              heap, 3, symbol (interp, U"let"),
+              create_list (heap, 1, create_list (heap, 2, tmp, test)),
+              create_list (heap, 4, symbol (interp, U"if"), tmp,
+                           create_list (heap, 2, car (cdr (body)), tmp),
+                           otherwise));
+        }
+      return create_list (heap, 4, symbol (interp, U"if"), test,
+                          pair (interp, symbol (interp, U"begin"), body),
+                          otherwise);
+    }
+
+  if (symbol_is (head, U"case"))
+    {
+      object_t *tmp = symbol (interp, U" case-tmp");
+      object_t *clauses = object_nil;
+      for (object_t *c = cdr (rest); c->type == OBJ_Pair; c = cdr (c))
+        {
+          object_t *datums = car (car (c));
+          object_t *test = datums;
+          if (!symbol_is (datums, U"else"))
+            {
+              test = object_nil;
+              for (; datums->type == OBJ_Pair; datums = cdr (datums))
+                test = pair (
+                    interp,
+                    create_list (heap, 3, symbol (interp, U"eqv?"), tmp,
+                                 create_list (heap, 2,
+                                              symbol (interp, U"quote"),
+                                              car (datums))),
+                    test);
+              test = pair (interp, symbol (interp, U"or"),
+                           list_nreverse (test));
+            }
+          clauses = pair (interp, pair (interp, test, cdr (car (c))), clauses);
+        }
+      return create_list (
+          heap, 3, symbol (interp, U"let"),
+          create_list (heap, 1, create_list (heap, 2, tmp, car (rest))),
+          pair (interp, symbol (interp, U"cond"), list_nreverse (clauses)));
+    }
+
+  if (symbol_is (head, U"and"))
+    {
+      if (rest->type != OBJ_Pair)
+        return object_true;
+      if (cdr (rest)->type != OBJ_Pair)
+        return car (rest);
+      return create_list (heap, 4, symbol (interp, U"if"), car (rest),
+                          pair (interp, head, cdr (rest)), object_false);
+    }
+
+  if (symbol_is (head, U"or"))
+    {
+      if (rest->type != OBJ_Pair)
+        return object_false;
+      if (cdr (rest)->type != OBJ_Pair)
+        return car (rest);
+
+      object_t *tmp = symbol (interp, U" or-tmp");
+      return create_list (
+          heap, 3, symbol (interp, U"let"),
+          create_list (heap, 1, create_list (heap, 2, tmp, car (rest))),
+          create_list (heap, 4, symbol (interp, U"if"), tmp, tmp,
+                       pair (interp, head, cdr (rest))));
+    }
+
+  if (symbol_is (head, U"when") || symbol_is (head, U"unless"))
+    {
+      object_t *body = pair (interp, symbol (interp, U"begin"), cdr (rest));
+      if (symbol_is (head, U"when"))
+        return create_list (heap, 4, symbol (interp, U"if"), car (rest), body,
+                            object_nil);
+      return create_list (heap, 4, symbol (interp, U"if"), car (rest),
+                          object_nil, body);
+    }
+
+  if (symbol_is (head, U"do"))
+    {
+      object_t *loop = symbol (interp, U" do-loop");
+      object_t *bindings = object_nil;
+      object_t *steps = object_nil;
+      for (object_t *b = car (rest); b->type == OBJ_Pair; b = cdr (b))
+        {
+          object_t *spec = car (b);
+          object_t *step = cdr (cdr (spec))->type == OBJ_Pair
+                               ? car (cdr (cdr (spec)))
+                               : car (spec);
+          bindings = pair (interp,
+                           create_list (heap, 2, car (spec), car (cdr (spec))),
+                           bindings);
+          steps = pair (interp, step, steps);
+        }
+
+      object_t *exit = car (cdr (rest));
+      object_t *commands = object_nil;
+      for (object_t *c = cdr (cdr (rest)); c->type == OBJ_Pair; c = cdr (c))
+        commands = pair (interp, car (c), commands);
+      commands = list_nreverse (
+          pair (interp, pair (interp, loop, list_nreverse (steps)), commands));
+      return create_list (
+          heap, 4, symbol (interp, U"let"), loop, list_nreverse (bindings),
+          create_list (heap, 4, symbol (interp, U"if"), car (exit),
+                       pair (interp, symbol (interp, U"begin"),
+                             pair (interp, object_nil, cdr (exit))),
+                       pair (interp, symbol (interp, U"begin"), commands)));
+    }
+
+  /* The bodies of `reset' and `shift' run as closures, so the analysis sees
+     the variables they capture.  */
+  if (symbol_is (head, U"reset"))
+    return create_list (heap, 2, symbol (interp, U" reset"),
+                        pair (interp, symbol (interp, U"lambda"),
+                              pair (interp, object_nil, rest)));
+
+  if (symbol_is (head, U"shift"))
+    return create_list (heap, 2, symbol (interp, U" shift"),
+                        pair (interp, symbol (interp, U"lambda"),
+                              pair (interp, create_list (heap, 1, car (rest)),
+                                    cdr (rest))));
+
+  return x;
+}
+
+/* Leading internal definitions of a body become a `let' of the defined names
+   followed by assignments, which gives them `letrec*' semantics.  */
+static object_t *
+expand_body (interp_t *interp, object_t *body)
+{
+  object_t *vars = object_nil;
+  object_t *sets = object_nil;
+
+  while (body->type == OBJ_Pair && car (body)->type == OBJ_Pair
+         && symbol_is (car (car (body)), U"define"))
+    {
+      object_t *def = car (body);
+      object_t *target = car (cdr (def));
+      object_t *value;
+      if (target->type == OBJ_Pair)
+        {
+          value = pair (interp, symbol (interp, U"lambda"),
+                        pair (interp, cdr (target), cdr (cdr (def))));
+          target = car (target);
+        }
+      else
+        value = car (cdr (cdr (def)));
+
+      vars = pair (interp, create_list (interp->heap, 2, target, object_false),
+                   vars);
+      sets = pair (interp,
+                   create_list (interp->heap, 3, symbol (interp, U"set!"),
+                                target, value),
+                   sets);
+      body = cdr (body);
+    }
+
+  if (vars->type != OBJ_Pair)
+    return body;
+
+  while (sets->type == OBJ_Pair)
+    {
+      body = pair (interp, car (sets), body);
+      sets = cdr (sets);
+    }
+
+  return create_list (interp->heap, 1,
+                      pair (interp, symbol (interp, U"let"),
+                            pair (interp, list_nreverse (vars), body)));
+}
+
+static object_t *
+bind_formals (interp_t *interp, object_t *formals, object_t *bound)
+{
+  while (formals->type == OBJ_Pair)
+    {
+      bound = pair (interp, car (formals), bound);
+      formals = cdr (formals);
+    }
+  if (formals->type == OBJ_Symbol)
+    bound = pair (interp, formals, bound);
+  return bound;
+}
+
+static void
+scan_note (interp_t *interp, scan_t *st, object_t *sym, object_t *bound,
+           int lambdas, unsigned use)
+{
+  if (memq_symbol (sym, bound))
+    return;
+
+  if (st->target)
+    {
+      if (!symbols_equal (sym, st->target))
+        return;
+      st->usage |= use;
+      if (lambdas)
+        st->usage |= USE_CAPTURED;
+    }
+  else if (!memq_symbol (sym, st->frees))
+    st->frees = pair (interp, sym, st->frees);
+}
+
+static void
+scan_sequence (interp_t *interp, object_t *body, object_t *bound, int lambdas,
+               bool tail, scan_t *st)
+{
+  for (; body->type == OBJ_Pair; body = cdr (body))
+    scan (interp, car (body), bound, lambdas,
+          tail && cdr (body)->type != OBJ_Pair, st);
+}
+
+static void
+scan_body (interp_t *interp, object_t *body, object_t *bound, int lambdas,
+           bool tail, scan_t *st)
+{
+  scan_sequence (interp, expand_body (interp, body), bound, lambdas, tail, st);
+}
+
+/* A named `let' is a loop when its name is only ever called, with the right
+   number of arguments, in tail position of its own body and never escapes
+   into a closure.  Such loops compile to a backward jump.  */
+static bool
+is_loop (interp_t *interp, object_t *x)
+{
+  object_t *name = car (cdr (x));
+
+  intmax_t k = 0;
+  for (object_t *b = car (cdr (cdr (x))); b->type == OBJ_Pair; b = cdr (b))
+    k++;
+
+  scan_t st = { .target = name, .usage = 0, .arity = k, .frees = object_nil };
+  scan_body (interp, cdr (cdr (cdr (x))), object_nil, 0, true, &st);
+  return !(st.usage & ~USE_CALLED);
+}
+
+/* Walk X noting references and assignments of free variables.  With a
+   target symbol the walk accumulates its USE_* flags, TAIL telling whether
+   X is in tail position of the walked body; without one it collects every
+   free symbol, which is what closures need to capture.  */
+static void
+scan (interp_t *interp, object_t *x, object_t *bound, int lambdas, bool tail,
+      scan_t *st)
+{
+  if (x->type == OBJ_Symbol)
+    {
+      scan_note (interp, st, x, bound, lambdas, USE_REFERENCED);
+      return;
+    }
+
+  if (x->type != OBJ_Pair)
+    return;
+
+  object_t *head = car (x);
+  if (head->type == OBJ_Symbol && !memq_symbol (head, bound))
+    {
+      if (symbol_is (head, U"quote"))
+        return;
+
+      if (symbol_is (head, U"lambda"))
+        {
+          scan_body (interp, cdr (cdr (x)),
+                     bind_formals (interp, car (cdr (x)), bound), lambdas + 1,
+                     false, st);
+          return;
+        }
+
+      if (symbol_is (head, U"set!") || symbol_is (head, U"define"))
+        {
+          object_t *target = car (cdr (x));
+          if (target->type == OBJ_Pair)
+            {
+              scan_note (interp, st, car (target), bound, lambdas,
+                         USE_ASSIGNED);
+              scan_body (interp, cdr (cdr (x)),
+                         bind_formals (interp, cdr (target), bound),
+                         lambdas + 1, false, st);
+              return;
+            }
+          scan_note (interp, st, target, bound, lambdas, USE_ASSIGNED);
+          scan_sequence (interp, cdr (cdr (x)), bound, lambdas, false, st);
+          return;
+        }
+
+      if (symbol_is (head, U"if"))
+        {
+          scan (interp, car (cdr (x)), bound, lambdas, false, st);
+          for (object_t *b = cdr (cdr (x)); b->type == OBJ_Pair; b = cdr (b))
+            scan (interp, car (b), bound, lambdas, tail, st);
+          return;
+        }
+
+      if (symbol_is (head, U"begin"))
+        {
+          scan_sequence (interp, cdr (x), bound, lambdas, tail, st);
+          return;
+        }
+
+      if (symbol_is (head, U"let")
+          && (car (cdr (x))->type != OBJ_Symbol || is_loop (interp, x)))
+        {
+          object_t *bindings = car (cdr (x));
+          object_t *body = cdr (cdr (x));
+          object_t *inner = bound;
+          if (bindings->type == OBJ_Symbol)
+            {
+              inner = pair (interp, bindings, inner);
+              bindings = car (body);
+              body = cdr (body);
+            }
+          for (object_t *b = bindings; b->type == OBJ_Pair; b = cdr (b))
+            {
+              scan (interp, car (cdr (car (b))), bound, lambdas, false, st);
+              inner = pair (interp, car (car (b)), inner);
+            }
+          scan_body (interp, body, inner, lambdas, tail, st);
+          return;
+        }
+
+      object_t *expanded = expand_derived (interp, x);
+      if (expanded != x)
+        {
+          scan (interp, expanded, bound, lambdas, tail, st);
+          return;
+        }
+    }
+
+  if (head->type == OBJ_Symbol)
+    {
+      intmax_t argc = 0;
+      for (object_t *a = cdr (x); a->type == OBJ_Pair; a = cdr (a))
+        argc++;
+
+      unsigned use = USE_CALLED;
+      if (!tail)
+        use |= USE_NONTAIL;
+      if (st->arity >= 0 && argc != st->arity)
+        use |= USE_REFERENCED;
+      scan_note (interp, st, head, bound, lambdas, use);
+    }
+  else
+    scan (interp, head, bound, lambdas, false, st);
+
+  scan_sequence (interp, cdr (x), bound, lambdas, false, st);
+}
+
+static unsigned
+usage_of (interp_t *interp, object_t *sym, object_t *body)
+{
+  scan_t st = { .target = sym, .usage = 0, .arity = -1, .frees = object_nil };
+  scan_body (interp, body, object_nil, 0, true, &st);
+  return st.usage;
+}
+
+static inline bool
+needs_box (unsigned usage)
+{
+  return usage & USE_ASSIGNED;
+}
+
+static object_t *
+compile_refer (interp_t *interp, object_t *sym, scope_t *scope, bool deref,
+               object_t *next)
+{
+  binding_t *b = scope_lookup (scope, sym);
+  if (!b)
+    return insn (interp, OP_Refer, 2, sym, next);
+
+  if (b->boxed && deref)
+    next = insn (interp, OP_Indirect, 1, next);
+
+  return insn (interp, b->kind == BIND_Local ? OP_ReferLocal : OP_ReferFree,
+               2, fixnum (interp, b->index), next);
+}
+
+static object_t *
+compile_assign (interp_t *interp, object_t *x, scope_t *scope, size_t depth,
+                object_t *next)
+{
+  object_t *var = car (cdr (x));
+  object_t *value = cdr (cdr (x))->type == OBJ_Pair ? car (cdr (cdr (x)))
+                                                     : object_nil;
+
+  binding_t *b = scope_lookup (scope, var);
+  object_t *code;
+  if (!b)
+    code = insn (interp, OP_Assign, 2, var, next);
+  else if (b->kind == BIND_Free)
+    code = insn (interp, OP_AssignFree, 2, fixnum (interp, b->index), next);
+  else if (b->boxed)
+    code = insn (interp, OP_AssignIndirect, 2, fixnum (interp, b->index),
+                 next);
+  else
+    code = insn (interp, OP_AssignLocal, 2, fixnum (interp, b->index), next);
+
+  return compile (interp, value, scope, depth, code);
+}
+
+static object_t *
+compile_sequence (interp_t *interp, object_t *body, scope_t *scope,
+                  size_t depth, object_t *next)
+{
+  if (body->type != OBJ_Pair)
+    return insn (interp, OP_Constant, 2, object_nil, next);
+
+  if (cdr (body)->type != OBJ_Pair)
+    return compile (interp, car (body), scope, depth, next);
+
+  return compile (interp, car (body), scope, depth,
+                  compile_sequence (interp, cdr (body), scope, depth, next));
+}
+
+static object_t *
+compile_body (interp_t *interp, object_t *body, scope_t *scope, size_t depth,
+              object_t *next)
+{
+  return compile_sequence (interp, expand_body (interp, body), scope, depth,
+                           next);
+}
+
+/* `let' pushes its initial values into stack slots above the current depth
+   instead of allocating a closure and an environment; the body addresses
+   them relative to the frame pointer.  A named `let' that is a loop shares
+   the layout: its calls store new values into the same slots and jump back
+   to the head, so no closure or frame is allocated per iteration.  */
+static object_t *
+compile_let (interp_t *interp, object_t *x, scope_t *scope, size_t depth,
+             object_t *next)
+{
+  object_t *name = NULL;
+  object_t *bindings = car (cdr (x));
+  object_t *body = cdr (cdr (x));
+  if (bindings->type == OBJ_Symbol)
+    {
+      name = bindings;
+      bindings = car (body);
+      body = cdr (body);
+    }
+
+  size_t k = 0;
+  for (object_t *b = bindings; b->type == OBJ_Pair; b = cdr (b))
+    k++;
+
+  if (k == 0 && !name)
+    return compile_body (interp, body, scope, depth, next);
+
+  size_t nbind = name ? k + 1 : k;
+  binding_t *slots = calloc (nbind, sizeof (binding_t));
+  object_t **inits = calloc (nbind, sizeof (object_t *));
+
+  size_t i = 0;
+  for (object_t *b = bindings; b->type == OBJ_Pair; b = cdr (b), i++)
+    {
+      slots[i].name = car (car (b));
+      slots[i].kind = BIND_Local;
+      slots[i].index = depth + i;
+      slots[i].boxed = needs_box (usage_of (interp, slots[i].name, body));
+      inits[i] = car (cdr (car (b)));
+    }
+  if (name)
+    {
+      slots[k].name = name;
+      slots[k].kind = BIND_Loop;
+      slots[k].index = depth;
+      slots[k].arity = k;
+      slots[k].label = pair (interp, object_nil, object_nil);
+    }
+  for (i = 0; i + 1 < nbind; i++)
+    slots[i].next = &slots[i + 1];
+  slots[nbind - 1].next = scope->bindings;
+
+  scope_t inner = { .bindings = &slots[0], .nargs = scope->nargs };
+  object_t *code = compile_body (
+      interp, body, &inner, depth + k,
+      is_tail (next) ? next
+                     : insn (interp, OP_Pop, 2, fixnum (interp, k), next));
+
+  for (i = k; i > 0; i--)
+    if (slots[i - 1].boxed)
+      code = insn (interp, OP_Box, 2, fixnum (interp, slots[i - 1].index),
+                   code);
+
+  if (name)
+    slots[k].label->v_pair->first = code;
+
+  for (i = k; i > 0; i--)
+    code = compile (interp, inits[i - 1], scope, depth + i - 1,
+                    insn (interp, OP_Argument, 1, code));
+
+  free (inits);
+  free (slots);
+  return code;
+}
+
+/* A call to a loop evaluates the new values on top of the stack, moves them
+   into the loop's slots and jumps to the head.  */
+static object_t *
+compile_jump (interp_t *interp, binding_t *loop, object_t *args,
+              scope_t *scope, size_t depth)
+{
+  object_t *code = insn (interp, OP_Jump, 3, fixnum (interp, loop->arity),
+                         fixnum (interp, loop->index), loop->label);
+
+  object_t *rev = object_nil;
+  for (; args->type == OBJ_Pair; args = cdr (args))
+    rev = pair (interp, car (args), rev);
+
+  for (size_t i = loop->arity; rev->type == OBJ_Pair; rev = cdr (rev), i--)
+    code = compile (interp, car (rev), scope, depth + i - 1,
+                    insn (interp, OP_Argument, 1, code));
+
+  return code;
+}
+
+/* Closures are flat: they copy only the variables the body actually
+   references from the enclosing scope.  Captured variables that are also
+   assigned are shared through a box.  */
+static object_t *
+compile_lambda (interp_t *interp, object_t *formals, object_t *body,
+                scope_t *scope, size_t depth, object_t *next)
+{
+  size_t nparams = 0;
+  object_t *f;
+  for (f = formals; f->type == OBJ_Pair; f = cdr (f))
+    nparams++;
+  if (f->type == OBJ_Symbol)
+    nparams++;
+
+  scan_t st = { .target = NULL, .usage = 0, .arity = -1, .frees = object_nil };
+  scan_body (interp, body, bind_formals (interp, formals, object_nil), 0,
+             false, &st);
+
+  object_t *captured = object_nil;
+  size_t nfree = 0;
+  for (object_t *s = st.frees; s->type == OBJ_Pair; s = cdr (s))
+    if (scope_lookup (scope, car (s)))
+      {
+        captured = pair (interp, car (s), captured);
+        nfree++;
+      }
+
+  binding_t *binds = calloc (nparams + nfree + 1, sizeof (binding_t));
+  size_t i;
+  f = formals;
+  for (i = 0; i < nparams; i++)
+    {
+      object_t *name = f->type == OBJ_Pair ? car (f) : f;
+      binds[i].name = name;
+      binds[i].kind = BIND_Local;
+      binds[i].index = -(intmax_t)(i + 1);
+      binds[i].boxed = needs_box (usage_of (interp, name, body));
+      if (f->type == OBJ_Pair)
+        f = cdr (f);
+    }
+  for (object_t *s = captured; s->type == OBJ_Pair; s = cdr (s), i++)
+    {
+      binds[i].name = car (s);
+      binds[i].kind = BIND_Free;
+      binds[i].index = i - nparams;
+      binds[i].boxed = scope_lookup (scope, car (s))->boxed;
+    }
+  for (i = 0; i + 1 < nparams + nfree; i++)
+    binds[i].next = &binds[i + 1];
+
+  scope_t inner = { .bindings = nparams + nfree ? &binds[0] : NULL,
+                    .nargs = nparams };
+  object_t *code
+      = compile_body (interp, body, &inner, 0,
+                      insn (interp, OP_Return, 1, fixnum (interp, nparams)));
+
+  for (i = nparams; i > 0; i--)
+    if (binds[i - 1].boxed)
+      code = insn (interp, OP_Box, 2, fixnum (interp, binds[i - 1].index),
+                   code);
+
+  object_t *proto
+      = object_new_closure (formals, interp->toplevel, code, interp->heap);
+  code = insn (interp, OP_Close, 3, fixnum (interp, nfree), proto, next);
+
+  for (i = nparams + nfree; i > nparams; i--)
+    code = compile_refer (interp, binds[i - 1].name, scope, false,
+                          insn (interp, OP_Argument, 1, code));
+
+  free (binds);
+  return code;
+}
+
+/* Return the constant denoted by X, interning symbols, or NULL when X is
+   not a constant usable as a dispatch key.  */
+static object_t *
+dispatch_constant (interp_t *interp, object_t *x, bool quoted)
+{
+  if (!quoted)
+    {
+      if (x->type == OBJ_Pair && symbol_is (car (x), U"quote")
+          && cdr (x)->type == OBJ_Pair)
+        return dispatch_constant (interp, car (cdr (x)), true);
+      if (x->type == OBJ_Symbol || x->type == OBJ_Pair)
+        return NULL;
+    }
+
+  if (!dispatch_keyable (x))
+    return NULL;
+
+  if (x->type == OBJ_Symbol)
+    return object_intern_symbol (x->v_symbol->id, u32strlen (x->v_symbol->id),
+                                 interp->heap);
+  return x;
+}
+
+/* `case' with enough datums, all of them symbols, fixnums, characters,
+   booleans or the empty list, becomes a single OP_Dispatch on the key
+   instead of a chain of `eqv?' calls.  Returns NULL when not applicable.  */
+static object_t *
+compile_case (interp_t *interp, object_t *x, scope_t *scope, size_t depth,
+              object_t *next)
+{
+  size_t n = 0;
+  for (object_t *c = cdr (cdr (x)); c->type == OBJ_Pair; c = cdr (c))
+    {
+      object_t *datums = car (car (c));
+      object_t *body = cdr (car (c));
+      if (body->type == OBJ_Pair && symbol_is (car (body), U"=>"))
+        return NULL;
+      if (symbol_is (datums, U"else"))
+        break;
+      for (; datums->type == OBJ_Pair; datums = cdr (datums), n++)
+        if (!dispatch_keyable (car (datums)))
+          return NULL;
+    }
+
+  if (n < DISPATCH_MIN_KEYS)
+    return NULL;
+
+  object_t **keys = calloc (n, sizeof (object_t *));
+  object_t **codes = calloc (n, sizeof (object_t *));
+  object_t *otherwise = NULL;
+
+  size_t i = 0;
+  for (object_t *c = cdr (cdr (x)); c->type == OBJ_Pair; c = cdr (c))
+    {
+      object_t *datums = car (car (c));
+      object_t *code
+          = compile_sequence (interp, cdr (car (c)), scope, depth, next);
+      if (symbol_is (datums, U"else"))
+        {
+          otherwise = code;
+          break;
+        }
+      for (; datums->type == OBJ_Pair; datums = cdr (datums), i++)
+        {
+          keys[i] = dispatch_constant (interp, car (datums), true);
+          codes[i] = code;
+        }
+    }
+
+  object_t *table = object_new_dispatch (keys, codes, n, interp->heap);
+  free (keys);
+  free (codes);
+
+  if (!otherwise)
+    otherwise = insn (interp, OP_Constant, 2, object_nil, next);
+
+  return compile (interp, car (cdr (x)), scope, depth,
+                  insn (interp, OP_Dispatch, 2, table, otherwise));
+}
+
+/* A `cond' whose clauses all test one variable with `eq?' or `eqv?'
+   against a constant compiles like `case'.  Returns NULL when not
+   applicable.  */
+static object_t *
+compile_cond (interp_t *interp, object_t *x, scope_t *scope, size_t depth,
+              object_t *next)
+{
+  object_t *var = NULL;
+  size_t n = 0;
+  for (object_t *c = cdr (x); c->type == OBJ_Pair; c = cdr (c), n++)
+    {
+      object_t *test = car (car (c));
+      object_t *body = cdr (car (c));
+      if (symbol_is (test, U"else"))
+        break;
+      if (body->type != OBJ_Pair || symbol_is (car (body), U"=>"))
+        return NULL;
+      if (test->type != OBJ_Pair
+          || !(symbol_is (car (test), U"eq?") || symbol_is (car (test), U"eqv?"))
+          || scope_lookup (scope, car (test)) || cdr (test)->type != OBJ_Pair
+          || cdr (cdr (test))->type != OBJ_Pair
+          || cdr (cdr (cdr (test)))->type == OBJ_Pair)
+        return NULL;
+
+      object_t *lhs = car (cdr (test));
+      object_t *rhs = car (cdr (cdr (test)));
+      object_t *operand = lhs->type == OBJ_Symbol ? lhs : rhs;
+      object_t *constant = operand == lhs ? rhs : lhs;
+      if (operand->type != OBJ_Symbol
+          || !dispatch_constant (interp, constant, false))
+        return NULL;
+      if (var && !symbols_equal (var, operand))
+        return NULL;
+      var = operand;
+    }
+
+  if (n < DISPATCH_MIN_KEYS)
+    return NULL;
+
+  object_t **keys = calloc (n, sizeof (object_t *));
+  object_t **codes = calloc (n, sizeof (object_t *));
+  object_t *otherwise = NULL;
+
+  size_t i = 0;
+  for (object_t *c = cdr (x); c->type == OBJ_Pair; c = cdr (c), i++)
+    {
+      object_t *test = car (car (c));
+      object_t *code
+          = compile_sequence (interp, cdr (car (c)), scope, depth, next);
+      if (symbol_is (test, U"else"))
+        {
+          otherwise = code;
+          break;
+        }
+
+      object_t *lhs = car (cdr (test));
+      object_t *constant = lhs->type == OBJ_Symbol ? car (cdr (cdr (test)))
+                                                   : lhs;
+      keys[i] = dispatch_constant (interp, constant, false);
+      codes[i] = code;
+    }
+
+  object_t *table = object_new_dispatch (keys, codes, n, interp->heap);
+  free (keys);
+  free (codes);
+
+  if (!otherwise)
+    otherwise = insn (interp, OP_Constant, 2, object_nil, next);
+
+  return compile_refer (interp, var, scope, true,
+                        insn (interp, OP_Dispatch, 2, table, otherwise));
+}
+
+/* The receiver is evaluated first; `conti' then seals the stack below the
+   return frame and pushes the continuation as the receiver's only argument
+   on the fresh segment.  In tail position the current frame's arguments lie
+   above the split and are dropped, so no shift is needed.  A delimited
+   capture also unwinds the stack to the innermost prompt.  */
+static object_t *
+compile_conti (interp_t *interp, object_t *x, scope_t *scope, size_t depth,
+               int kind, object_t *next)
+{
+  bool tail = is_tail (next);
+  object_t *code = insn (interp, OP_Conti, 3,
+                         tail ? operand (next, 0) : fixnum (interp, -1),
+                         fixnum (interp, kind),
+                         insn (interp, OP_Apply, 1, fixnum (interp, 1)));
+
+  code = compile (interp, car (cdr (x)), scope, tail ? depth : depth + 3,
+                  code);
+  return tail ? code : insn (interp, OP_Frame, 2, next, code);
+}
+
+/* `reset' calls its body thunk in a frame of its own, sealing the stack
+   just above that frame so the segment's top marks the prompt.  */
+static object_t *
+compile_prompt (interp_t *interp, object_t *x, scope_t *scope, size_t depth,
+                object_t *next)
+{
+  object_t *code = insn (interp, OP_Prompt, 1,
+                         insn (interp, OP_Apply, 1, fixnum (interp, 0)));
+  code = compile (interp, car (cdr (x)), scope, depth + 3, code);
+  return insn (interp, OP_Frame, 2, next, code);
+}
+
+/* Fiber and parallel primitives push their arguments, first one on top,
+   and leave it to the instruction OP to pop them; a fiber operation that
+   must block parks the fiber with NEXT as its return point.  */
+static object_t *
+compile_primitive (interp_t *interp, object_t *x, scope_t *scope,
+                   size_t depth, opcode_t op, int kind, size_t min_args,
+                   size_t max_args, object_t *next)
+{
+  size_t argc = 0;
+  for (object_t *a = cdr (x); a->type == OBJ_Pair; a = cdr (a))
+    argc++;
+  if (argc < min_args || argc > max_args)
+    raise_runtime_error ("Wrong number of arguments");
+
+  object_t *code = insn (interp, op, 3, fixnum (interp, kind),
+                        fixnum (interp, argc), next);
+  size_t i = 0;
+  for (object_t *a = cdr (x); a->type == OBJ_Pair; a = cdr (a), i++)
+    code = compile (interp, car (a), scope, depth + argc - 1 - i,
+                    insn (interp, OP_Argument, 1, code));
+  return code;
+}
+
+/* The FL_ kind of arithmetic X applies if it calls a flonum operator that
+   is not shadowed, or -1.  */
+static int
+flonum_arith (object_t *x, scope_t *scope)
+{
+  object_t *head = car (x);
+  if (head->type != OBJ_Symbol || scope_lookup (scope, head))
+    return -1;
+  if (symbol_is (head, U"fl+"))
+    return FL_Add;
+  if (symbol_is (head, U"fl-"))
+    return FL_Sub;
+  if (symbol_is (head, U"fl*"))
+    return FL_Mul;
+  if (symbol_is (head, U"fl/"))
+    return FL_Div;
+  return -1;
+}
+
+static int
+flonum_compare (object_t *x, scope_t *scope)
+{
+  object_t *head = car (x);
+  if (head->type != OBJ_Symbol || scope_lookup (scope, head))
+    return -1;
+  if (symbol_is (head, U"fl="))
+    return FL_Equal;
+  if (symbol_is (head, U"fl<"))
+    return FL_Less;
+  if (symbol_is (head, U"fl>"))
+    return FL_Greater;
+  if (symbol_is (head, U"fl<="))
+    return FL_LessEqual;
+  if (symbol_is (head, U"fl>="))
+    return FL_GreaterEqual;
+  return -1;
+}
+
+/* The operand of a call to `exact->inexact', or NULL.  */
+static object_t *
+flonum_conversion (object_t *x, scope_t *scope)
+{
+  object_t *head = car (x);
+  if (head->type != OBJ_Symbol || scope_lookup (scope, head)
+      || !(symbol_is (head, U"exact->inexact") || symbol_is (head, U"inexact"))
+      || cdr (x)->type != OBJ_Pair || cdr (cdr (x))->type != OBJ_Nil)
+    return NULL;
+  return car (cdr (x));
+}
+
+static inline bool
+is_number_literal (object_t *x)
+{
+  return x->type == OBJ_Integer || x->type == OBJ_Bignum
+         || x->type == OBJ_Real;
+}
+
+/* A `let' or `let*' with one body expression and no name, or NULL; the
+   result tells which.  */
+static const char32_t *
+flonum_let_form (object_t *x, scope_t *scope)
+{
+  object_t *head = car (x);
+  if (head->type != OBJ_Symbol || scope_lookup (scope, head)
+      || cdr (x)->type != OBJ_Pair)
+    return NULL;
+
+  object_t *bindings = car (cdr (x));
+  object_t *body = cdr (cdr (x));
+  if ((bindings->type != OBJ_Pair && bindings->type != OBJ_Nil)
+      || body->type != OBJ_Pair || cdr (body)->type != OBJ_Nil)
+    return NULL;
+  for (object_t *b = bindings; b->type == OBJ_Pair; b = cdr (b))
+    if (car (b)->type != OBJ_Pair || car (car (b))->type != OBJ_Symbol
+        || cdr (car (b))->type != OBJ_Pair)
+      return NULL;
+
+  if (symbol_is (head, U"let"))
+    return U"let";
+  if (symbol_is (head, U"let*"))
+    return U"let*";
+  return NULL;
+}
+
+/* Bind the variables of the `let' form X to float registers from REG up,
+   in SLOTS with room for all of them, and return the scope of its body.
+   The scope its Ith initial value is compiled in is stored in INITS[I].  */
+static scope_t
+flonum_let_scope (object_t *x, scope_t *scope, size_t reg, binding_t *slots,
+                  scope_t *inits)
+{
+  bool sequential = u32streq (flonum_let_form (x, scope), U"let*");
+  scope_t inner = *scope;
+  size_t i = 0;
+  for (object_t *b = car (cdr (x)); b->type == OBJ_Pair; b = cdr (b), i++)
+    {
+      if (inits)
+        inits[i] = sequential ? inner : *scope;
+      slots[i].name = car (car (b));
+      slots[i].kind = BIND_Flonum;
+      slots[i].index = reg + i;
+      slots[i].next = inner.bindings;
+      inner.bindings = &slots[i];
+    }
+  return inner;
+}
+
+static size_t
+list_count (object_t *lst)
+{
+  size_t n = 0;
+  for (; lst->type == OBJ_Pair; lst = cdr (lst))
+    n++;
+  return n;
+}
+
+static bool flonum_pure (object_t *x, scope_t *scope);
+
+/* A `let' is kept in float registers when its initial values and body are
+   pure flonum expressions.  Nothing in it is hoisted, so its variables
+   cannot escape and its effects stay in order.  */
+static bool
+flonum_let (object_t *x, scope_t *scope)
+{
+  if (!flonum_let_form (x, scope))
+    return false;
+
+  size_t k = list_count (car (cdr (x)));
+  binding_t *slots = calloc (k + 1, sizeof (binding_t));
+  scope_t *inits = calloc (k + 1, sizeof (scope_t));
+  scope_t inner = flonum_let_scope (x, scope, 0, slots, inits);
+
+  bool pure = flonum_pure (car (cdr (cdr (x))), &inner);
+  size_t i = 0;
+  for (object_t *b = car (cdr (x)); pure && b->type == OBJ_Pair;
+       b = cdr (b), i++)
+    pure = flonum_pure (car (cdr (car (b))), &inits[i]);
+
+  free (inits);
+  free (slots);
+  return pure;
+}
+
+/* Whether X is an operand a flonum operator or conversion can load
+   without hoisting it: any variable, whose value is checked as it is
+   unboxed, or a pure flonum expression.  */
+static bool
+flonum_operand (object_t *x, scope_t *scope)
+{
+  return x->type == OBJ_Symbol || flonum_pure (x, scope);
+}
+
+/* Whether X is known to compute a flonum in the float registers without
+   hoisting anything: flonum literals, variables bound in float registers,
+   flonum arithmetic and conversions of operands as above, and `let's of
+   these.  Any other variable may hold something else, which the generic
+   code must pass through untouched.  */
+static bool
+flonum_pure (object_t *x, scope_t *scope)
+{
+  if (x->type == OBJ_Real)
+    return true;
+  if (x->type == OBJ_Symbol)
+    {
+      binding_t *b = scope_lookup (scope, x);
+      return b && b->kind == BIND_Flonum;
+    }
+  if (x->type != OBJ_Pair)
+    return false;
+
+  if (flonum_arith (x, scope) >= 0)
+    {
+      for (object_t *a = cdr (x); a->type == OBJ_Pair; a = cdr (a))
+        if (!flonum_operand (car (a), scope))
+          return false;
+      return true;
+    }
+
+  object_t *e = flonum_conversion (x, scope);
+  if (e)
+    return is_number_literal (e) || flonum_operand (e, scope);
+
+  return flonum_let (x, scope);
+}
+
+/* Whether X is known to be a flonum, so converting it is a no-op.  */
+static bool
+flonum_typed (object_t *x, scope_t *scope)
+{
+  if (x->type == OBJ_Real)
+    return true;
+  if (x->type == OBJ_Symbol)
+    {
+      binding_t *b = scope_lookup (scope, x);
+      return b && b->kind == BIND_Flonum;
+    }
+  return x->type == OBJ_Pair
+         && (flonum_arith (x, scope) >= 0 || flonum_conversion (x, scope)
+             || flonum_let (x, scope));
+}
+
+/* The number of float registers compile_flonum uses for X from its target
+   up.  Arithmetic keeps its running result in the target and each further
+   operand in the next register; a `let' holds its variables in the target
+   and those above it and computes its body above them.  */
+static size_t
+flonum_need (object_t *x, scope_t *scope)
+{
+  if (x->type != OBJ_Pair)
+    return 1;
+
+  int kind = flonum_arith (x, scope);
+  if (kind >= 0)
+    {
+      object_t *args = cdr (x);
+      if (args->type != OBJ_Pair)
+        return 1;
+      size_t need = flonum_need (car (args), scope);
+      if (cdr (args)->type != OBJ_Pair)
+        return kind == FL_Sub || kind == FL_Div ? need + 1 : need;
+      for (object_t *a = cdr (args); a->type == OBJ_Pair; a = cdr (a))
+        {
+          size_t n = 1 + flonum_need (car (a), scope);
+          if (n > need)
+            need = n;
+        }
+      return need;
+    }
+
+  object_t *e = flonum_conversion (x, scope);
+  if (e)
+    return flonum_typed (e, scope) ? flonum_need (e, scope) : 1;
+
+  if (!flonum_let (x, scope))
+    return 1;
+
+  size_t k = list_count (car (cdr (x)));
+  binding_t *slots = calloc (k + 1, sizeof (binding_t));
+  scope_t *inits = calloc (k + 1, sizeof (scope_t));
+  scope_t inner = flonum_let_scope (x, scope, 0, slots, inits);
+
+  size_t need = k + flonum_need (car (cdr (cdr (x))), &inner);
+  size_t i = 0;
+  for (object_t *b = car (cdr (x)); b->type == OBJ_Pair; b = cdr (b), i++)
+    {
+      size_t n = i + flonum_need (car (cdr (car (b))), &inits[i]);
+      if (n > need)
+        need = n;
+    }
+
+  free (inits);
+  free (slots);
+  return need;
+}
+
+/* Load the value of X into float register REG, converting it from any
+   real number if CONVERT.  Anything but a variable is hoisted.  */
+static object_t *
+compile_flonum_load (interp_t *interp, object_t *x, scope_t *scope,
+                     size_t depth, hoist_t *h, size_t reg, bool convert,
+                     object_t *next)
+{
+  object_t *r = fixnum (interp, reg);
+  object_t *conv = convert ? object_true : object_false;
+  if (x->type == OBJ_Symbol)
+    {
+      binding_t *b = scope_lookup (scope, x);
+      if (b && b->kind == BIND_Flonum)
+        return (size_t)b->index == reg
+                   ? next
+                   : insn (interp, OP_FlMove, 3, r,
+                           fixnum (interp, b->index), next);
+      if (b && b->kind == BIND_Local && !b->boxed)
+        return insn (interp, OP_FlLoad, 4, r, fixnum (interp, b->index),
+                     conv, next);
+      return compile_refer (interp, x, scope, true,
+                            insn (interp, OP_FlUnbox, 3, r, conv, next));
+    }
+
+  size_t slot = depth + h->count++;
+  h->leaves = pair (interp, x, h->leaves);
+  return insn (interp, OP_FlLoad, 4, r, fixnum (interp, slot), conv, next);
+}
+
+static object_t *compile_flonum (interp_t *interp, object_t *x,
+                                 scope_t *scope, size_t depth, hoist_t *h,
+                                 size_t reg, object_t *next);
+
+/* Fold the operands of X into register REG, each further one computed in
+   the register above it.  A lone operand of `fl-' and `fl/' is applied to
+   the identity, which for subtraction is -0.0 so that it negates zeros.  */
+static object_t *
+compile_flonum_arith (interp_t *interp, object_t *x, scope_t *scope,
+                      size_t depth, hoist_t *h, size_t reg, int kind,
+                      object_t *next)
+{
+  object_t *r = fixnum (interp, reg);
+  object_t *args = cdr (x);
+  size_t argc = list_count (args);
+  if (argc == 0 && (kind == FL_Sub || kind == FL_Div))
+    raise_runtime_error ("Wrong number of arguments");
+
+  double identity = kind == FL_Add ? 0.0 : kind == FL_Sub ? -0.0 : 1.0;
+  if (argc == 0)
+    return insn (interp, OP_FlConstant, 3, r,
+                 object_new_real (identity, interp->heap), next);
+  if (argc == 1 && (kind == FL_Add || kind == FL_Mul))
+    return compile_flonum (interp, car (args), scope, depth, h, reg, next);
+  if (argc == 1)
+    {
+      object_t *code = insn (interp, OP_FlArith, 3, fixnum (interp, kind), r,
+                             next);
+      code = compile_flonum (interp, car (args), scope, depth, h, reg + 1,
+                             code);
+      return insn (interp, OP_FlConstant, 3, r,
+                   object_new_real (identity, interp->heap), code);
+    }
+
+  object_t *rev = object_nil;
+  for (object_t *a = cdr (args); a->type == OBJ_Pair; a = cdr (a))
+    rev = pair (interp, car (a), rev);
+
+  object_t *code = next;
+  for (; rev->type == OBJ_Pair; rev = cdr (rev))
+    {
+      code = insn (interp, OP_FlArith, 3, fixnum (interp, kind), r, code);
+      code = compile_flonum (interp, car (rev), scope, depth, h, reg + 1,
+                             code);
+    }
+  return compile_flonum (interp, car (args), scope, depth, h, reg, code);
+}
+
+/* Bind the variables of a pure `let' to the registers from REG up and
+   compute its body above them, then move the result down to REG.  */
+static object_t *
+compile_flonum_let (interp_t *interp, object_t *x, scope_t *scope,
+                    size_t depth, hoist_t *h, size_t reg, object_t *next)
+{
+  size_t k = list_count (car (cdr (x)));
+  binding_t *slots = calloc (k + 1, sizeof (binding_t));
+  scope_t *inits = calloc (k + 1, sizeof (scope_t));
+  scope_t inner = flonum_let_scope (x, scope, reg, slots, inits);
+
+  object_t *code = next;
+  if (k)
+    code = insn (interp, OP_FlMove, 3, fixnum (interp, reg),
+                 fixnum (interp, reg + k), code);
+  code = compile_flonum (interp, car (cdr (cdr (x))), &inner, depth, h,
+                         reg + k, code);
+
+  object_t *rev = object_nil;
+  for (object_t *b = car (cdr (x)); b->type == OBJ_Pair; b = cdr (b))
+    rev = pair (interp, car (cdr (car (b))), rev);
+  for (size_t i = k; rev->type == OBJ_Pair; rev = cdr (rev), i--)
+    code = compile_flonum (interp, car (rev), &inits[i - 1], depth, h,
+                           reg + i - 1, code);
+
+  free (inits);
+  free (slots);
+  return code;
+}
+
+/* Compile X to leave its value unboxed in float register REG.  Subtrees
+   that are not flonum expressions, or that would run out of registers, are
+   hoisted and read back from the stack, so the code makes no calls and the
+   registers stay live until it is done.  */
+static object_t *
+compile_flonum (interp_t *interp, object_t *x, scope_t *scope, size_t depth,
+                hoist_t *h, size_t reg, object_t *next)
+{
+  if (x->type == OBJ_Real)
+    return insn (interp, OP_FlConstant, 3, fixnum (interp, reg), x, next);
+  if (x->type != OBJ_Pair)
+    return compile_flonum_load (interp, x, scope, depth, h, reg, false, next);
+
+  int kind = flonum_arith (x, scope);
+  if (kind >= 0
+      && (reg == 0 || reg + flonum_need (x, scope) <= FLONUM_REGISTERS))
+    return compile_flonum_arith (interp, x, scope, depth, h, reg, kind, next);
+
+  object_t *e = flonum_conversion (x, scope);
+  if (e)
+    {
+      if (e->type == OBJ_Integer)
+        e = object_new_real (e->v_integer, interp->heap);
+      else if (e->type == OBJ_Bignum)
+        e = object_new_real (bignum_to_double (e->v_bignum), interp->heap);
+      if (flonum_typed (e, scope))
+        return compile_flonum (interp, e, scope, depth, h, reg, next);
+      return compile_flonum_load (interp, e, scope, depth, h, reg, true, next);
+    }
+
+  if (flonum_let (x, scope)
+      && reg + flonum_need (x, scope) <= FLONUM_REGISTERS)
+    return compile_flonum_let (interp, x, scope, depth, h, reg, next);
+
+  return compile_flonum_load (interp, x, scope, depth, h, reg, false, next);
+}
+
+/* Evaluate the operands hoisted out of a flonum expression, pushing them
+   above DEPTH for CODE to read, and drop them again before NEXT, the
+   instruction CODE continues with through the cell TAIL.  */
+static object_t *
+compile_hoisted (interp_t *interp, hoist_t *h, scope_t *scope, size_t depth,
+                 object_t *tail, object_t *code, object_t *next)
+{
+  if (h->count && !is_tail (next))
+    tail->v_pair->first = insn (interp, OP_Pop, 2, fixnum (interp, h->count),
+                                next);
+
+  size_t i = h->count;
+  for (object_t *l = h->leaves; l->type == OBJ_Pair; l = cdr (l), i--)
+    code = compile (interp, car (l), scope, depth + i - 1,
+                    insn (interp, OP_Argument, 1, code));
+  return code;
+}
+
+/* Flonum arithmetic, conversions and pure `let's compute in the float
+   registers and box only the final result.  Intermediate values never
+   reach the heap.  */
+static object_t *
+compile_flonum_root (interp_t *interp, object_t *x, scope_t *scope,
+                     size_t depth, object_t *next)
+{
+  hoist_t h = { .leaves = object_nil, .count = 0 };
+  object_t *box = insn (interp, OP_FlBox, 2, fixnum (interp, 0), next);
+  object_t *code = compile_flonum (interp, x, scope, depth, &h, 0, box);
+  return compile_hoisted (interp, &h, scope, depth, cdr (cdr (box)), code,
+                          next);
+}
+
+/* Comparisons load each operand into a register of its own and test them
+   pairwise, leaving a boolean without boxing anything.  */
+static object_t *
+compile_flonum_compare (interp_t *interp, object_t *x, scope_t *scope,
+                        size_t depth, int kind, object_t *next)
+{
+  size_t argc = list_count (cdr (x));
+  if (argc == 0)
+    raise_runtime_error ("Wrong number of arguments");
+
+  hoist_t h = { .leaves = object_nil, .count = 0 };
+  object_t *test = insn (interp, OP_FlCompare, 4, fixnum (interp, kind),
+                         fixnum (interp, 0), fixnum (interp, argc), next);
+
+  object_t *rev = object_nil;
+  for (object_t *a = cdr (x); a->type == OBJ_Pair; a = cdr (a))
+    rev = pair (interp, car (a), rev);
+
+  object_t *code = test;
+  for (size_t i = argc; rev->type == OBJ_Pair; rev = cdr (rev), i--)
+    code = compile_flonum (interp, car (rev), scope, depth, &h, i - 1, code);
+
+  return compile_hoisted (interp, &h, scope, depth,
+                          cdr (cdr (cdr (cdr (test)))), code, next);
+}
+
+static object_t *
+compile_application (interp_t *interp, object_t *x, scope_t *scope,
+                     size_t depth, object_t *next)
+{
+  object_t *fn = car (x);
+  object_t *args = cdr (x);
+
+  if (fn->type == OBJ_Symbol)
+    {
+      binding_t *b = scope_lookup (scope, fn);
+      if (b && b->kind == BIND_Loop)
+        return compile_jump (interp, b, args, scope, depth);
+    }
+
+  size_t argc = 0;
+  for (object_t *a = args; a->type == OBJ_Pair; a = cdr (a))
+    argc++;
+
+  if (fn->type == OBJ_Pair && symbol_is (car (fn), U"lambda")
+      && !scope_lookup (scope, car (fn)))
+    {
+      object_t *bindings = object_nil;
+      object_t *f = car (cdr (fn));
+      object_t *a = args;
+      for (; f->type == OBJ_Pair && a->type == OBJ_Pair;
+           f = cdr (f), a = cdr (a))
+        bindings = pair (interp, create_list (interp->heap, 2, car (f), car (a)),
+                         bindings);
+
+      if (f->type == OBJ_Nil && a->type != OBJ_Pair)
+        return compile_let (
+            interp,
+            pair (interp, symbol (interp, U"let"),
+                  pair (interp, list_nreverse (bindings), cdr (cdr (fn)))),
+            scope, depth, next);
+    }
+
+  bool tail = is_tail (next);
+  size_t base = tail ? depth : depth + 3;
+
+  object_t *code = insn (interp, OP_Apply, 1, fixnum (interp, argc));
+  if (tail)
+    code = insn (interp, OP_Shift, 3, fixnum (interp, argc), operand (next, 0),
+                 code);
+
+  code = compile (interp, fn, scope, base + argc, code);
+
+  size_t i = 0;
+  for (object_t *a = args; a->type == OBJ_Pair; a = cdr (a), i++)
+    code = compile (interp, car (a), scope, base + argc - 1 - i,
+                    insn (interp, OP_Argument, 1, code));
+
+  return tail ? code : insn (interp, OP_Frame, 2, next, code);
+}
+
+static object_t *
+compile (interp_t *interp, object_t *x, scope_t *scope, size_t depth,
+         object_t *next)
+{
+  if (x->type == OBJ_Symbol)
+    return compile_refer (interp, x, scope, true, next);
+
+  if (x->type != OBJ_Pair)
+    return insn (interp, OP_Constant, 2, x, next);
+
+  object_t *head = car (x);
+  if (head->type == OBJ_Symbol && !scope_lookup (scope, head))
+    {
+      if (symbol_is (head, U"quote"))
+        return insn (interp, OP_Constant, 2, car (cdr (x)), next);
+
+      if (symbol_is (head, U"lambda"))
+        return compile_lambda (interp, car (cdr (x)), cdr (cdr (x)), scope,
+                               depth, next);
+
+      if (symbol_is (head, U"if"))
+        {
+          object_t *alt = cdr (cdr (cdr (x)));
+          object_t *then_c
+              = compile (interp, car (cdr (cdr (x))), scope, depth, next);
+          object_t *else_c
+              = alt->type == OBJ_Pair
+                    ? compile (interp, car (alt), scope, depth, next)
+                    : insn (interp, OP_Constant, 2, object_nil, next);
+          return compile (interp, car (cdr (x)), scope, depth,
+                          insn (interp, OP_Test, 2, then_c, else_c));
+        }
+
+      if (symbol_is (head, U"set!"))
+        return compile_assign (interp, x, scope, depth, next);
+
+      if (symbol_is (head, U"define"))
+        {
+          object_t *target = car (cdr (x));
+          object_t *value;
+          if (target->type == OBJ_Pair)
+            {
+              value = pair (interp, symbol (interp, U"lambda"),
+                            pair (interp, cdr (target), cdr (cdr (x))));
+              target = car (target);
+            }
+          else
+            value = cdr (cdr (x))->type == OBJ_Pair ? car (cdr (cdr (x)))
+                                                     : object_nil;
+
+          return compile (interp, value, scope, depth,
+                          insn (interp, OP_Assign, 2, target, next));
+        }
+
+      if (symbol_is (head, U"begin"))
+        return compile_sequence (interp, cdr (x), scope, depth, next);
+
+      if (flonum_arith (x, scope) >= 0 || flonum_conversion (x, scope))
+        return compile_flonum_root (interp, x, scope, depth, next);
+
+      int kind = flonum_compare (x, scope);
+      if (kind >= 0 && list_count (cdr (x)) <= FLONUM_REGISTERS)
+        return compile_flonum_compare (interp, x, scope, depth, kind, next);
+
+      if (flonum_let (x, scope)
+          && flonum_need (x, scope) <= FLONUM_REGISTERS)
+        return compile_flonum_root (interp, x, scope, depth, next);
+
+      if (symbol_is (head, U"let")
+          && (car (cdr (x))->type != OBJ_Symbol || is_loop (interp, x)))
+        return compile_let (interp, x, scope, depth, next);
+
+      if (symbol_is (head, U"call/cc")
+          || symbol_is (head, U"call-with-current-continuation"))
+        return compile_conti (interp, x, scope, depth, CONTI_FULL, next);
+
+      if (symbol_is (head, U"call/1cc"))
+        return compile_conti (interp, x, scope, depth, CONTI_ONESHOT, next);
+
+      if (symbol_is (head, U" reset"))
+        return compile_prompt (interp, x, scope, depth, next);
+
+      if (symbol_is (head, U" shift"))
+        return compile_conti (interp, x, scope, depth, CONTI_DELIMITED, next);
+
+      if (symbol_is (head, U"spawn"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_Spawn, 1, 1, next);
+      if (symbol_is (head, U"yield"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_Yield, 0, 0, next);
+      if (symbol_is (head, U"sleep"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_Sleep, 1, 1, next);
+      if (symbol_is (head, U"make-channel"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_Channel, 0, 1, next);
+      if (symbol_is (head, U"channel-send"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_Send, 2, 2, next);
+      if (symbol_is (head, U"channel-recv"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_Recv, 1, 1, next);
+      if (symbol_is (head, U"read-bytevector"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_Read, 2, 2, next);
+      if (symbol_is (head, U"write-bytevector"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_Write, 2, 2, next);
+
+      if (symbol_is (head, U"isolate-spawn"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_IsolateSpawn, 1, 1, next);
+      if (symbol_is (head, U"isolate-send"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_IsolateSend, 2, 2, next);
+      if (symbol_is (head, U"isolate-receive"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_IsolateRecv, 0, 0, next);
+      if (symbol_is (head, U"isolate-join"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_IsolateJoin, 1, 1, next);
+      if (symbol_is (head, U"isolate-parent"))
+        return compile_primitive (interp, x, scope, depth, OP_Fiber,
+                                  FIBER_IsolateParent, 0, 0, next);
+
+      if (symbol_is (head, U"future"))
+        return compile_primitive (interp, x, scope, depth, OP_Parallel,
+                                  PAR_Future, 1, 1, next);
+      if (symbol_is (head, U"touch"))
+        return compile_primitive (interp, x, scope, depth, OP_Parallel,
+                                  PAR_Touch, 1, 1, next);
+      if (symbol_is (head, U"parallel-map"))
+        return compile_primitive (interp, x, scope, depth, OP_Parallel,
+                                  PAR_Map, 2, 2, next);
+      if (symbol_is (head, U"parallel-for-each"))
+        return compile_primitive (interp, x, scope, depth, OP_Parallel,
+                                  PAR_ForEach, 2, 2, next);
+      if (symbol_is (head, U"parallel-reduce"))
+        return compile_primitive (interp, x, scope, depth, OP_Parallel,
+                                  PAR_Reduce, 3, 3, next);
+
+      if (symbol_is (head, U"f64vector-map!"))
+        return compile_primitive (interp, x, scope, depth, OP_Bulk,
+                                  BULK_F64Map, 2, 2, next);
+
+      if (symbol_is (head, U"case"))
+        {
+          object_t *code = compile_case (interp, x, scope, depth, next);
+          if (code)
+            return code;
+        }
+
+      if (symbol_is (head, U"cond"))
+        {
+          object_t *code = compile_cond (interp, x, scope, depth, next);
+          if (code)
+            return code;
+        }
+
+      object_t *expanded = expand_derived (interp, x);
+      if (expanded != x)
+        return compile (interp, expanded, scope, depth, next);
+    }
+
+  return compile_application (interp, x, scope, depth, next);
+}
+
+object_t *
+eval_compile (interp_t *interp, object_t *expr)
+{
+  scope_t toplevel = { .bindings = NULL, .nargs = 0 };
+  return compile (interp, expr, &toplevel, 0, insn (interp, OP_Halt, 0));
+}
+
+static void vm_underflow (stack_t *stk);
+
+static inline object_t *
+vm_pop_frame (stack_t *stk, size_t *f, object_t **c)
+{
+  if (stk->count < 3)
+    vm_underflow (stk);
+
+  object_t *x = stk->objs[stk->count - 1];
+  *f = STACK_INDEX_VALUE (stk->objs[stk->count - 2]);
+  *c = stk->objs[stk->count - 3];
+  stk->count -= 3;
+  return x;
+}
+
+/* Number of argument slots below the frame pointer of an activation of C;
+   the toplevel has none.  */
+static inline size_t
+frame_nargs (object_t *c)
+{
+  return c ? c->v_closure->arity + c->v_closure->variadic : 0;
+}
+
+/* Make SEG the live segment of STK without copying.  Only one-shot
+   segments are adopted; SEG is left empty so a second use is caught.  */
+static void
+vm_adopt (stack_t *stk, stack_t *seg)
+{
+  if (!seg->objs)
+    raise_runtime_error ("One-shot continuation already resumed");
+
+  free (stk->objs);
+  stk->objs = seg->objs;
+  stk->size = seg->size;
+  stk->count = seg->count;
+  stk->base = seg->base;
+  stk->link = seg->link;
+  seg->objs = NULL;
+  seg->count = 0;
+}
+
+/* A multi-shot capture may resume the segments below it any number of
+   times, so none of them can be adopted any more.  Segments captured before
+   the last multi-shot capture were already promoted by it.  */
+static void
+vm_promote (object_t *link)
+{
+  for (; link && link->v_stack->oneshot; link = link->v_stack->link)
+    link->v_stack->oneshot = false;
+}
+
+/* A return popped past the bottom of the live segment.  A whole one-shot
+   segment is adopted; otherwise only the frame header and the slots of the
+   activation it resumes are copied down, leaving the sealed segment intact
+   for the other continuations sharing it.  */
+static void
+vm_underflow (stack_t *stk)
+{
+  object_t *link = stk->link;
+  while (link && link->v_stack->base >= stk->base)
+    link = link->v_stack->link;
+  if (!link)
+    raise_runtime_error ("Stack underflow");
+
+  stack_t *seg = link->v_stack;
+  if (seg->oneshot && stk->count == 0
+      && stk->base == seg->base + seg->count)
+    {
+      vm_adopt (stk, seg);
+      return;
+    }
+  if (!seg->objs)
+    raise_runtime_error ("One-shot continuation already resumed");
+
+  size_t top = stk->base;
+  object_t **hdr = &seg->objs[top - 3 - seg->base];
+  size_t start = STACK_INDEX_VALUE (hdr[1]) - frame_nargs (hdr[0]);
+  size_t n = top - start;
+
+  if (stk->size < stk->count + n + 1)
+    {
+      stk->size = (stk->count + n) * 2;
+      stk->objs = realloc (stk->objs, stk->size * sizeof (object_t *));
+    }
+  memmove (&stk->objs[n], stk->objs, stk->count * sizeof (object_t *));
+  memcpy (stk->objs, &seg->objs[start - seg->base], n * sizeof (object_t *));
+  stk->count += n;
+  stk->base = start;
+  stk->link = link;
+}
+
+/* Resume the continuation whose stack ends with the sealed segment LINK.
+   The live segment starts out empty above it and the next return
+   underflows into it.  */
+static void
+vm_reinstate (stack_t *stk, object_t *link)
+{
+  stack_t *seg = link->v_stack;
+  if (seg->oneshot)
+    {
+      vm_adopt (stk, seg);
+      return;
+    }
+
+  stk->count = 0;
+  stk->base = seg->base + seg->count;
+  stk->link = link;
+}
+
+/* The innermost prompt still on the stack: a segment sealed by `reset'
+   whose top is the bottom of everything above it.  A prompt segment that a
+   return has already copied from belongs to an exited `reset'.  */
+static object_t *
+vm_find_prompt (stack_t *stk)
+{
+  size_t lo = stk->base;
+  for (object_t *link = stk->link; link; link = link->v_stack->link)
+    {
+      stack_t *seg = link->v_stack;
+      if (seg->prompt && seg->base + seg->count == lo)
+        return link;
+      if (seg->base < lo)
+        lo = seg->base;
+    }
+  return NULL;
+}
+
+/* Copy the slots between the innermost prompt and SPLIT into a delimited
+   continuation, then unwind the stack to the prompt.  The prompt stays in
+   place, so the receiver runs under the same `reset'.  */
+static object_t *
+vm_capture_delimited (stack_t *stk, size_t split, heap_t *heap)
+{
+  object_t *prompt = vm_find_prompt (stk);
+  if (!prompt)
+    raise_runtime_error ("shift without an enclosing reset");
+
+  size_t p = prompt->v_stack->base + prompt->v_stack->count;
+  object_t *saved = object_new_stack (split > p ? split - p : 1, heap);
+  stack_t *dst = saved->v_stack;
+  dst->base = p;
+  dst->count = split - p;
+
+  size_t hi = stk->base;
+  memcpy (&dst->objs[hi - p], stk->objs, (split - hi) * sizeof (object_t *));
+  for (object_t *link = stk->link; link != prompt; link = link->v_stack->link)
+    {
+      stack_t *seg = link->v_stack;
+      if (seg->base >= hi)
+        continue;
+      memcpy (&dst->objs[seg->base - p], seg->objs,
+              (hi - seg->base) * sizeof (object_t *));
+      hi = seg->base;
+    }
+
+  stk->count = 0;
+  stk->base = p;
+  stk->link = prompt;
+
+  object_t *k = object_new_conti (saved, heap);
+  k->v_conti->delimited = true;
+  return k;
+}
+
+/* Apply a delimited continuation: push a fresh prompt and copy its slots
+   on top, rebasing the saved frame pointers to where they now live.  */
+static void
+vm_compose (stack_t *stk, stack_t *saved, heap_t *heap)
+{
+  object_t *prompt = stack_seal (stk, stk->base + stk->count, heap);
+  prompt->v_stack->prompt = true;
+
+  if (stk->size < saved->count + 1)
+    {
+      stk->size = saved->count * 2;
+      stk->objs = realloc (stk->objs, stk->size * sizeof (object_t *));
+    }
+
+  intmax_t delta = (intmax_t)stk->base - (intmax_t)saved->base;
+  for (size_t i = 0; i < saved->count; i++)
+    {
+      object_t *o = saved->objs[i];
+      stk->objs[i] = STACK_IS_INDEX (o)
+                         ? STACK_INDEX (STACK_INDEX_VALUE (o) + delta)
+                         : o;
+    }
+  stk->count = saved->count;
+}
+
+/* The scheduler is created on first use; the code running at that point
+   becomes the main fiber.  */
+static sched_t *
+vm_sched (interp_t *interp)
+{
+  if (!interp->sched)
+    {
+      sched_t *sched = sched_new ();
+      sched->current = fiber_new (NULL);
+      sched->current->started = true;
+      sched->start = insn (interp, OP_Apply, 1, fixnum (interp, 0));
+      sched->exit = insn (interp, OP_Fiber, 3, fixnum (interp, FIBER_Exit),
+                          fixnum (interp, 0), insn (interp, OP_Halt, 0));
+      interp->sched = sched;
+    }
+  return interp->sched;
+}
+
+static inline bool
+vm_sched_pending (sched_t *sched)
+{
+  return sched->ready || sched->timers_count || sched->io_waiting;
+}
+
+/* Suspend the current fiber so that resuming it returns to RET in the
+   activation F, C.  The stack is sealed one-shot, so a switch costs a
+   frame push and a segment handoff, never a copy.  */
+static void
+vm_park (interp_t *interp, object_t *ret, size_t f, object_t *c)
+{
+  stack_t *stk = interp->stack;
+  stack_push (stk, c);
+  stack_push (stk, STACK_INDEX (f));
+  stack_push (stk, ret);
+
+  object_t *seg = stack_seal (stk, stk->base + stk->count, interp->heap);
+  seg->v_stack->oneshot = true;
+  interp->sched->current->resume = object_new_conti (seg, interp->heap);
+  interp->sched->current->value = object_nil;
+}
+
+/* Switch to the next runnable fiber, which starts by calling its thunk
+   under a frame returning to `exit'.  When nothing else can run, the
+   main fiber is resumed if it has halted; otherwise every fiber is
+   blocked for good.  */
+static object_t *
+vm_switch (interp_t *interp, object_t **a, size_t *f, object_t **c)
+{
+  sched_t *sched = interp->sched;
+  stack_t *stk = interp->stack;
+
+  fiber_t *fiber = sched_next (sched, interp->heap);
+  if (!fiber)
+    {
+      fiber = sched->main;
+      sched->main = NULL;
+      if (!fiber)
+        raise_runtime_error ("Deadlock: every fiber is blocked");
+    }
+  sched->current = fiber;
+
+  if (!fiber->started)
+    {
+      fiber->started = true;
+      stk->count = 0;
+      stk->base = 0;
+      stk->link = NULL;
+      stack_push (stk, NULL);
+      stack_push (stk, STACK_INDEX (0));
+      stack_push (stk, sched->exit);
+      *a = fiber->resume;
+      fiber->resume = NULL;
+      return sched->start;
+    }
+
+  *a = fiber->value;
+  vm_reinstate (stk, fiber->resume->v_conti->captured_stack);
+  fiber->value = fiber->resume = NULL;
+  return vm_pop_frame (stk, f, c);
+}
+
+/* Make the descriptor of PORT non-blocking for one attempt at a transfer,
+   storing its flags as they were in FLAGS for vm_port_restore.  The
+   descriptor may be shared with other processes, standard input for one,
+   and with builtins that expect it to block, so it is never left
+   non-blocking.  */
+static int
+vm_port_nonblock (port_t *port, int *flags)
+{
+  *flags = port->fd >= 0 ? fcntl (port->fd, F_GETFL) : -1;
+  if (*flags >= 0 && !(*flags & O_NONBLOCK))
+    fcntl (port->fd, F_SETFL, *flags | O_NONBLOCK);
+  return port->fd;
+}
+
+/* Put back the flags vm_port_nonblock found, keeping errno from the
+   transfer.  */
+static void
+vm_port_restore (int fd, int flags)
+{
+  int saved = errno;
+  if (flags >= 0 && !(flags & O_NONBLOCK))
+    fcntl (fd, F_SETFL, flags);
+  errno = saved;
+}
+
+/* Execute the `fiber' instruction X.  Operations that cannot complete park
+   the current fiber and return the instruction of the fiber switched to.
+   Reads and writes park with X itself as the return point and their
+   arguments still on the stack, so they are retried once the descriptor
+   is ready, or once the transfer submitted to the scheduler's ring has
+   completed, in which case the retry just collects its result; end of
+   file reads as #f.  Waiting for mail or for an isolate
+   to finish parks on the corresponding eventfd the same way.  */
+static object_t *
+vm_fiber (interp_t *interp, object_t *x, object_t **a, size_t *f,
+          object_t **c)
+{
+  stack_t *stk = interp->stack;
+  sched_t *sched = vm_sched (interp);
+  fiber_t *self = sched->current;
+  object_t *next = operand (x, 2);
+
+  size_t argc = OPERAND_INT (x, 1);
+  object_t *arg0 = argc > 0 ? stk->objs[stk->count - 1] : NULL;
+  object_t *arg1 = argc > 1 ? stk->objs[stk->count - 2] : NULL;
+  intmax_t kind = OPERAND_INT (x, 0);
+  if (kind != FIBER_Read && kind != FIBER_Write && kind != FIBER_IsolateJoin)
+    stk->count -= argc;
+
+  *a = object_nil;
+  switch (kind)
+    {
+    case FIBER_Spawn:
+      if (arg0->type != OBJ_Closure || arg0->v_closure->arity
+          || arg0->v_closure->variadic)
+        raise_runtime_error ("spawn expects a thunk");
+      sched_ready (sched, fiber_new (arg0));
+      return next;
+
+    case FIBER_Yield:
+      vm_park (interp, next, *f, *c);
+      sched_ready (sched, self);
+      return vm_switch (interp, a, f, c);
+
+    case FIBER_Sleep:
+      if (arg0->type != OBJ_Integer || arg0->v_integer < 0)
+        raise_runtime_error ("sleep expects a non-negative integer");
+      vm_park (interp, next, *f, *c);
+      sched_sleep (sched, self, (uint64_t)arg0->v_integer * 1000000u);
+      return vm_switch (interp, a, f, c);
+
+    case FIBER_Channel:
+      if (arg0 && (arg0->type != OBJ_Integer || arg0->v_integer < 0))
+        raise_runtime_error ("make-channel expects a non-negative integer");
+      *a = object_new_channel (arg0 ? arg0->v_integer : 0, interp->heap);
+      return next;
+
+    case FIBER_Send:
+      {
+        if (arg0->type != OBJ_Channel)
+          raise_runtime_error ("Expected a channel");
+        channel_t *ch = arg0->v_channel;
+        fiber_t *peer = channel_dequeue (&ch->receivers, &ch->receivers_tail);
+        if (peer)
+          {
+            peer->value = arg1;
+            sched_ready (sched, peer);
+            return next;
+          }
+        if (ch->count < ch->capacity)
+          {
+            ch->buf[(ch->head + ch->count++) % ch->capacity] = arg1;
+            return next;
+          }
+
+        self->message = arg1;
+        vm_park (interp, next, *f, *c);
+        channel_enqueue (&ch->senders, &ch->senders_tail, self);
+        return vm_switch (interp, a, f, c);
+      }
+
+    case FIBER_Recv:
+      {
+        if (arg0->type != OBJ_Channel)
+          raise_runtime_error ("Expected a channel");
+        channel_t *ch = arg0->v_channel;
+        fiber_t *peer = channel_dequeue (&ch->senders, &ch->senders_tail);
+        if (ch->count)
+          {
+            *a = ch->buf[ch->head];
+            ch->head = (ch->head + 1) % ch->capacity;
+            ch->count--;
+            if (peer)
+              ch->buf[(ch->head + ch->count++) % ch->capacity]
+                  = peer->message;
+          }
+        else if (peer)
+          *a = peer->message;
+        else
+          {
+            vm_park (interp, next, *f, *c);
+            channel_enqueue (&ch->receivers, &ch->receivers_tail, self);
+            return vm_switch (interp, a, f, c);
+          }
+
+        if (peer)
+          {
+            peer->message = NULL;
+            sched_ready (sched, peer);
+          }
+        return next;
+      }
+
+    case FIBER_Read:
+      {
+        if (arg0->type != OBJ_Integer || arg0->v_integer < 0)
+          raise_runtime_error ("read-bytevector expects a non-negative "
+                               "integer");
+        if (arg1->type != OBJ_Port)
+          raise_runtime_error ("Expected a port");
+        port_t *port = arg1->v_port;
+
+        object_t *bv;
+        ssize_t n;
+        if (self->io_state == FIBER_IO_Complete)
+          {
+            bv = self->io_buf;
+            n = self->io_res;
+            if (n < 0)
+              {
+                errno = -n;
+                n = -1;
+              }
+            self->io_buf = NULL;
+            self->io_state = FIBER_IO_Idle;
+          }
+        else
+          {
+            bv = object_new_bytevector (arg0->v_integer, interp->heap);
+            if (port->start == port->end && !port->dirty && port->fd >= 0
+                && sched_submit (sched, self, port->fd,
+                                 bv->v_bytevector->vals, arg0->v_integer,
+                                 false))
+              {
+                self->io_buf = bv;
+                vm_park (interp, x, *f, *c);
+                return vm_switch (interp, a, f, c);
+              }
+            int flags;
+            int fd = vm_port_nonblock (port, &flags);
+            n = port_read (port, bv->v_bytevector->vals, arg0->v_integer);
+            vm_port_restore (fd, flags);
+          }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+          {
+            vm_park (interp, x, *f, *c);
+            sched_wait_fd (sched, self, port->fd, false);
+            return vm_switch (interp, a, f, c);
+          }
+        if (n < 0)
+          raise_runtime_error ("read failed");
+
+        stk->count -= argc;
+        bv->v_bytevector->count = n;
+        *a = n ? bv : object_false;
+        return next;
+      }
+
+    case FIBER_Write:
+      {
+        if (arg0->type != OBJ_Bytevector)
+          raise_runtime_error ("write-bytevector expects a bytevector");
+        if (arg1->type != OBJ_Port)
+          raise_runtime_error ("Expected a port");
+        port_t *port = arg1->v_port;
+        bytevector_t *bv = arg0->v_bytevector;
+
+        bool again = false;
+        if (self->io_state == FIBER_IO_Complete)
+          {
+            self->io_state = FIBER_IO_Idle;
+            if (self->io_res == -EAGAIN)
+              again = true;
+            else if (self->io_res < 0)
+              raise_runtime_error ("write failed");
+            else
+              self->io_done += self->io_res;
+          }
+        if (!again)
+          {
+            int flags;
+            int fd = vm_port_nonblock (port, &flags);
+            bool flushed = port_flush (port);
+            vm_port_restore (fd, flags);
+            if (!flushed)
+              {
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                  raise_runtime_error ("write failed");
+                again = true;
+              }
+          }
+        if (port->fd < 0)
+          {
+            if (port_write (port, bv->vals, bv->count) < 0)
+              raise_runtime_error ("write failed");
+            self->io_done = bv->count;
+          }
+        while (!again && self->io_done < bv->count)
+          {
+            if (sched_submit (sched, self, port->fd, bv->vals + self->io_done,
+                              bv->count - self->io_done, true))
+              {
+                vm_park (interp, x, *f, *c);
+                return vm_switch (interp, a, f, c);
+              }
+            int flags;
+            int fd = vm_port_nonblock (port, &flags);
+            ssize_t n = write (fd, bv->vals + self->io_done,
+                               bv->count - self->io_done);
+            vm_port_restore (fd, flags);
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+              again = true;
+            else if (n < 0)
+              raise_runtime_error ("write failed");
+            else
+              self->io_done += n;
+          }
+        if (again)
+          {
+            vm_park (interp, x, *f, *c);
+            sched_wait_fd (sched, self, port->fd, true);
+            return vm_switch (interp, a, f, c);
+          }
+
+        stk->count -= argc;
+        self->io_done = 0;
+        return next;
+      }
+
+    case FIBER_IsolateSpawn:
+      *a = object_new_isolate (isolate_spawn (arg0), interp->heap);
+      return next;
+
+    case FIBER_IsolateSend:
+      if (arg0->type != OBJ_Isolate)
+        raise_runtime_error ("Expected an isolate");
+      isolate_post (arg0->v_isolate, arg1);
+      return next;
+
+    case FIBER_IsolateRecv:
+      {
+        mailbox_t *mb = &isolate_current ()->inbox;
+        message_t *msg = mailbox_pop (mb);
+        if (!msg)
+          {
+            eventfd_t drained;
+            eventfd_read (mb->efd, &drained);
+            msg = mailbox_pop (mb);
+          }
+        if (!msg)
+          {
+            vm_park (interp, x, *f, *c);
+            sched_wait_fd (sched, self, mb->efd, false);
+            return vm_switch (interp, a, f, c);
+          }
+
+        *a = message_decode (msg, interp->heap);
+        free (msg);
+        return next;
+      }
+
+    case FIBER_IsolateJoin:
+      if (arg0->type != OBJ_Isolate)
+        raise_runtime_error ("Expected an isolate");
+      if (!atomic_load (&arg0->v_isolate->done))
+        {
+          vm_park (interp, x, *f, *c);
+          sched_wait_fd (sched, self, arg0->v_isolate->done_fd, false);
+          return vm_switch (interp, a, f, c);
+        }
+      stk->count -= argc;
+      *a = isolate_join (arg0->v_isolate, interp->heap);
+      return next;
+
+    case FIBER_IsolateParent:
+      {
+        isolate_t *parent = isolate_current ()->parent;
+        if (!parent)
+          {
+            *a = object_false;
+            return next;
+          }
+        isolate_retain (parent);
+        *a = object_new_isolate (parent, interp->heap);
+        return next;
+      }
+
+    case FIBER_Exit:
+      fiber_delete (self);
+      sched->current = NULL;
+      return vm_switch (interp, a, f, c);
+
+    default:
+      raise_runtime_error ("Unknown fiber operation");
+    }
+  return next;
+}
+
+/* Interpreters forked for pool workers share their parent's pool, which
+   is started on first use with one thread per CPU the process may run on,
+   so that taskset(1) limits it too.  */
+static pool_t *
+vm_pool (interp_t *interp)
+{
+  if (interp->parent)
+    return vm_pool (interp->parent);
+  if (!interp->pool)
+    {
+      cpu_set_t cpus;
+      long n = sched_getaffinity (0, sizeof (cpus), &cpus) == 0
+                   ? CPU_COUNT (&cpus)
+                   : sysconf (_SC_NPROCESSORS_ONLN);
+      interp->pool = pool_new (interp, n > 0 ? n : 1);
+    }
+  return interp->pool;
+}
+
+static object_t **
+vm_list_to_array (object_t *lst, size_t *n)
+{
+  *n = 0;
+  for (object_t *p = lst; p->type == OBJ_Pair; p = cdr (p))
+    (*n)++;
+
+  object_t **items = calloc (*n ? *n : 1, sizeof (object_t *));
+  size_t i = 0;
+  for (object_t *p = lst; p->type == OBJ_Pair; p = cdr (p))
+    items[i++] = car (p);
+  return items;
+}
+
+/* Execute the `parallel' instruction X.  The list operations split their
+   input into a few chunks per thread so that stealing can even out uneven
+   work, and the calling thread runs chunks itself while it waits.
+   `parallel-reduce' folds each chunk on its own and then folds the chunk
+   results into INIT, so F must be associative.  */
+static object_t *
+vm_parallel (interp_t *interp, object_t *x)
+{
+  stack_t *stk = interp->stack;
+  pool_t *pool = vm_pool (interp);
+  size_t argc = OPERAND_INT (x, 1);
+  object_t *args[3] = { NULL, NULL, NULL };
+  for (size_t i = 0; i < argc; i++)
+    args[i] = stk->objs[stk->count - 1 - i];
+  stk->count -= argc;
+
+  intmax_t kind = OPERAND_INT (x, 0);
+  switch (kind)
+    {
+    case PAR_Future:
+      {
+        task_t *task = task_new (TASK_Thunk, args[0]);
+        pool_submit (pool, task);
+        return object_new_future (task, interp->heap);
+      }
+
+    case PAR_Touch:
+      if (args[0]->type != OBJ_Future)
+        raise_runtime_error ("touch expects a future");
+      pool_wait (pool, args[0]->v_future);
+      return args[0]->v_future->value;
+
+    default:
+      break;
+    }
+
+  object_t *fn = args[0];
+  size_t n;
+  object_t **in = vm_list_to_array (kind == PAR_Reduce ? args[2] : args[1],
+                                    &n);
+  object_t **out = kind != PAR_ForEach
+                       ? calloc (n ? n : 1, sizeof (object_t *))
+                       : NULL;
+  heap_push_roots (interp->heap, args, 3);
+  heap_push_roots (interp->heap, in, n);
+  heap_push_roots (interp->heap, out, out ? n : 0);
+
+  size_t nchunks = pool->nthreads * PARALLEL_CHUNKS_PER_THREAD;
+  if (nchunks > n)
+    nchunks = n;
+  atomic_size_t pending;
+  atomic_init (&pending, nchunks);
+
+  enum TaskKind tk = kind == PAR_Map       ? TASK_Map
+                     : kind == PAR_ForEach ? TASK_ForEach
+                                           : TASK_Reduce;
+  task_t **tasks = calloc (nchunks ? nchunks : 1, sizeof (task_t *));
+  for (size_t i = 0; i < nchunks; i++)
+    {
+      task_t *task = task_new (tk, fn);
+      task->in = in;
+      task->out = out;
+      task->lo = n * i / nchunks;
+      task->hi = n * (i + 1) / nchunks;
+      task->pending = &pending;
+      tasks[i] = task;
+      pool_submit (pool, task);
+    }
+  pool_wait_all (pool, &pending);
+
+  object_t *result = object_nil;
+  if (kind == PAR_Map)
+    for (size_t i = n; i > 0; i--)
+      result = object_new_pair (out[i - 1], result, interp->heap);
+  else if (kind == PAR_Reduce)
+    {
+      object_t *acc[2] = { args[1], NULL };
+      for (size_t i = 0; i < nchunks; i++)
+        {
+          acc[1] = out[tasks[i]->lo];
+          acc[0] = eval_apply (interp, fn, 2, acc);
+        }
+      result = acc[0];
+    }
+
+  heap_pop_roots (interp->heap);
+  heap_pop_roots (interp->heap);
+  heap_pop_roots (interp->heap);
+  for (size_t i = 0; i < nchunks; i++)
+    task_release (tasks[i]);
+  free (tasks);
+  free (in);
+  free (out);
+  return result;
+}
+
+/* Package the arguments beyond the required ones into a list held in the
+   rest parameter's slot, so the callee always sees ARITY + 1 arguments.  */
+static void
+vm_collect_rest (interp_t *interp, closure_t *clo, size_t argc)
+{
+  stack_t *stk = interp->stack;
+  size_t s = stk->count;
+  size_t nreq = clo->arity;
+
+  object_t *rest = object_nil;
+  for (size_t i = argc; i > nreq; i--)
+    rest = object_new_pair (stk->objs[s - i], rest, interp->heap);
+
+  if (argc == nreq)
+    {
+      stack_push (stk, NULL);
+      memmove (&stk->objs[s - nreq + 1], &stk->objs[s - nreq],
+               nreq * sizeof (object_t *));
+      stk->objs[s - nreq] = rest;
+    }
+  else
+    {
+      stk->objs[s - nreq - 1] = rest;
+      memmove (&stk->objs[s - argc], &stk->objs[s - nreq - 1],
+               (nreq + 1) * sizeof (object_t *));
+      stk->count -= argc - nreq - 1;
+    }
+}
+
+/* Builtins receive their arguments as a vector, first argument first.
+   The arguments lie on the stack with the first on top, so they are
+   reversed in place there; the caller pops them once the builtin has
+   returned, and no builtin runs Scheme code that could grow the stack
+   meanwhile.  */
+static object_t *
+vm_call_builtin (interp_t *interp, builtin_t *builtin, size_t argc)
+{
+  stack_t *stk = interp->stack;
+  object_t **args = &stk->objs[stk->count - argc];
+  for (size_t i = 0, j = argc; i + 1 < j; i++, j--)
+    {
+      object_t *arg = args[i];
+      args[i] = args[j - 1];
+      args[j - 1] = arg;
+    }
+
+  return (*builtin->fn) (args, argc, interp->toplevel);
+}
+
+/* Bulk vector operations that call back into Scheme for every element.
+   `f64vector-map!' replaces each element of an f64vector with the real
+   number F returns for it.  The vector's storage does not move while F
+   runs, and the vector is a root meanwhile.  */
+static object_t *
+vm_bulk (interp_t *interp, object_t *x)
+{
+  stack_t *stk = interp->stack;
+  size_t argc = OPERAND_INT (x, 1);
+  object_t *args[2] = { NULL, NULL };
+  for (size_t i = 0; i < argc; i++)
+    args[i] = stk->objs[stk->count - 1 - i];
+  stk->count -= argc;
+
+  object_t *fn = args[0];
+  object_t *v = args[1];
+  if (v->type != OBJ_Numvector || v->v_numvector->type != NUMVEC_F64)
+    raise_runtime_error ("f64vector-map! takes an f64vector");
+
+  heap_push_roots (interp->heap, args, 2);
+  double *vals = v->v_numvector->vals;
+  size_t i = 0;
+  object_t *r = NULL;
+  for (; i < v->v_numvector->count; i++)
+    {
+      object_t *e = object_new_real (vals[i], interp->heap);
+      r = eval_apply (interp, fn, 1, &e);
+      if (r->type == OBJ_Real)
+        vals[i] = r->v_real;
+      else if (r->type == OBJ_Integer)
+        vals[i] = r->v_integer;
+      else if (r->type == OBJ_Bignum)
+        vals[i] = bignum_to_double (r->v_bignum);
+      else
+        break;
+    }
+  heap_pop_roots (interp->heap);
+
+  if (i < v->v_numvector->count)
+    raise_runtime_error ("f64vector-map! procedure must return a real");
+  return v;
+}
+
+/* The fuel ran out at X.  Refill it, then check the deadline and, when
+   the host set a quantum, let other fibers run or hand control back to
+   the host.  Returns where to continue, or NULL once the registers are
+   spilled for eval_resume.  Nested runs cannot return to the host: for
+   them only an expired deadline matters, and it is an error.  */
+static object_t *
+vm_preempt (interp_t *interp, object_t *x, object_t **a, size_t *f,
+            object_t **c, intmax_t *fuel)
+{
+  *fuel = interp->quantum    ? interp->quantum
+          : interp->deadline ? EVAL_DEADLINE_INTERVAL
+                             : INTMAX_MAX;
+
+  enum Preempt why = PREEMPT_None;
+  if (interp->deadline && sched_now () >= interp->deadline)
+    why = PREEMPT_Deadline;
+  else if (interp->quantum)
+    {
+      sched_t *sched = interp->sched;
+      if (sched && sched->current && vm_sched_pending (sched))
+        {
+          fiber_t *self = sched->current;
+          vm_park (interp, x, *f, *c);
+          self->value = *a;
+          sched_ready (sched, self);
+          return vm_switch (interp, a, f, c);
+        }
+      why = PREEMPT_Fuel;
+    }
+
+  if (why == PREEMPT_None)
+    return x;
+  if (interp->nested)
+    {
+      if (why == PREEMPT_Deadline)
+        raise_runtime_error ("Deadline exceeded");
+      return x;
+    }
+
+  interp->preempted = why;
+  interp->accumulator = *a;
+  interp->next_expr = x;
+  interp->closure = *c;
+  interp->frame = *f;
+  interp->fuel = *fuel;
+  return NULL;
+}
+
+/* The value of a flonum operand, which must be a flonum unless CONVERT
+   lets any real number through.  */
+static inline double
+vm_flonum (object_t *o, bool convert)
+{
+  if (o->type == OBJ_Real)
+    return o->v_real;
+  if (convert && o->type == OBJ_Integer)
+    return o->v_integer;
+  if (convert && o->type == OBJ_Bignum)
+    return bignum_to_double (o->v_bignum);
+  raise_runtime_error (convert ? "exact->inexact takes a real number"
+                               : "Flonum operation on a non-flonum");
+  return 0.0;
+}
+
+/* Whether the N registers from R are ordered by the FL_ comparison KIND,
+   each against the next.  */
+static bool
+vm_flonum_compare (int kind, const double *r, size_t n)
+{
+  for (size_t i = 0; i + 1 < n; i++)
+    {
+      bool ok;
+      switch (kind)
+        {
+        case FL_Equal:
+          ok = r[i] == r[i + 1];
+          break;
+        case FL_Less:
+          ok = r[i] < r[i + 1];
+          break;
+        case FL_Greater:
+          ok = r[i] > r[i + 1];
+          break;
+        case FL_LessEqual:
+          ok = r[i] <= r[i + 1];
+          break;
+        default:
+          ok = r[i] >= r[i + 1];
+          break;
+        }
+      if (!ok)
+        return false;
+    }
+  return true;
+}
+
+object_t *
+eval_run (interp_t *interp, object_t *code)
+{
+  heap_t *heap = interp->heap;
+  stack_t *stk = interp->stack;
+  object_t *a = interp->accumulator;
+  object_t *x = code;
+  object_t *c = interp->closure;
+  size_t f = interp->frame;
+  intmax_t fuel = interp->fuel;
+  double fr[FLONUM_REGISTERS];
+
+  for (;;)
+    {
+      switch (car (x)->v_opcode)
+        {
+        case OP_Halt:
+          if (interp->sched && vm_sched_pending (interp->sched))
+            {
+              vm_park (interp, x, f, c);
+              interp->sched->main = interp->sched->current;
+              interp->sched->main->value = a;
+              x = vm_switch (interp, &a, &f, &c);
+              break;
+            }
+          interp->accumulator = a;
+          interp->next_expr = x;
+          interp->closure = c;
+          interp->frame = f;
+          interp->fuel = fuel;
+          return a;
+
+        case OP_Refer:
+          a = environ_retrieve (interp->environ, operand (x, 0));
+          if (!a)
+            raise_runtime_error ("Unbound variable");
+          x = operand (x, 1);
+          break;
+
+        case OP_ReferLocal:
+          a = LOCAL (OPERAND_INT (x, 0));
+          x = operand (x, 1);
+          break;
+
+        case OP_ReferFree:
+          a = c->v_closure->frees[OPERAND_INT (x, 0)];
+          x = operand (x, 1);
+          break;
+
+        case OP_Indirect:
+          a = a->v_box->value;
+          x = operand (x, 0);
+          break;
+
+        case OP_Constant:
+          a = operand (x, 0);
+          x = operand (x, 1);
+          break;
+
+        case OP_Close:
+          {
+            size_t nfree = OPERAND_INT (x, 0);
+            a = object_new_flat_closure (operand (x, 1), nfree, heap);
+            for (size_t i = 0; i < nfree; i++)
+              a->v_closure->frees[i] = stk->objs[stk->count - nfree + i];
+            stk->count -= nfree;
+            x = operand (x, 2);
+          }
+          break;
+
+        case OP_Box:
+          LOCAL (OPERAND_INT (x, 0))
+              = object_new_box (LOCAL (OPERAND_INT (x, 0)), heap);
+          x = operand (x, 1);
+          break;
+
+        case OP_Test:
+          x = is_false (a) ? operand (x, 1) : operand (x, 0);
+          break;
+
+        case OP_Dispatch:
+          {
+            object_t *target
+                = dispatch_lookup (operand (x, 0)->v_dispatch, a);
+            x = target ? target : operand (x, 1);
+          }
+          break;
+
+        case OP_Assign:
+          environ_install (interp->environ, operand (x, 0), a);
+          x = operand (x, 1);
+          break;
+
+        case OP_AssignLocal:
+          LOCAL (OPERAND_INT (x, 0)) = a;
+          x = operand (x, 1);
+          break;
+
+        case OP_AssignIndirect:
+          LOCAL (OPERAND_INT (x, 0))->v_box->value = a;
+          x = operand (x, 1);
+          break;
+
+        case OP_AssignFree:
+          c->v_closure->frees[OPERAND_INT (x, 0)]->v_box->value = a;
+          x = operand (x, 1);
+          break;
+
+        case OP_Conti:
+          {
+            intmax_t n = OPERAND_INT (x, 0);
+            intmax_t kind = OPERAND_INT (x, 1);
+            size_t split = n < 0 ? SP : f - n;
+            object_t *k;
+            if (kind == CONTI_DELIMITED)
+              k = vm_capture_delimited (stk, split, heap);
+            else
+              {
+                if (kind == CONTI_FULL)
+                  vm_promote (stk->link);
+                object_t *seg = stack_seal (stk, split, heap);
+                seg->v_stack->oneshot = kind == CONTI_ONESHOT;
+                k = object_new_conti (seg, heap);
+              }
+            stack_push (stk, k);
+            x = operand (x, 2);
+          }
+          break;
+
+        case OP_Nuate:
+          vm_reinstate (stk, operand (x, 0));
+          x = vm_pop_frame (stk, &f, &c);
+          break;
+
+        case OP_Prompt:
+          stack_seal (stk, SP, heap)->v_stack->prompt = true;
+          x = operand (x, 0);
+          break;
+
+        case OP_Fiber:
+          x = vm_fiber (interp, x, &a, &f, &c);
+          break;
+
+        case OP_Parallel:
+          interp->accumulator = a;
+          interp->next_expr = x;
+          interp->closure = c;
+          a = vm_parallel (interp, x);
+          x = operand (x, 2);
+          break;
+
+        case OP_Bulk:
+          interp->accumulator = a;
+          interp->next_expr = x;
+          interp->closure = c;
+          a = vm_bulk (interp, x);
+          x = operand (x, 2);
+          break;
+
+        case OP_FlConstant:
+          fr[OPERAND_INT (x, 0)] = operand (x, 1)->v_real;
+          x = operand (x, 2);
+          break;
+
+        case OP_FlLoad:
+          fr[OPERAND_INT (x, 0)] = vm_flonum (LOCAL (OPERAND_INT (x, 1)),
+                                              operand (x, 2)->v_bool);
+          x = operand (x, 3);
+          break;
+
+        case OP_FlUnbox:
+          fr[OPERAND_INT (x, 0)] = vm_flonum (a, operand (x, 1)->v_bool);
+          x = operand (x, 2);
+          break;
+
+        case OP_FlMove:
+          fr[OPERAND_INT (x, 0)] = fr[OPERAND_INT (x, 1)];
+          x = operand (x, 2);
+          break;
+
+        case OP_FlArith:
+          {
+            double *r = &fr[OPERAND_INT (x, 1)];
+            switch (OPERAND_INT (x, 0))
+              {
+              case FL_Add:
+                r[0] += r[1];
+                break;
+              case FL_Sub:
+                r[0] -= r[1];
+                break;
+              case FL_Mul:
+                r[0] *= r[1];
+                break;
+              case FL_Div:
+                r[0] /= r[1];
+                break;
+              }
+            x = operand (x, 2);
+          }
+          break;
+
+        case OP_FlCompare:
+          {
+            double *r = &fr[OPERAND_INT (x, 1)];
+            a = vm_flonum_compare (OPERAND_INT (x, 0), r,
+                                   OPERAND_INT (x, 2))
+                    ? object_true
+                    : object_false;
+            x = operand (x, 3);
+          }
+          break;
+
+        case OP_FlBox:
+          a = object_new_real (fr[OPERAND_INT (x, 0)], heap);
+          x = operand (x, 1);
+          break;
+
+        case OP_Frame:
+          stack_push (stk, c);
+          stack_push (stk, STACK_INDEX (f));
+          stack_push (stk, operand (x, 0));
+          x = operand (x, 1);
+          break;
+
+        case OP_Argument:
+          stack_push (stk, a);
+          x = operand (x, 0);
+          break;
+
+        case OP_Shift:
+          {
+            size_t n = OPERAND_INT (x, 0);
+            size_t dest = f - OPERAND_INT (x, 1) - stk->base;
+            memmove (&stk->objs[dest], &stk->objs[stk->count - n],
+                     n * sizeof (object_t *));
+            stk->count = dest + n;
+            x = operand (x, 2);
+          }
+          break;
+
+        case OP_Jump:
+          {
+            size_t n = OPERAND_INT (x, 0);
+            size_t dest = f + OPERAND_INT (x, 1) - stk->base;
+            memmove (&stk->objs[dest], &stk->objs[stk->count - n],
+                     n * sizeof (object_t *));
+            stk->count = dest + n;
+            x = car (operand (x, 2));
+            VM_TICK ();
+            VM_SAFEPOINT ();
+          }
+          break;
+
+        case OP_Pop:
+          stk->count -= OPERAND_INT (x, 0);
+          x = operand (x, 1);
+          break;
+
+        case OP_Apply:
+          {
+            size_t argc = OPERAND_INT (x, 0);
+            VM_SAFEPOINT ();
+          apply:
+            switch (a->type)
+              {
+              case OBJ_Procedure:
+                a = a->v_procedure->value;
+                goto apply;
+
+              case OBJ_Closure:
+                if (a->v_closure->variadic ? argc < a->v_closure->arity
+                                           : argc != a->v_closure->arity)
+                  raise_runtime_error ("Wrong number of arguments");
+                if (a->v_closure->variadic)
+                  vm_collect_rest (interp, a->v_closure, argc);
+                x = a->v_closure->body;
+                f = SP;
+                c = a;
+                VM_TICK ();
+                break;
+
+              case OBJ_Builtin:
+                a = vm_call_builtin (interp, a->v_builtin, argc);
+                stk->count -= argc;
+                x = vm_pop_frame (stk, &f, &c);
+                break;
+
+              case OBJ_Conti:
+                {
+                  conti_t *k = a->v_conti;
+                  a = argc ? stk->objs[stk->count - 1] : object_nil;
+                  if (k->delimited)
+                    {
+                      stk->count -= argc;
+                      vm_compose (stk, k->captured_stack->v_stack, heap);
+                    }
+                  else
+                    vm_reinstate (stk, k->captured_stack);
+                  x = vm_pop_frame (stk, &f, &c);
+                }
+                break;
+
+              default:
+                raise_runtime_error ("Attempt to apply a non-procedure");
+              }
+          }
+          break;
+
+        case OP_Return:
+          stk->count = f - OPERAND_INT (x, 0) - stk->base;
+          x = vm_pop_frame (stk, &f, &c);
+          VM_SAFEPOINT ();
+          break;
+
+        default:
+          raise_runtime_error ("Unknown opcode");
+        }
+    }
+}
+
+object_t *
+eval (interp_t *interp, object_t *expr)
+{
+  object_t *code = eval_compile (interp, expr);
+  interp->frame = interp->stack->base + interp->stack->count;
+  interp->closure = NULL;
+  return eval_run (interp, code);
+}
+
+/* Call FN on ARGV from C, on top of whatever the stack already holds.
+   Nested runs must not park the fibers of the outer one, so the scheduler
+   is hidden from them.  The outer run's spilled registers stay rooted
+   while the nested one reuses the slots.  */
+object_t *
+eval_apply (interp_t *interp, object_t *fn, size_t argc, object_t **argv)
+{
+  object_t *saved[] = { interp->accumulator, interp->next_expr,
+                        interp->closure, fn };
+  heap_push_roots (interp->heap, saved, 4);
+  heap_push_roots (interp->heap, argv, argc);
+  stack_t *stk = interp->stack;
+  size_t sp = stk->base + stk->count;
+  stack_push (stk, NULL);
+  stack_push (stk, STACK_INDEX (sp));
+  stack_push (stk, insn (interp, OP_Halt, 0));
+  for (size_t i = argc; i > 0; i--)
+    stack_push (stk, argv[i - 1]);
+
+  sched_t *sched = interp->sched;
+  interp->sched = NULL;
+  interp->accumulator = fn;
+  interp->frame = sp;
+  interp->closure = NULL;
+  interp->nested++;
+  object_t *value
+      = eval_run (interp, insn (interp, OP_Apply, 1, fixnum (interp, argc)));
+  interp->nested--;
+  if (interp->sched)
+    sched_delete (interp->sched);
+  interp->sched = sched;
+  interp->accumulator = saved[0];
+  interp->next_expr = saved[1];
+  interp->closure = saved[2];
+  heap_pop_roots (interp->heap);
+  heap_pop_roots (interp->heap);
+  return value;
+}
+
+/* Run untrusted code on a budget.  Every QUANTUM calls and backward jumps
+   the running fiber makes way for the others, or, with no other fiber
+   ready, eval_run returns NULL with PREEMPTED set to PREEMPT_Fuel.  Past
+   DEADLINE, a CLOCK_MONOTONIC time in nanoseconds, it returns NULL with
+   PREEMPT_Deadline.  Either way eval_resume carries on from where it
+   stopped.  Zero disables either limit.  */
+void
+eval_set_budget (interp_t *interp, intmax_t quantum, uint64_t deadline)
+{
+  interp->quantum = quantum;
+  interp->deadline = deadline;
+  interp->fuel = quantum    ? quantum
+                 : deadline ? EVAL_DEADLINE_INTERVAL
+                            : INTMAX_MAX;
+}
+
+object_t *
+eval_resume (interp_t *interp)
+{
+  interp->preempted = PREEMPT_None;
+  return eval_run (interp, interp->next_expr);
+}
 
+/* Collector callback marking what INTERP keeps outside the heap: the
+   registers spilled at its last safepoint, its stack, the fibers of its
+   scheduler and the tasks queued on a pool it owns.  */
+void
+eval_mark_roots (void *ctx)
+{
+  interp_t *interp = ctx;
+  heap_mark (interp->accumulator);
+  heap_mark (interp->next_expr);
+  heap_mark (interp->evaluated_args);
+  heap_mark (interp->closure);
+  heap_mark (interp->toplevel);
+  heap_mark (interp->stack_object);
+  heap_mark_stack (interp->stack);
+  if (interp->sched)
+    sched_mark (interp->sched);
+  if (interp->pool && interp->pool->owner == interp)
+    pool_mark (interp->pool);
+}
@@ -1,22 +1,108 @@
 #ifndef EVAL_H
 #define EVAL_H
 
+#include "fiber.h"
 #include "heap.h"
 #include "object.h"
 
 typedef struct Interpreter interp_t;
 typedef struct Expander expander_t;
+typedef struct Binding binding_t;
+typedef struct Scope scope_t;
+typedef struct Scan scan_t;
+typedef struct Hoist hoist_t;
+typedef struct Pool pool_t;
 
 struct Interpreter
 {
   heap_t *heap;
   stack_t *stack;
+  object_t *stack_object;
   environ_t *environ;
+  object_t *toplevel;
   object_t *accumulator;
   object_t *next_expr;
   object_t *evaluated_args;
+  object_t *closure;
+  size_t frame;
+  sched_t *sched;
+  pool_t *pool;
+  interp_t *parent;
+  intmax_t fuel;
+  intmax_t quantum;
+  uint64_t deadline;
+  enum Preempt
+  {
+    PREEMPT_None,
+    PREEMPT_Fuel,
+    PREEMPT_Deadline,
+  } preempted;
+  size_t nested;
 };
 
-struct
+/* Compile-time description of a variable.  Locals live in VM stack slots
+   addressed relative to the frame pointer: arguments at negative offsets,
+   `let' slots at non-negative ones.  Frees index the closure's captured
+   values.  A binding is boxed only when it is assigned: a continuation
+   re-entered after the assignment must see it, and the stack slot it
+   restores would not.  Loop bindings name a named `let' compiled to a jump:
+   INDEX is its first slot and LABEL a cell holding the loop head.  Flonum
+   bindings are `let' temporaries kept unboxed in float register INDEX.  */
+struct Binding
+{
+  object_t *name;
+  enum BindingKind
+  {
+    BIND_Local,
+    BIND_Free,
+    BIND_Loop,
+    BIND_Flonum,
+  } kind;
+  intmax_t index;
+  bool boxed;
+  size_t arity;
+  object_t *label;
+  binding_t *next;
+};
+
+struct Scope
+{
+  binding_t *bindings;
+  size_t nargs;
+};
+
+#define USE_REFERENCED 0x01
+#define USE_ASSIGNED 0x02
+#define USE_CAPTURED 0x04
+#define USE_CALLED 0x08
+#define USE_NONTAIL 0x10
+
+struct Scan
+{
+  object_t *target;
+  unsigned usage;
+  intmax_t arity;
+  object_t *frees;
+};
+
+/* Operands of a flonum expression that are not flonum expressions
+   themselves, last first.  They are evaluated and pushed before any float
+   register is loaded; the Nth pushed is read back from slot N above the
+   depth of the expression.  */
+struct Hoist
+{
+  object_t *leaves;
+  size_t count;
+};
+
+object_t *eval_compile (interp_t *interp, object_t *expr);
+object_t *eval_run (interp_t *interp, object_t *code);
+object_t *eval (interp_t *interp, object_t *expr);
+object_t *eval_apply (interp_t *interp, object_t *fn, size_t argc,
+                      object_t **argv);
+void eval_mark_roots (void *ctx);
+
+void eval_set_budget (interp_t *interp, intmax_t quantum, uint64_t deadline);
+object_t *eval_resume (interp_t *interp);
 
 #endif
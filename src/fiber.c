@@ -0,0 +1,352 @@
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "fiber.h"
+#include "heap.h"
+#include "utils.h"
+
+#define SCHED_TIMERS_INITIAL_SIZE 64
+#define SCHED_POLL_INTERVAL 64
+#define SCHED_MAX_EVENTS 256
+
+uint64_t
+sched_now (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+sched_t *
+sched_new (void)
+{
+  sched_t *sched = calloc (1, sizeof (sched_t));
+  sched->timers = calloc (SCHED_TIMERS_INITIAL_SIZE, sizeof (fiber_t *));
+  sched->timers_size = SCHED_TIMERS_INITIAL_SIZE;
+  sched->epfd = epoll_create1 (EPOLL_CLOEXEC);
+  if (sched->epfd < 0)
+    raise_runtime_error ("Could not create epoll instance");
+
+  sched->ring = uring_new (URING_ENTRIES);
+  if (sched->ring)
+    {
+      struct epoll_event ev = {
+        .events = EPOLLIN,
+        .data.fd = sched->ring->fd,
+      };
+      if (epoll_ctl (sched->epfd, EPOLL_CTL_ADD, sched->ring->fd, &ev) < 0)
+        {
+          uring_delete (sched->ring);
+          sched->ring = NULL;
+        }
+    }
+  return sched;
+}
+
+void
+sched_delete (sched_t *sched)
+{
+  for (fiber_t *fb = sched->ready; fb;)
+    {
+      fiber_t *next = fb->next;
+      fiber_delete (fb);
+      fb = next;
+    }
+  for (size_t i = 0; i < sched->timers_count; i++)
+    fiber_delete (sched->timers[i]);
+  for (size_t i = 0; i < sched->io_size; i++)
+    fiber_delete (sched->io[i]);
+  uring_delete (sched->ring);
+  for (fiber_t *fb = sched->inflight; fb;)
+    {
+      fiber_t *next = fb->next;
+      fiber_delete (fb);
+      fb = next;
+    }
+  close (sched->epfd);
+  free (sched->io);
+  free (sched->timers);
+  free (sched);
+}
+
+fiber_t *
+fiber_new (object_t *resume)
+{
+  fiber_t *fiber = calloc (1, sizeof (fiber_t));
+  fiber->resume = resume;
+  return fiber;
+}
+
+void
+fiber_delete (fiber_t *fiber)
+{
+  free (fiber);
+}
+
+void
+fiber_mark (fiber_t *fiber)
+{
+  for (; fiber; fiber = fiber->next)
+    {
+      heap_mark (fiber->resume);
+      heap_mark (fiber->value);
+      heap_mark (fiber->message);
+      heap_mark (fiber->io_buf);
+    }
+}
+
+/* Everything the scheduler keeps alive: the fibers it can resume and the
+   thunks it starts and ends them with.  Fibers blocked on a channel are
+   reached through the channel instead.  */
+void
+sched_mark (sched_t *sched)
+{
+  fiber_mark (sched->current);
+  fiber_mark (sched->ready);
+  fiber_mark (sched->main);
+  for (size_t i = 0; i < sched->timers_count; i++)
+    fiber_mark (sched->timers[i]);
+  for (size_t i = 0; i < sched->io_size; i++)
+    fiber_mark (sched->io[i]);
+  fiber_mark (sched->inflight);
+  heap_mark (sched->start);
+  heap_mark (sched->exit);
+}
+
+void
+sched_ready (sched_t *sched, fiber_t *fiber)
+{
+  channel_enqueue (&sched->ready, &sched->ready_tail, fiber);
+}
+
+static inline void
+timers_swap (fiber_t **timers, size_t i, size_t j)
+{
+  fiber_t *t = timers[i];
+  timers[i] = timers[j];
+  timers[j] = t;
+}
+
+void
+sched_sleep (sched_t *sched, fiber_t *fiber, uint64_t ns)
+{
+  if (sched->timers_count == sched->timers_size)
+    {
+      sched->timers_size *= 2;
+      sched->timers = realloc (sched->timers,
+                               sched->timers_size * sizeof (fiber_t *));
+    }
+
+  fiber->wake = sched_now () + ns;
+  size_t i = sched->timers_count++;
+  sched->timers[i] = fiber;
+  while (i && sched->timers[(i - 1) / 2]->wake > sched->timers[i]->wake)
+    {
+      timers_swap (sched->timers, i, (i - 1) / 2);
+      i = (i - 1) / 2;
+    }
+}
+
+static fiber_t *
+timers_pop (sched_t *sched)
+{
+  fiber_t **timers = sched->timers;
+  fiber_t *top = timers[0];
+  timers[0] = timers[--sched->timers_count];
+
+  size_t i = 0;
+  for (;;)
+    {
+      size_t l = 2 * i + 1, r = l + 1, min = i;
+      if (l < sched->timers_count && timers[l]->wake < timers[min]->wake)
+        min = l;
+      if (r < sched->timers_count && timers[r]->wake < timers[min]->wake)
+        min = r;
+      if (min == i)
+        break;
+      timers_swap (timers, i, min);
+      i = min;
+    }
+  return top;
+}
+
+/* Descriptors stay registered once added; EPOLLONESHOT disarms them after
+   each wakeup so they are simply re-armed the next time a fiber waits.
+   A descriptor has a single registration, so only one fiber may wait on it
+   at a time.  */
+void
+sched_wait_fd (sched_t *sched, fiber_t *fiber, int fd, bool write)
+{
+  struct epoll_event ev = {
+    .events = (write ? EPOLLOUT : EPOLLIN) | EPOLLONESHOT,
+    .data.fd = fd,
+  };
+  if (epoll_ctl (sched->epfd, EPOLL_CTL_MOD, fd, &ev) < 0
+      && (errno != ENOENT
+          || epoll_ctl (sched->epfd, EPOLL_CTL_ADD, fd, &ev) < 0))
+    raise_runtime_error ("Could not wait on file descriptor");
+
+  if ((size_t)fd >= sched->io_size)
+    {
+      size_t size = sched->io_size ? sched->io_size : 64;
+      while (size <= (size_t)fd)
+        size *= 2;
+      sched->io = realloc (sched->io, size * sizeof (fiber_t *));
+      memset (&sched->io[sched->io_size], 0,
+              (size - sched->io_size) * sizeof (fiber_t *));
+      sched->io_size = size;
+    }
+  sched->io[fd] = fiber;
+  sched->io_waiting++;
+}
+
+/* Queue a read into, or a write from, BUF on the ring for FIBER, which
+   must then park until its IO_STATE turns complete.  The transfer is
+   only handed to the kernel at the next poll, together with any others
+   queued by then.  Returns false when there is no ring or no room in it,
+   leaving the caller to transfer synchronously.  */
+bool
+sched_submit (sched_t *sched, fiber_t *fiber, int fd, void *buf, size_t n,
+              bool write)
+{
+  if (!sched->ring)
+    return false;
+
+  uint64_t data = (uint64_t)(uintptr_t)fiber;
+  if (!(write ? uring_write (sched->ring, fd, buf, n, data)
+              : uring_read (sched->ring, fd, buf, n, data)))
+    return false;
+
+  fiber->io_state = FIBER_IO_Pending;
+  fiber->prev = NULL;
+  fiber->next = sched->inflight;
+  if (sched->inflight)
+    sched->inflight->prev = fiber;
+  sched->inflight = fiber;
+  sched->io_waiting++;
+  return true;
+}
+
+static void
+sched_complete (sched_t *sched)
+{
+  uint64_t data;
+  int32_t res;
+  while (uring_reap (sched->ring, &data, &res))
+    {
+      fiber_t *fiber = (fiber_t *)(uintptr_t)data;
+      if (fiber->prev)
+        fiber->prev->next = fiber->next;
+      else
+        sched->inflight = fiber->next;
+      if (fiber->next)
+        fiber->next->prev = fiber->prev;
+      fiber->prev = NULL;
+
+      fiber->io_state = FIBER_IO_Complete;
+      fiber->io_res = res;
+      sched->io_waiting--;
+      sched_ready (sched, fiber);
+    }
+}
+
+static void
+sched_poll (sched_t *sched, heap_t *heap, int timeout)
+{
+  struct epoll_event events[SCHED_MAX_EVENTS];
+  if (sched->ring && uring_submit (sched->ring) < 0 && errno != EAGAIN
+      && errno != EBUSY)
+    raise_runtime_error ("io_uring submission failed");
+
+  if (timeout)
+    heap_block (heap);
+  int n = epoll_wait (sched->epfd, events, SCHED_MAX_EVENTS, timeout);
+  if (timeout)
+    heap_unblock (heap);
+  if (n < 0 && errno != EINTR)
+    raise_runtime_error ("epoll_wait failed");
+
+  for (int i = 0; i < n; i++)
+    {
+      int fd = events[i].data.fd;
+      if (sched->ring && fd == sched->ring->fd)
+        {
+          sched_complete (sched);
+          continue;
+        }
+      sched_ready (sched, sched->io[fd]);
+      sched->io[fd] = NULL;
+      sched->io_waiting--;
+    }
+}
+
+static void
+sched_expire (sched_t *sched)
+{
+  if (!sched->timers_count)
+    return;
+
+  uint64_t now = sched_now ();
+  while (sched->timers_count && sched->timers[0]->wake <= now)
+    sched_ready (sched, timers_pop (sched));
+}
+
+/* Pick the next fiber to run, blocking in epoll until a sleeper is due or
+   a descriptor becomes ready.  Descriptors are also polled every few
+   switches so busy fibers cannot starve those waiting on I/O.  The thread
+   counts as parked on HEAP while it blocks.  Returns NULL when nothing is
+   runnable and nothing can become so.  */
+fiber_t *
+sched_next (sched_t *sched, heap_t *heap)
+{
+  if (sched->io_waiting && ++sched->ticks % SCHED_POLL_INTERVAL == 0)
+    sched_poll (sched, heap, 0);
+
+  for (;;)
+    {
+      sched_expire (sched);
+      fiber_t *fiber = channel_dequeue (&sched->ready, &sched->ready_tail);
+      if (fiber)
+        return fiber;
+      if (!sched->timers_count && !sched->io_waiting)
+        return NULL;
+
+      int timeout = -1;
+      if (sched->timers_count)
+        {
+          uint64_t now = sched_now ();
+          uint64_t wake = sched->timers[0]->wake;
+          timeout = wake > now ? (int)((wake - now + 999999) / 1000000) : 0;
+        }
+      sched_poll (sched, heap, timeout);
+    }
+}
+
+void
+channel_enqueue (fiber_t **head, fiber_t **tail, fiber_t *fiber)
+{
+  fiber->next = NULL;
+  if (*tail)
+    (*tail)->next = fiber;
+  else
+    *head = fiber;
+  *tail = fiber;
+}
+
+fiber_t *
+channel_dequeue (fiber_t **head, fiber_t **tail)
+{
+  fiber_t *fiber = *head;
+  if (!fiber)
+    return NULL;
+
+  *head = fiber->next;
+  if (!*head)
+    *tail = NULL;
+  fiber->next = NULL;
+  return fiber;
+}
@@ -0,0 +1,92 @@
+#ifndef FIBER_H
+#define FIBER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "heap.h"
+#include "object.h"
+#include "uring.h"
+
+typedef struct Scheduler sched_t;
+
+enum FiberIO
+{
+  FIBER_IO_Idle,
+  FIBER_IO_Pending,
+  FIBER_IO_Complete,
+};
+
+/* A lightweight thread.  RESUME is the one-shot continuation it is parked
+   in, or the thunk it starts with; VALUE is delivered to it on resumption.
+   MESSAGE holds the value of a pending channel send and IO_DONE the
+   progress of a partial write, so a retried operation picks up where it
+   left off.  A transfer submitted to the scheduler's ring moves IO_STATE
+   from pending to complete, with its result in IO_RES; IO_BUF keeps the
+   bytevector the kernel reads into alive meanwhile.  */
+struct Fiber
+{
+  object_t *resume;
+  object_t *value;
+  object_t *message;
+  bool started;
+  uint64_t wake;
+  size_t io_done;
+  enum FiberIO io_state;
+  int32_t io_res;
+  object_t *io_buf;
+  fiber_t *prev;
+  fiber_t *next;
+};
+
+/* Fibers are scheduled cooperatively on one OS thread.  Runnable fibers
+   wait in a FIFO, sleepers in a min-heap ordered by wake time, and fibers
+   blocked on a descriptor are registered with epoll until it is ready and
+   are kept in IO, indexed by descriptor, meanwhile.  Where the kernel
+   supports it reads and writes go through RING instead: fibers waiting on
+   those are linked on INFLIGHT, the submissions of a whole round of
+   fibers go to the kernel in one call, and the ring's own descriptor is
+   registered with epoll to signal completions.  IO_WAITING counts fibers
+   blocked either way.  MAIN is the toplevel fiber once it has reached
+   `halt'; it is resumed when no other fiber can run any more.  */
+struct Scheduler
+{
+  fiber_t *current;
+  fiber_t *ready, *ready_tail;
+  fiber_t **timers;
+  size_t timers_size;
+  size_t timers_count;
+  int epfd;
+  fiber_t **io;
+  size_t io_size;
+  size_t io_waiting;
+  uring_t *ring;
+  fiber_t *inflight;
+  size_t ticks;
+  fiber_t *main;
+  object_t *start;
+  object_t *exit;
+};
+
+uint64_t sched_now (void);
+
+sched_t *sched_new (void);
+void sched_delete (sched_t *sched);
+
+fiber_t *fiber_new (object_t *resume);
+void fiber_delete (fiber_t *fiber);
+
+void sched_ready (sched_t *sched, fiber_t *fiber);
+void sched_sleep (sched_t *sched, fiber_t *fiber, uint64_t ns);
+void sched_wait_fd (sched_t *sched, fiber_t *fiber, int fd, bool write);
+bool sched_submit (sched_t *sched, fiber_t *fiber, int fd, void *buf,
+                   size_t n, bool write);
+fiber_t *sched_next (sched_t *sched, heap_t *heap);
+void sched_mark (sched_t *sched);
+
+void fiber_mark (fiber_t *fiber);
+
+void channel_enqueue (fiber_t **head, fiber_t **tail, fiber_t *fiber);
+fiber_t *channel_dequeue (fiber_t **head, fiber_t **tail);
+
+#endif
@@ -1,54 +1,389 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "memory.h"
+#include "fiber.h"
+#include "heap.h"
+#include "object.h"
+#include "pool.h"
+#include "text.h"
 
 #define HEAP_GROWTH_FACTOR 0.88
+#define MARK_STACK_INITIAL_SIZE 1024
+
+static _Thread_local mutator_t *current_mutator;
+
+/* Objects marked but not yet scanned, on the thread that collects.  */
+static _Thread_local object_t **mark_stack;
+static _Thread_local size_t mark_count;
+static _Thread_local size_t mark_size;
+static _Thread_local bool marking;
 
 heap_t *
 heap_new (size_t size)
 {
-  heap_t *heap = malloc (sizeof (heap_t));
+  heap_t *heap = calloc (1, sizeof (heap_t));
   heap->roots = calloc (size, sizeof (object_t *));
-  heap->size = size;
-  heap->count = 0;
+  heap->roots_size = size;
+  heap->roots_count = 0;
+  heap->symbols = NULL;
+  heap->symbols_size = 0;
+  heap->symbols_count = 0;
+  pthread_mutex_init (&heap->lock, NULL);
+  pthread_cond_init (&heap->cond, NULL);
+  heap->budget = HEAP_INITIAL_CHUNKS * HEAP_CHUNK_OBJECTS;
+  atomic_init (&heap->stop, false);
+  atomic_init (&heap->collect, false);
+  atomic_init (&heap->mappings, 0);
   return heap;
 }
 
 void
 heap_delete (heap_t *heap)
 {
+  for (heap_chunk_t *chunk = heap->chunks; chunk;)
+    {
+      heap_chunk_t *next = chunk->next;
+      for (size_t i = 0; i < chunk->used; i++)
+        if (chunk->objs[i].type != OBJ_Free)
+          object_release (&chunk->objs[i]);
+      free (chunk->objs);
+      free (chunk);
+      chunk = next;
+    }
+  if (current_mutator && current_mutator->heap == heap)
+    heap_detach (heap);
+
   free (heap->roots);
+  free (heap->symbols);
+  pthread_mutex_destroy (&heap->lock);
+  pthread_cond_destroy (&heap->cond);
   free (heap);
 }
 
+/* Pin OBJ for the lifetime of the heap.  */
 void
 heap_add_root (heap_t *heap, object_t *obj)
 {
-  if (heap->count / heap->size >= HEAP_GROWTH_FACTOR)
+  pthread_mutex_lock (&heap->lock);
+  if (heap->roots_count / heap->roots_size >= HEAP_GROWTH_FACTOR)
+    {
+      heap->roots_size *= 2;
+      heap->roots = realloc (heap->roots,
+                             heap->roots_size * sizeof (object_t *));
+    }
+  heap->roots[heap->roots_count++] = obj;
+  pthread_mutex_unlock (&heap->lock);
+}
+
+/* Register the calling thread as a mutator of HEAP.  MARK_ROOTS is called
+   with CTX during collections to mark what the thread keeps outside the
+   heap.  */
+mutator_t *
+heap_attach (heap_t *heap, void (*mark_roots) (void *ctx), void *ctx)
+{
+  mutator_t *m = calloc (1, sizeof (mutator_t));
+  m->heap = heap;
+  m->mark_roots = mark_roots;
+  m->ctx = ctx;
+
+  pthread_mutex_lock (&heap->lock);
+  while (atomic_load (&heap->stop))
+    pthread_cond_wait (&heap->cond, &heap->lock);
+  m->next = heap->mutators;
+  heap->mutators = m;
+  heap->mutators_count++;
+  pthread_mutex_unlock (&heap->lock);
+
+  current_mutator = m;
+  return m;
+}
+
+/* Cells left in the buffer go back to the heap as free cells.  */
+static void
+tlab_flush (mutator_t *m)
+{
+  for (object_t *obj = m->cur; obj < m->end; obj++)
+    obj->type = OBJ_Free;
+  m->cur = m->end = NULL;
+  m->free = NULL;
+}
+
+void
+heap_detach (heap_t *heap)
+{
+  mutator_t *m = current_mutator;
+  if (!m || m->heap != heap)
+    return;
+
+  pthread_mutex_lock (&heap->lock);
+  while (atomic_load (&heap->stop))
+    pthread_cond_wait (&heap->cond, &heap->lock);
+  tlab_flush (m);
+  for (mutator_t **p = &heap->mutators; *p; p = &(*p)->next)
+    if (*p == m)
+      {
+        *p = m->next;
+        break;
+      }
+  heap->mutators_count--;
+  pthread_cond_broadcast (&heap->cond);
+  pthread_mutex_unlock (&heap->lock);
+
+  free (m->ranges);
+  free (m);
+  current_mutator = NULL;
+}
+
+/* Root ranges nest like a shadow stack: C code holding objects in arrays
+   the collector cannot see pushes them and pops them when done.  */
+void
+heap_push_roots (heap_t *heap, object_t **slots, size_t n)
+{
+  mutator_t *m = current_mutator;
+  if (!m || m->heap != heap)
+    return;
+  if (m->ranges_count == m->ranges_size)
     {
-      heap->size *= 2;
-      heap->roots = realloc (heap->roots, heap->size * sizeof (object_t *));
+      m->ranges_size = m->ranges_size ? m->ranges_size * 2 : 8;
+      m->ranges = realloc (m->ranges, m->ranges_size * sizeof (root_range_t));
     }
-  heap->roots[heap->count++] = obj;
+  m->ranges[m->ranges_count++] = (root_range_t){ .slots = slots, .n = n };
+}
+
+void
+heap_pop_roots (heap_t *heap)
+{
+  mutator_t *m = current_mutator;
+  if (m && m->heap == heap && m->ranges_count)
+    m->ranges_count--;
+}
+
+/* Stop at a safepoint until the collection in progress is over.  */
+void
+heap_park (heap_t *heap)
+{
+  heap_block (heap);
+  heap_unblock (heap);
 }
 
+/* Blocking calls, such as waiting for I/O or for work, run as if parked so
+   they never hold up a collection; leaving one waits for it to finish.  */
+void
+heap_block (heap_t *heap)
+{
+  pthread_mutex_lock (&heap->lock);
+  if (current_mutator)
+    current_mutator->blocked = true;
+  heap->blocked++;
+  pthread_cond_broadcast (&heap->cond);
+  pthread_mutex_unlock (&heap->lock);
+}
+
+void
+heap_unblock (heap_t *heap)
+{
+  pthread_mutex_lock (&heap->lock);
+  while (atomic_load (&heap->stop))
+    pthread_cond_wait (&heap->cond, &heap->lock);
+  if (current_mutator)
+    current_mutator->blocked = false;
+  heap->blocked--;
+  pthread_mutex_unlock (&heap->lock);
+}
+
+/* Count N cells handed out, with the heap locked, and ask for a
+   collection once the budget is spent.  */
+static inline void
+tlab_charge (heap_t *heap, size_t n)
+{
+  heap->allocated += n;
+  if (heap->allocated > heap->budget)
+    atomic_store_explicit (&heap->collect, true, memory_order_relaxed);
+}
+
+/* Hand the calling thread a fresh buffer: reclaimed cells if there are
+   any, else a range carved from the newest chunk.  Taking the heap lock
+   once per buffer keeps it off the allocation fast path.  */
+static void
+tlab_refill (heap_t *heap, mutator_t *m)
+{
+  pthread_mutex_lock (&heap->lock);
+  if (heap->free)
+    {
+      object_t *last = heap->free;
+      size_t n = 1;
+      for (; n < HEAP_TLAB_OBJECTS && last->next; n++)
+        last = last->next;
+      tlab_charge (heap, n);
+      m->free = heap->free;
+      heap->free = last->next;
+      last->next = NULL;
+      pthread_mutex_unlock (&heap->lock);
+      return;
+    }
+
+  heap_chunk_t *chunk = heap->chunks;
+  if (!chunk || chunk->used + HEAP_TLAB_OBJECTS > HEAP_CHUNK_OBJECTS)
+    {
+      chunk = malloc (sizeof (heap_chunk_t));
+      chunk->objs = calloc (HEAP_CHUNK_OBJECTS, sizeof (object_t));
+      chunk->used = 0;
+      chunk->next = heap->chunks;
+      heap->chunks = chunk;
+      heap->chunks_count++;
+    }
+  tlab_charge (heap, HEAP_TLAB_OBJECTS);
+  m->cur = &chunk->objs[chunk->used];
+  m->end = m->cur + HEAP_TLAB_OBJECTS;
+  for (object_t *obj = m->cur; obj < m->end; obj++)
+    obj->type = OBJ_Free;
+  chunk->used += HEAP_TLAB_OBJECTS;
+  pthread_mutex_unlock (&heap->lock);
+}
+
+/* Put the cells left in a buffer back on the heap free list, with the
+   heap locked.  */
+static void
+tlab_return (heap_t *heap, mutator_t *m)
+{
+  for (object_t *obj = m->free; obj;)
+    {
+      object_t *next = obj->next;
+      obj->next = heap->free;
+      heap->free = obj;
+      obj = next;
+    }
+  for (object_t *obj = m->cur; obj < m->end; obj++)
+    {
+      obj->type = OBJ_Free;
+      obj->next = heap->free;
+      heap->free = obj;
+    }
+  m->cur = m->end = NULL;
+  m->free = NULL;
+}
+
+/* Allocate a zeroed cell.  Threads that never attached to HEAP go through
+   a temporary buffer under the lock.  Allocation is not a safepoint: C
+   code routinely holds fresh objects in locals between allocations.  */
+object_t *
+heap_alloc (heap_t *heap)
+{
+  mutator_t *m = current_mutator;
+  if (!m || m->heap != heap)
+    {
+      mutator_t tmp = { .heap = heap };
+      tlab_refill (heap, &tmp);
+      object_t *obj = tmp.free ? tmp.free : tmp.cur++;
+      if (tmp.free)
+        tmp.free = tmp.free->next;
+      pthread_mutex_lock (&heap->lock);
+      tlab_return (heap, &tmp);
+      pthread_mutex_unlock (&heap->lock);
+      memset (obj, 0, sizeof (object_t));
+      return obj;
+    }
+
+  if (!m->free && m->cur == m->end)
+    tlab_refill (heap, m);
+
+  object_t *obj;
+  if (m->free)
+    {
+      obj = m->free;
+      m->free = obj->next;
+    }
+  else
+    obj = m->cur++;
+  memset (obj, 0, sizeof (object_t));
+  return obj;
+}
+
+/* Count a file mapping owned by an object of HEAP, asking for a
+   collection once enough have been made since the last.  */
+void
+heap_note_mapping (heap_t *heap)
+{
+  if (atomic_fetch_add_explicit (&heap->mappings, 1, memory_order_relaxed) + 1
+      >= HEAP_MAPPINGS_PER_COLLECTION)
+    atomic_store_explicit (&heap->collect, true, memory_order_relaxed);
+}
+
+/* Stop the world, mark from every root and sweep every chunk.  Reclaimed
+   cells, and those left in allocation buffers, go on the heap free list.  */
 void
 heap_collect (heap_t *heap)
 {
+  pthread_mutex_lock (&heap->lock);
+  while (atomic_load (&heap->stop))
+    {
+      if (current_mutator)
+        current_mutator->blocked = true;
+      heap->blocked++;
+      pthread_cond_broadcast (&heap->cond);
+      while (atomic_load (&heap->stop))
+        pthread_cond_wait (&heap->cond, &heap->lock);
+      heap->blocked--;
+      if (current_mutator)
+        current_mutator->blocked = false;
+    }
+
+  atomic_store_explicit (&heap->stop, true, memory_order_release);
+  size_t others = heap->mutators_count - (current_mutator ? 1 : 0);
+  while (heap->blocked < others)
+    pthread_cond_wait (&heap->cond, &heap->lock);
+
+  for (mutator_t *m = heap->mutators; m; m = m->next)
+    {
+      for (object_t *obj = m->free; obj; obj = obj->next)
+        obj->type = OBJ_Free;
+      tlab_flush (m);
+    }
+
   for (size_t i = 0; i < heap->roots_count; i++)
-    gc_mark (heap->roots[i]);
-  for (size_t i = 0; i < heap->roots_count; i++)
-    gc_sweep (heap->roots[i]);
+    heap_mark (heap->roots[i]);
+  for (mutator_t *m = heap->mutators; m; m = m->next)
+    {
+      for (size_t r = 0; r < m->ranges_count; r++)
+        for (size_t i = 0; i < m->ranges[r].n; i++)
+          heap_mark (m->ranges[r].slots[i]);
+      if (m->mark_roots)
+        m->mark_roots (m->ctx);
+    }
+  object_prune_symbols (heap);
+  size_t live = heap_sweep (heap);
+  atomic_store_explicit (&heap->mappings, 0, memory_order_relaxed);
+  heap->allocated = 0;
+  heap->budget = live > HEAP_INITIAL_CHUNKS * HEAP_CHUNK_OBJECTS
+                     ? live
+                     : HEAP_INITIAL_CHUNKS * HEAP_CHUNK_OBJECTS;
+
+  atomic_store_explicit (&heap->stop, false, memory_order_release);
+  pthread_cond_broadcast (&heap->cond);
+  pthread_mutex_unlock (&heap->lock);
 }
 
 void
-heap_mark (object_t *obj)
+heap_mark_stack (stack_t *stk)
+{
+  for (; stk; stk = stk->link ? stk->link->v_stack : NULL)
+    {
+      for (size_t i = 0; i < stk->count; i++)
+        heap_mark (stk->objs[i]);
+      if (stk->link)
+        {
+          if (stk->link->marked)
+            break;
+          stk->link->marked = true;
+        }
+    }
+}
+
+/* Scan the fields of OBJ, which is already marked.  The objects they
+   refer to are only pushed on the mark stack.  */
+static void
+mark_fields (object_t *obj)
 {
-  if (!obj)
-    return;
-  object_t *next = obj->next;
-  obj->marked = true;
   switch (obj->type)
     {
     case OBJ_Pair:
@@ -60,11 +395,61 @@ heap_mark (object_t *obj)
         heap_mark (obj->v_vector->vals[i]);
       break;
     case OBJ_Stack:
-      for (size_t i = 0; i < obj->v_stack->count; i++)
-        heap_mark (obj->v_stack->objs[i]);
+      heap_mark_stack (obj->v_stack);
+      break;
+    case OBJ_Conti:
+      heap_mark (obj->v_conti->captured_stack);
+      break;
+    case OBJ_Future:
+      heap_mark (obj->v_future->fn);
+      heap_mark (obj->v_future->value);
+      break;
+    case OBJ_Channel:
+      for (size_t i = 0; i < obj->v_channel->count; i++)
+        heap_mark (obj->v_channel->buf[(obj->v_channel->head + i)
+                                       % obj->v_channel->capacity]);
+      fiber_mark (obj->v_channel->senders);
+      fiber_mark (obj->v_channel->receivers);
+      break;
+    case OBJ_Synobj:
+      heap_mark (obj->v_synobj->datum);
+      heap_mark (obj->v_synobj->env);
+      break;
+    case OBJ_Procedure:
+      heap_mark (obj->v_procedure->value);
+      break;
+    case OBJ_Formal:
+      heap_mark (obj->v_formal->value);
+      break;
+    case OBJ_Closure:
+      heap_mark (obj->v_closure->formals);
+      heap_mark (obj->v_closure->env);
+      heap_mark (obj->v_closure->body);
+      for (size_t i = 0; i < obj->v_closure->nfrees; i++)
+        heap_mark (obj->v_closure->frees[i]);
+      break;
+    case OBJ_Box:
+      heap_mark (obj->v_box->value);
+      break;
+    case OBJ_Port:
+      heap_mark (obj->v_port->shared);
+      break;
+    case OBJ_String:
+      string_mark (obj->v_string);
+      break;
+    case OBJ_Dispatch:
+      for (size_t i = 0; i < obj->v_dispatch->size; i++)
+        {
+          dispatch_entry_t *e = &obj->v_dispatch->entries[i];
+          heap_mark (e->code);
+          if (e->code && e->type == OBJ_Symbol)
+            heap_mark ((object_t *)e->key);
+        }
+      for (size_t i = 0; i < obj->v_dispatch->dense_span; i++)
+        heap_mark (obj->v_dispatch->dense[i]);
       break;
     case OBJ_Environ:
-      for (size_t i = 0; i obj->v_environ->size; i++)
+      for (size_t i = 0; i < obj->v_environ->size; i++)
         {
           for (entry_t *e = obj->v_environ->entries[i]; e; e = e->next)
             {
@@ -80,19 +465,57 @@ heap_mark (object_t *obj)
       break;
     }
 
-  heap_mark (next);
+  heap_mark (obj->next);
 }
 
+/* Marking pushes each newly marked object on a stack of objects still to
+   be scanned, and only the outermost call scans them, so marking a long
+   list or a deep tree takes no more C stack than a short one.  */
 void
-heap_sweep (object_t *obj)
+heap_mark (object_t *obj)
 {
-  if (!obj)
+  if (!obj || STACK_IS_INDEX (obj) || obj->marked)
     return;
+  obj->marked = true;
 
-  object_t *next = obj->next;
-  if (!obj->marked)
-    object_delete (obj);
-  else
-    obj->marked = false;
-  heap_sweep (next);
+  if (mark_count == mark_size)
+    {
+      mark_size = mark_size ? mark_size * 2 : MARK_STACK_INITIAL_SIZE;
+      mark_stack = realloc (mark_stack, mark_size * sizeof (object_t *));
+    }
+  mark_stack[mark_count++] = obj;
+  if (marking)
+    return;
+
+  marking = true;
+  while (mark_count)
+    mark_fields (mark_stack[--mark_count]);
+  marking = false;
+}
+
+/* Free every unmarked object and return how many survived.  */
+size_t
+heap_sweep (heap_t *heap)
+{
+  size_t live = 0;
+  heap->free = NULL;
+  for (heap_chunk_t *chunk = heap->chunks; chunk; chunk = chunk->next)
+    for (size_t i = 0; i < chunk->used; i++)
+      {
+        object_t *obj = &chunk->objs[i];
+        if (obj->type != OBJ_Free && obj->marked)
+          {
+            obj->marked = false;
+            live++;
+            continue;
+          }
+        if (obj->type != OBJ_Free)
+          {
+            object_release (obj);
+            obj->type = OBJ_Free;
+          }
+        obj->next = heap->free;
+        heap->free = obj;
+      }
+  return live;
 }
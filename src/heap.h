@@ -1,25 +1,139 @@
-#ifndef MEMORY_H
-#define MEMORY_H
+#ifndef HEAP_H
+#define HEAP_H
 
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-#include "object.h"
+/* Only pointers to these are needed here; object.h, which includes this
+   header, defines them.  */
+typedef struct Object object_t;
+typedef struct Stack stack_t;
 
-typedef struct Heap
+#define HEAP_CHUNK_OBJECTS 16384
+#define HEAP_TLAB_OBJECTS 256
+#define HEAP_INITIAL_CHUNKS 4
+#define HEAP_MAPPINGS_PER_COLLECTION 8192
+
+typedef struct Heap heap_t;
+typedef struct HeapChunk heap_chunk_t;
+typedef struct Mutator mutator_t;
+typedef struct RootRange root_range_t;
+
+/* Objects are carved from large shared chunks.  USED counts the cells
+   handed out so far, whether allocated or still sitting in some thread's
+   allocation buffer.  */
+struct HeapChunk
+{
+  heap_chunk_t *next;
+  size_t used;
+  object_t *objs;
+};
+
+struct RootRange
+{
+  object_t **slots;
+  size_t n;
+};
+
+/* A thread allocating on a heap.  Its allocation buffer is either a bump
+   range [CUR, END) or a list of reclaimed cells, refilled from the heap
+   a buffer at a time.  Its roots are the ranges it pushed plus whatever
+   MARK_ROOTS marks for it, such as the registers and stack of the
+   interpreter it runs.  BLOCKED is set while it is parked at a safepoint or
+   inside a blocking call, where it does not touch the heap.  */
+struct Mutator
+{
+  heap_t *heap;
+  object_t *cur, *end;
+  object_t *free;
+  root_range_t *ranges;
+  size_t ranges_count;
+  size_t ranges_size;
+  void (*mark_roots) (void *ctx);
+  void *ctx;
+  bool blocked;
+  mutator_t *next;
+};
+
+/* ROOTS pins objects for the heap's whole life.  SYMBOLS, the table of
+   interned symbols, pins nothing: a collection drops the unmarked ones.
+   STOP asks every mutator to park at its next safepoint; the collector
+   proceeds once BLOCKED counts all mutators but itself.  COLLECT is
+   raised once allocation buffers have been handed more than BUDGET cells
+   since the last collection, ALLOCATED counting them; each collection
+   sets the budget to the number of objects that survived it, so the heap
+   settles at about twice its live data however much garbage is made.  It
+   is also raised every HEAP_MAPPINGS_PER_COLLECTION file mappings counted
+   in MAPPINGS, since a process runs out of mappings long before a few
+   small mapped objects would fill the heap.  */
+struct Heap
 {
   object_t **roots;
   size_t roots_size;
   size_t roots_count;
-} heap_t;
+  object_t **symbols;
+  size_t symbols_size;
+  size_t symbols_count;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  heap_chunk_t *chunks;
+  size_t chunks_count;
+  size_t allocated;
+  size_t budget;
+  object_t *free;
+  mutator_t *mutators;
+  size_t mutators_count;
+  size_t blocked;
+  atomic_bool stop;
+  atomic_bool collect;
+  atomic_size_t mappings;
+};
 
 heap_t *heap_new (size_t size);
 void heap_delete (heap_t *heap);
 void heap_add_root (heap_t *heap, object_t *obj);
 void heap_collect (heap_t *heap);
-void heap_mark (heap_t *heap);
-void heap_sweep (heap_t *heap);
+void heap_note_mapping (heap_t *heap);
+void heap_mark (object_t *obj);
+void heap_mark_stack (stack_t *stk);
+size_t heap_sweep (heap_t *heap);
+
+object_t *heap_alloc (heap_t *heap);
+
+mutator_t *heap_attach (heap_t *heap, void (*mark_roots) (void *ctx),
+                        void *ctx);
+void heap_detach (heap_t *heap);
+void heap_push_roots (heap_t *heap, object_t **slots, size_t n);
+void heap_pop_roots (heap_t *heap);
+
+void heap_park (heap_t *heap);
+void heap_block (heap_t *heap);
+void heap_unblock (heap_t *heap);
+
+/* Safepoint poll, cheap enough for the VM loop.  Callers must have made
+   every object they hold reachable from their mutator's roots first.  */
+static inline void
+heap_safepoint (heap_t *heap)
+{
+  if (atomic_load_explicit (&heap->stop, memory_order_acquire))
+    heap_park (heap);
+}
+
+/* Run the collection allocation has asked for, if no other thread has
+   taken it on.  Allocation itself never collects, since its callers hold
+   fresh objects the collector cannot see; callers of this have rooted
+   everything they hold, as for a safepoint.  */
+static inline void
+heap_maybe_collect (heap_t *heap)
+{
+  if (atomic_load_explicit (&heap->collect, memory_order_relaxed)
+      && atomic_exchange_explicit (&heap->collect, false,
+                                   memory_order_relaxed))
+    heap_collect (heap);
+}
 
 #endif
@@ -1,5 +1,86 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "builtin.h"
 #include "eval.h"
+#include "interp.h"
+#include "isolate.h"
 #include "object.h"
+#include "pool.h"
 #include "reader.h"
 
+_Thread_local interp_t *current_interp;
+_Thread_local heap_t *current_heap;
+_Thread_local object_t *object_nil;
+_Thread_local object_t *object_true;
+_Thread_local object_t *object_false;
+
+interp_t *
+interp_new (void)
+{
+  interp_t *interp = calloc (1, sizeof (interp_t));
+  interp->heap = heap_new (INTERP_HEAP_SIZE);
+  current_interp = interp;
+  current_heap = interp->heap;
+  heap_attach (interp->heap, eval_mark_roots, interp);
+
+  object_nil = object_new_nil (interp->heap);
+  object_true = object_new_bool (true, interp->heap);
+  object_false = object_new_bool (false, interp->heap);
+  heap_add_root (interp->heap, object_nil);
+  heap_add_root (interp->heap, object_true);
+  heap_add_root (interp->heap, object_false);
+
+  interp->stack_object = object_new_stack (INTERP_STACK_SIZE, interp->heap);
+  interp->stack = interp->stack_object->v_stack;
+  interp->toplevel
+      = object_new_environ (NULL, INTERP_ENVIRON_SIZE, interp->heap);
+  interp->environ = interp->toplevel->v_environ;
+  builtin_install (interp->environ, interp->heap);
+  interp->accumulator = object_nil;
+  interp->fuel = INTMAX_MAX;
+  return interp;
+}
+
+/* An interpreter for another thread that shares PARENT's heap and toplevel
+   but runs on a stack of its own.  It must be created on the thread that
+   will run it, which it registers as a mutator of the heap.  */
+interp_t *
+interp_fork (interp_t *parent)
+{
+  interp_t *interp = calloc (1, sizeof (interp_t));
+  interp->parent = parent;
+  interp->heap = parent->heap;
+  current_interp = interp;
+  heap_attach (interp->heap, eval_mark_roots, interp);
+  interp->stack_object
+      = object_new_stack (INTERP_STACK_SIZE, interp->heap);
+  interp->stack = interp->stack_object->v_stack;
+  interp->toplevel = parent->toplevel;
+  interp->environ = parent->environ;
+  interp->accumulator = object_nil;
+  interp->fuel = INTMAX_MAX;
+  return interp;
+}
 
+void
+interp_delete (interp_t *interp)
+{
+  if (interp->pool)
+    pool_delete (interp->pool);
+  if (interp->sched)
+    sched_delete (interp->sched);
+  heap_detach (interp->heap);
+  if (interp->parent)
+    {
+      free (interp);
+      return;
+    }
+  heap_delete (interp->heap);
+  isolate_release_current ();
+  if (current_heap == interp->heap)
+    current_heap = NULL;
+  if (current_interp == interp)
+    current_interp = NULL;
+  free (interp);
+}
@@ -0,0 +1,25 @@
+#ifndef INTERP_H
+#define INTERP_H
+
+#include "eval.h"
+#include "heap.h"
+#include "object.h"
+
+#define INTERP_HEAP_SIZE 4096
+#define INTERP_STACK_SIZE 256
+#define INTERP_ENVIRON_SIZE 256
+
+/* Each OS thread runs at most one interpreter, so it, its heap and the
+   shared constants are thread-local rather than process-wide.  They are
+   set up by interp_new on the thread that will run the interpreter.  */
+extern _Thread_local interp_t *current_interp;
+extern _Thread_local heap_t *current_heap;
+extern _Thread_local object_t *object_nil;
+extern _Thread_local object_t *object_true;
+extern _Thread_local object_t *object_false;
+
+interp_t *interp_new (void);
+interp_t *interp_fork (interp_t *parent);
+void interp_delete (interp_t *interp);
+
+#endif
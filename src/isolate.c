@@ -0,0 +1,473 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "bignum.h"
+#include "eval.h"
+#include "interp.h"
+#include "isolate.h"
+#include "numvec.h"
+#include "text.h"
+#include "utils.h"
+
+#define MESSAGE_INITIAL_SIZE 64
+
+#define MSG_Nil 'n'
+#define MSG_Bool 'b'
+#define MSG_Integer 'i'
+#define MSG_Real 'r'
+#define MSG_Complex 'z'
+#define MSG_Character 'c'
+#define MSG_String 's'
+#define MSG_Symbol 'y'
+#define MSG_List 'l'
+#define MSG_Bytevector 'v'
+#define MSG_Bignum 'B'
+#define MSG_Numvector 'h'
+
+typedef struct
+{
+  uint8_t *buf;
+  size_t size;
+  size_t len;
+} encoder_t;
+
+static _Thread_local isolate_t *isolate_self;
+
+static void
+encode_bytes (encoder_t *enc, const void *src, size_t n)
+{
+  if (enc->len + n > enc->size)
+    {
+      while (enc->len + n > enc->size)
+        enc->size *= 2;
+      enc->buf = realloc (enc->buf, enc->size);
+    }
+  memcpy (enc->buf + enc->len, src, n);
+  enc->len += n;
+}
+
+static inline void
+encode_tag (encoder_t *enc, uint8_t tag)
+{
+  encode_bytes (enc, &tag, 1);
+}
+
+static void
+encode_text (encoder_t *enc, uint8_t tag, const char32_t *text)
+{
+  size_t len = u32strlen (text);
+  encode_tag (enc, tag);
+  encode_bytes (enc, &len, sizeof (len));
+  encode_bytes (enc, text, len * sizeof (char32_t));
+}
+
+/* Lists are written as their length, elements and final tail so decoding
+   long lists does not recurse along the spine.  */
+static void
+encode (encoder_t *enc, object_t *obj)
+{
+  switch (obj->type)
+    {
+    case OBJ_Nil:
+      encode_tag (enc, MSG_Nil);
+      break;
+    case OBJ_Bool:
+      encode_tag (enc, MSG_Bool);
+      encode_bytes (enc, &obj->v_bool, sizeof (bool));
+      break;
+    case OBJ_Integer:
+      encode_tag (enc, MSG_Integer);
+      encode_bytes (enc, &obj->v_integer, sizeof (intmax_t));
+      break;
+    case OBJ_Bignum:
+      encode_tag (enc, MSG_Bignum);
+      encode_bytes (enc, &obj->v_bignum->negative, sizeof (bool));
+      encode_bytes (enc, &obj->v_bignum->size, sizeof (size_t));
+      encode_bytes (enc, obj->v_bignum->limbs,
+                    obj->v_bignum->size * sizeof (uint64_t));
+      break;
+    case OBJ_Real:
+      encode_tag (enc, MSG_Real);
+      encode_bytes (enc, &obj->v_real, sizeof (double));
+      break;
+    case OBJ_Complex:
+      encode_tag (enc, MSG_Complex);
+      encode_bytes (enc, &obj->v_complex, sizeof (double complex));
+      break;
+    case OBJ_Character:
+      encode_tag (enc, MSG_Character);
+      encode_bytes (enc, &obj->v_char, sizeof (char32_t));
+      break;
+    case OBJ_String:
+      encode_tag (enc, MSG_String);
+      encode_bytes (enc, &obj->v_string->size, sizeof (size_t));
+      encode_bytes (enc, string_bytes (obj->v_string), obj->v_string->size);
+      break;
+    case OBJ_Symbol:
+      encode_text (enc, MSG_Symbol, obj->v_symbol->id);
+      break;
+    case OBJ_Bytevector:
+      encode_tag (enc, MSG_Bytevector);
+      encode_bytes (enc, &obj->v_bytevector->count, sizeof (size_t));
+      encode_bytes (enc, obj->v_bytevector->vals, obj->v_bytevector->count);
+      break;
+    case OBJ_Numvector:
+      {
+        numvector_t *nv = obj->v_numvector;
+        uint8_t type = nv->type;
+        encode_tag (enc, MSG_Numvector);
+        encode_bytes (enc, &type, 1);
+        encode_bytes (enc, &nv->count, sizeof (size_t));
+        encode_bytes (enc, nv->vals, nv->count * numvec_width (nv->type));
+      }
+      break;
+    case OBJ_Pair:
+      {
+        size_t n = 0;
+        object_t *tail = obj;
+        for (; tail->type == OBJ_Pair; tail = cdr (tail))
+          n++;
+
+        encode_tag (enc, MSG_List);
+        encode_bytes (enc, &n, sizeof (n));
+        for (object_t *p = obj; p->type == OBJ_Pair; p = cdr (p))
+          encode (enc, car (p));
+        encode (enc, tail);
+      }
+      break;
+    default:
+      raise_runtime_error ("Value cannot be sent to another isolate");
+    }
+}
+
+message_t *
+message_encode (object_t *obj)
+{
+  encoder_t enc = { .buf = malloc (MESSAGE_INITIAL_SIZE),
+                    .size = MESSAGE_INITIAL_SIZE,
+                    .len = 0 };
+  encode (&enc, obj);
+
+  message_t *msg = malloc (sizeof (message_t) + enc.len);
+  atomic_init (&msg->next, NULL);
+  msg->size = enc.len;
+  memcpy (msg->data, enc.buf, enc.len);
+  free (enc.buf);
+  return msg;
+}
+
+static object_t *
+decode (const uint8_t **p, heap_t *heap)
+{
+  uint8_t tag = *(*p)++;
+  switch (tag)
+    {
+    case MSG_Nil:
+      return object_nil;
+    case MSG_Bool:
+      {
+        bool b;
+        memcpy (&b, *p, sizeof (b));
+        *p += sizeof (b);
+        return b ? object_true : object_false;
+      }
+    case MSG_Integer:
+      {
+        intmax_t i;
+        memcpy (&i, *p, sizeof (i));
+        *p += sizeof (i);
+        return object_new_integer (i, heap);
+      }
+    case MSG_Bignum:
+      {
+        bignum_t *b = malloc (sizeof (bignum_t));
+        memcpy (&b->negative, *p, sizeof (bool));
+        *p += sizeof (bool);
+        memcpy (&b->size, *p, sizeof (size_t));
+        *p += sizeof (size_t);
+        b->limbs = malloc (b->size * sizeof (uint64_t));
+        memcpy (b->limbs, *p, b->size * sizeof (uint64_t));
+        *p += b->size * sizeof (uint64_t);
+        return object_new_bignum (b, heap);
+      }
+    case MSG_Real:
+      {
+        double d;
+        memcpy (&d, *p, sizeof (d));
+        *p += sizeof (d);
+        return object_new_real (d, heap);
+      }
+    case MSG_Complex:
+      {
+        double complex z;
+        memcpy (&z, *p, sizeof (z));
+        *p += sizeof (z);
+        return object_new_complex (z, heap);
+      }
+    case MSG_Character:
+      {
+        char32_t ch;
+        memcpy (&ch, *p, sizeof (ch));
+        *p += sizeof (ch);
+        return object_new_character (ch, heap);
+      }
+    case MSG_String:
+      {
+        size_t n;
+        memcpy (&n, *p, sizeof (n));
+        *p += sizeof (n);
+        object_t *str = object_new_string_utf8 (*p, n, heap);
+        *p += n;
+        return str;
+      }
+    case MSG_Symbol:
+      {
+        size_t len;
+        memcpy (&len, *p, sizeof (len));
+        *p += sizeof (len);
+        char32_t *text = malloc ((len + 1) * sizeof (char32_t));
+        memcpy (text, *p, len * sizeof (char32_t));
+        text[len] = U'\0';
+        *p += len * sizeof (char32_t);
+
+        object_t *obj = object_intern_symbol (text, len, heap);
+        free (text);
+        return obj;
+      }
+    case MSG_Bytevector:
+      {
+        size_t n;
+        memcpy (&n, *p, sizeof (n));
+        *p += sizeof (n);
+        object_t *bv = object_new_bytevector (n, heap);
+        memcpy (bv->v_bytevector->vals, *p, n);
+        bv->v_bytevector->count = n;
+        *p += n;
+        return bv;
+      }
+    case MSG_Numvector:
+      {
+        enum NumvecType type = **p;
+        size_t n;
+        memcpy (&n, *p + 1, sizeof (n));
+        *p += 1 + sizeof (n);
+        numvector_t *nv = numvec_new (type, n);
+        memcpy (nv->vals, *p, n * numvec_width (type));
+        *p += n * numvec_width (type);
+        return object_new_numvector (nv, heap);
+      }
+    case MSG_List:
+      {
+        size_t n;
+        memcpy (&n, *p, sizeof (n));
+        *p += sizeof (n);
+
+        object_t *head = NULL, *last = NULL;
+        for (size_t i = 0; i < n; i++)
+          {
+            object_t *cell = object_new_pair (decode (p, heap), NULL, heap);
+            if (last)
+              last->v_pair->rest = cell;
+            else
+              head = cell;
+            last = cell;
+          }
+        last->v_pair->rest = decode (p, heap);
+        return head;
+      }
+    default:
+      raise_runtime_error ("Corrupt isolate message");
+    }
+  return object_nil;
+}
+
+object_t *
+message_decode (message_t *msg, heap_t *heap)
+{
+  const uint8_t *p = msg->data;
+  return decode (&p, heap);
+}
+
+void
+mailbox_push (mailbox_t *mb, message_t *msg)
+{
+  atomic_store_explicit (&msg->next, NULL, memory_order_relaxed);
+  message_t *prev
+      = atomic_exchange_explicit (&mb->head, msg, memory_order_acq_rel);
+  atomic_store_explicit (&prev->next, msg, memory_order_release);
+}
+
+/* Returns NULL when the mailbox is empty, and also while a producer is
+   between its swap and its link; that producer's eventfd bump follows.  */
+message_t *
+mailbox_pop (mailbox_t *mb)
+{
+  message_t *tail = mb->tail;
+  message_t *next = atomic_load_explicit (&tail->next, memory_order_acquire);
+  if (tail == mb->stub)
+    {
+      if (!next)
+        return NULL;
+      mb->tail = next;
+      tail = next;
+      next = atomic_load_explicit (&tail->next, memory_order_acquire);
+    }
+  if (next)
+    {
+      mb->tail = next;
+      return tail;
+    }
+  if (tail != atomic_load_explicit (&mb->head, memory_order_acquire))
+    return NULL;
+
+  mailbox_push (mb, mb->stub);
+  next = atomic_load_explicit (&tail->next, memory_order_acquire);
+  if (next)
+    {
+      mb->tail = next;
+      return tail;
+    }
+  return NULL;
+}
+
+static isolate_t *
+isolate_alloc (size_t refs)
+{
+  isolate_t *iso = calloc (1, sizeof (isolate_t));
+  atomic_init (&iso->refs, refs);
+  atomic_init (&iso->done, false);
+  iso->inbox.stub = malloc (sizeof (message_t));
+  atomic_init (&iso->inbox.stub->next, NULL);
+  iso->inbox.stub->size = 0;
+  atomic_init (&iso->inbox.head, iso->inbox.stub);
+  iso->inbox.tail = iso->inbox.stub;
+  iso->inbox.efd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+  iso->done_fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (iso->inbox.efd < 0 || iso->done_fd < 0)
+    raise_runtime_error ("Could not create isolate");
+  return iso;
+}
+
+/* The isolate running on this thread.  The main thread gets a handle the
+   first time it asks, so children can reply to it.  */
+isolate_t *
+isolate_current (void)
+{
+  if (!isolate_self)
+    isolate_self = isolate_alloc (1);
+  return isolate_self;
+}
+
+/* Give up the handle isolate_current made for a thread that was not
+   started as an isolate, once that thread's interpreter is gone.
+   Children still running keep it alive through their parent reference.  */
+void
+isolate_release_current (void)
+{
+  if (isolate_self && !isolate_self->threaded)
+    {
+      isolate_release (isolate_self);
+      isolate_self = NULL;
+    }
+}
+
+/* An error in the program ends the isolate, not the process: the joiner
+   raises it instead.  */
+static void *
+isolate_main (void *arg)
+{
+  isolate_t *iso = arg;
+  isolate_self = iso;
+
+  interp_t *interp = interp_new ();
+  error_handler_t h;
+  if (ERROR_CATCH (&h))
+    iso->error = strdup (h.message);
+  else
+    {
+      object_t *program = message_decode (iso->program, interp->heap);
+      iso->result = message_encode (eval (interp, program));
+      error_pop (&h);
+    }
+  free (iso->program);
+  iso->program = NULL;
+  interp_delete (interp);
+
+  atomic_store (&iso->done, true);
+  eventfd_write (iso->done_fd, 1);
+  isolate_self = NULL;
+  isolate_release (iso);
+  return NULL;
+}
+
+isolate_t *
+isolate_spawn (object_t *program)
+{
+  isolate_t *iso = isolate_alloc (2);
+  iso->parent = isolate_current ();
+  isolate_retain (iso->parent);
+  iso->program = message_encode (program);
+
+  iso->threaded = true;
+  if (pthread_create (&iso->thread, NULL, isolate_main, iso))
+    {
+      iso->threaded = false;
+      raise_runtime_error ("Could not start isolate thread");
+    }
+  return iso;
+}
+
+void
+isolate_retain (isolate_t *iso)
+{
+  atomic_fetch_add (&iso->refs, 1);
+}
+
+void
+isolate_release (isolate_t *iso)
+{
+  if (atomic_fetch_sub (&iso->refs, 1) != 1)
+    return;
+
+  if (iso->threaded && !iso->joined)
+    pthread_detach (iso->thread);
+  if (iso->parent)
+    isolate_release (iso->parent);
+
+  message_t *msg;
+  while ((msg = mailbox_pop (&iso->inbox)))
+    free (msg);
+  free (iso->inbox.stub);
+  close (iso->inbox.efd);
+  close (iso->done_fd);
+  free (iso->program);
+  free (iso->result);
+  free (iso->error);
+  free (iso);
+}
+
+void
+isolate_post (isolate_t *iso, object_t *obj)
+{
+  mailbox_push (&iso->inbox, message_encode (obj));
+  eventfd_write (iso->inbox.efd, 1);
+}
+
+/* The caller must have seen DONE; the thread has then published its
+   result and the join returns at once.  */
+object_t *
+isolate_join (isolate_t *iso, heap_t *heap)
+{
+  if (!iso->threaded)
+    raise_runtime_error ("Cannot join the main isolate");
+  if (!iso->joined)
+    {
+      pthread_join (iso->thread, NULL);
+      iso->joined = true;
+    }
+  if (iso->error)
+    raise_runtime_error ("Isolate failed: %s", iso->error);
+  return message_decode (iso->result, heap);
+}
@@ -0,0 +1,71 @@
+#ifndef ISOLATE_H
+#define ISOLATE_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "heap.h"
+#include "object.h"
+
+typedef struct Message message_t;
+typedef struct Mailbox mailbox_t;
+
+/* Values cross isolates as self-contained serialized copies, so no object
+   is ever shared between two heaps.  */
+struct Message
+{
+  _Atomic (message_t *) next;
+  size_t size;
+  uint8_t data[];
+};
+
+/* Intrusive multi-producer single-consumer queue (Vyukov): producers swap
+   themselves in at HEAD without locking and the owner pops from TAIL.
+   EFD is an eventfd bumped on every push so a consumer fiber can wait for
+   mail in the reactor.  */
+struct Mailbox
+{
+  _Atomic (message_t *) head;
+  message_t *tail;
+  message_t *stub;
+  int efd;
+};
+
+/* An interpreter running on its own OS thread with its own heap, stack and
+   toplevel.  Handles are reference counted across threads; the thread
+   itself holds one reference until it finishes, and a child holds one on
+   its parent.  PROGRAM is the datum the isolate evaluates and RESULT the
+   serialized value it produced, or ERROR the message of the error that
+   ended it instead; either is published through DONE_FD.  */
+struct Isolate
+{
+  atomic_size_t refs;
+  pthread_t thread;
+  bool threaded;
+  bool joined;
+  atomic_bool done;
+  mailbox_t inbox;
+  isolate_t *parent;
+  message_t *program;
+  message_t *result;
+  char *error;
+  int done_fd;
+};
+
+isolate_t *isolate_current (void);
+void isolate_release_current (void);
+isolate_t *isolate_spawn (object_t *program);
+void isolate_retain (isolate_t *iso);
+void isolate_release (isolate_t *iso);
+void isolate_post (isolate_t *iso, object_t *obj);
+object_t *isolate_join (isolate_t *iso, heap_t *heap);
+
+message_t *message_encode (object_t *obj);
+object_t *message_decode (message_t *msg, heap_t *heap);
+
+void mailbox_push (mailbox_t *mb, message_t *msg);
+message_t *mailbox_pop (mailbox_t *mb);
+
+#endif
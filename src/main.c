@@ -1,8 +1,82 @@
+#include <inttypes.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
-#include "memory.h"
-#include "types.h"
+#include "eval.h"
+#include "fiber.h"
+#include "heap.h"
+#include "interp.h"
+#include "object.h"
+#include "reader.h"
 #include "utils.h"
 
+/* Evaluate each datum of the files named on the command line in turn, all
+   in the one interpreter, so that earlier files can define what later ones
+   use.  An error is reported with the name of the file being evaluated and
+   ends the run with a nonzero status.  With -q, fibers are preempted every
+   QUANTUM calls and backward jumps, and a run that yields to the driver
+   with no other fiber ready is resumed at once.  With -t, the whole run
+   must finish within MILLISECONDS or it fails as if with an error.  */
+int
+main (int argc, char **argv)
+{
+  intmax_t quantum = 0;
+  uint64_t timeout = 0;
+  int opt;
+  while ((opt = getopt (argc, argv, "q:t:")) != -1)
+    switch (opt)
+      {
+      case 'q':
+        quantum = strtoimax (optarg, NULL, 10);
+        break;
+      case 't':
+        timeout = strtoull (optarg, NULL, 10) * 1000000u;
+        break;
+      default:
+        optind = argc;
+        break;
+      }
+  if (optind >= argc)
+    {
+      fprintf (stderr, "usage: %s [-q QUANTUM] [-t MILLISECONDS] FILE...\n",
+               argv[0]);
+      return 2;
+    }
 
+  interp_t *interp = interp_new ();
+  eval_set_budget (interp, quantum, timeout ? sched_now () + timeout : 0);
+  volatile int i = optind;
+
+  error_handler_t h;
+  if (ERROR_CATCH (&h))
+    {
+      fprintf (stderr, "%s: %s\n", argv[i], h.message);
+      return 1;
+    }
+
+  for (; i < argc; i++)
+    {
+      reader_t *rd = reader_open (argv[i], false, interp->heap);
+      object_t *datum;
+      while ((datum = reader_read (rd)))
+        {
+          heap_push_roots (interp->heap, &datum, 1);
+          eval (interp, datum);
+          while (interp->preempted == PREEMPT_Fuel)
+            eval_resume (interp);
+          heap_pop_roots (interp->heap);
+          if (interp->preempted == PREEMPT_Deadline)
+            {
+              fprintf (stderr, "%s: Deadline exceeded\n", argv[i]);
+              return 1;
+            }
+        }
+      reader_close (rd);
+    }
+
+  error_pop (&h);
+  interp_delete (interp);
+  return 0;
+}
@@ -0,0 +1,227 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define NUMVEC_AVX2 1
+#endif
+
+#include "numvec.h"
+
+typedef struct
+{
+  void (*add) (double *, const double *, size_t);
+  void (*scale) (double *, double, size_t);
+  double (*dot) (const double *, const double *, size_t);
+  double (*sum) (const double *, size_t);
+} kernels_t;
+
+static const size_t widths[] = {
+  [NUMVEC_U8] = 1,  [NUMVEC_S8] = 1,  [NUMVEC_U16] = 2, [NUMVEC_S16] = 2,
+  [NUMVEC_U32] = 4, [NUMVEC_S32] = 4, [NUMVEC_U64] = 8, [NUMVEC_S64] = 8,
+  [NUMVEC_F32] = 4, [NUMVEC_F64] = 8,
+};
+
+size_t
+numvec_width (enum NumvecType type)
+{
+  return widths[type];
+}
+
+/* Zeroed storage for COUNT elements.  */
+numvector_t *
+numvec_new (enum NumvecType type, size_t count)
+{
+  numvector_t *nv = malloc (sizeof (numvector_t));
+  nv->type = type;
+  nv->count = count;
+  nv->vals = calloc (count ? count : 1, widths[type]);
+  return nv;
+}
+
+void
+numvec_release (numvector_t *nv)
+{
+  free (nv->vals);
+  free (nv);
+}
+
+/* Fold the lanes of a reduction, each with the one half a block away
+   first and then pairwise, and add the elements past the last whole
+   block in order.  */
+static double
+reduce_lanes (const double *lane, const double *tail, size_t n)
+{
+  double s[NUMVEC_LANES / 2];
+  for (size_t j = 0; j < NUMVEC_LANES / 2; j++)
+    s[j] = lane[j] + lane[j + NUMVEC_LANES / 2];
+  double total = (s[0] + s[1]) + (s[2] + s[3]);
+  for (size_t i = 0; i < n; i++)
+    total += tail[i];
+  return total;
+}
+
+static void
+add_scalar (double *dst, const double *src, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    dst[i] += src[i];
+}
+
+static void
+scale_scalar (double *dst, double k, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    dst[i] *= k;
+}
+
+static double
+dot_scalar (const double *a, const double *b, size_t n)
+{
+  double lane[NUMVEC_LANES] = { 0.0 };
+  size_t i = 0;
+  for (; i + NUMVEC_LANES <= n; i += NUMVEC_LANES)
+    for (size_t j = 0; j < NUMVEC_LANES; j++)
+      lane[j] += a[i + j] * b[i + j];
+
+  double tail[NUMVEC_LANES];
+  for (size_t j = 0; i + j < n; j++)
+    tail[j] = a[i + j] * b[i + j];
+  return reduce_lanes (lane, tail, n - i);
+}
+
+static double
+sum_scalar (const double *a, size_t n)
+{
+  double lane[NUMVEC_LANES] = { 0.0 };
+  size_t i = 0;
+  for (; i + NUMVEC_LANES <= n; i += NUMVEC_LANES)
+    for (size_t j = 0; j < NUMVEC_LANES; j++)
+      lane[j] += a[i + j];
+  return reduce_lanes (lane, a + i, n - i);
+}
+
+static const kernels_t scalar_kernels
+    = { add_scalar, scale_scalar, dot_scalar, sum_scalar };
+
+/* The AVX2 kernels keep lanes 0-3 of a reduction in one register and
+   lanes 4-7 in another, multiplying and adding separately as the scalar
+   kernels do rather than fusing.  */
+
+#ifdef NUMVEC_AVX2
+__attribute__ ((target ("avx2"))) static void
+add_avx2 (double *dst, const double *src, size_t n)
+{
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    _mm256_storeu_pd (dst + i, _mm256_add_pd (_mm256_loadu_pd (dst + i),
+                                              _mm256_loadu_pd (src + i)));
+  add_scalar (dst + i, src + i, n - i);
+}
+
+__attribute__ ((target ("avx2"))) static void
+scale_avx2 (double *dst, double k, size_t n)
+{
+  const __m256d kv = _mm256_set1_pd (k);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    _mm256_storeu_pd (dst + i, _mm256_mul_pd (_mm256_loadu_pd (dst + i), kv));
+  scale_scalar (dst + i, k, n - i);
+}
+
+__attribute__ ((target ("avx2"))) static double
+dot_avx2 (const double *a, const double *b, size_t n)
+{
+  __m256d lo = _mm256_setzero_pd ();
+  __m256d hi = _mm256_setzero_pd ();
+  size_t i = 0;
+  for (; i + NUMVEC_LANES <= n; i += NUMVEC_LANES)
+    {
+      lo = _mm256_add_pd (lo, _mm256_mul_pd (_mm256_loadu_pd (a + i),
+                                             _mm256_loadu_pd (b + i)));
+      hi = _mm256_add_pd (hi, _mm256_mul_pd (_mm256_loadu_pd (a + i + 4),
+                                             _mm256_loadu_pd (b + i + 4)));
+    }
+
+  double lane[NUMVEC_LANES], tail[NUMVEC_LANES];
+  _mm256_storeu_pd (lane, lo);
+  _mm256_storeu_pd (lane + 4, hi);
+  for (size_t j = 0; i + j < n; j++)
+    tail[j] = a[i + j] * b[i + j];
+  return reduce_lanes (lane, tail, n - i);
+}
+
+__attribute__ ((target ("avx2"))) static double
+sum_avx2 (const double *a, size_t n)
+{
+  __m256d lo = _mm256_setzero_pd ();
+  __m256d hi = _mm256_setzero_pd ();
+  size_t i = 0;
+  for (; i + NUMVEC_LANES <= n; i += NUMVEC_LANES)
+    {
+      lo = _mm256_add_pd (lo, _mm256_loadu_pd (a + i));
+      hi = _mm256_add_pd (hi, _mm256_loadu_pd (a + i + 4));
+    }
+
+  double lane[NUMVEC_LANES];
+  _mm256_storeu_pd (lane, lo);
+  _mm256_storeu_pd (lane + 4, hi);
+  return reduce_lanes (lane, a + i, n - i);
+}
+
+static const kernels_t avx2_kernels
+    = { add_avx2, scale_avx2, dot_avx2, sum_avx2 };
+#endif
+
+static const kernels_t *
+numvec_resolve (void)
+{
+#ifdef NUMVEC_AVX2
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("avx2"))
+    return &avx2_kernels;
+#endif
+  return &scalar_kernels;
+}
+
+/* Picked on first use from what the CPU supports.  Threads racing to
+   pick them store the same table.  */
+static _Atomic (const kernels_t *) numvec_kernels;
+
+static const kernels_t *
+kernels (void)
+{
+  const kernels_t *k
+      = atomic_load_explicit (&numvec_kernels, memory_order_relaxed);
+  if (!k)
+    {
+      k = numvec_resolve ();
+      atomic_store_explicit (&numvec_kernels, k, memory_order_relaxed);
+    }
+  return k;
+}
+
+/* DST[I] += SRC[I] for the first N elements.  */
+void
+numvec_f64_add (double *dst, const double *src, size_t n)
+{
+  kernels ()->add (dst, src, n);
+}
+
+void
+numvec_f64_scale (double *dst, double k, size_t n)
+{
+  kernels ()->scale (dst, k, n);
+}
+
+double
+numvec_f64_dot (const double *a, const double *b, size_t n)
+{
+  return kernels ()->dot (a, b, n);
+}
+
+double
+numvec_f64_sum (const double *a, size_t n)
+{
+  return kernels ()->sum (a, n);
+}
@@ -0,0 +1,47 @@
+#ifndef NUMVEC_H
+#define NUMVEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "object.h"
+
+/* The f64 reductions accumulate in this many interleaved lanes, element I
+   into lane I mod NUMVEC_LANES, whichever kernel runs, so their results
+   do not depend on the CPU.  */
+#define NUMVEC_LANES 8
+
+/* Element types of the SRFI 4 vectors.  u8vectors are bytevectors and
+   never numvectors; NUMVEC_U8 only names their type.  */
+enum NumvecType
+{
+  NUMVEC_U8,
+  NUMVEC_S8,
+  NUMVEC_U16,
+  NUMVEC_S16,
+  NUMVEC_U32,
+  NUMVEC_S32,
+  NUMVEC_U64,
+  NUMVEC_S64,
+  NUMVEC_F32,
+  NUMVEC_F64,
+};
+
+/* COUNT unboxed elements of TYPE stored contiguously in VALS.  */
+struct Numvector
+{
+  enum NumvecType type;
+  size_t count;
+  void *vals;
+};
+
+numvector_t *numvec_new (enum NumvecType type, size_t count);
+void numvec_release (numvector_t *nv);
+size_t numvec_width (enum NumvecType type);
+
+void numvec_f64_add (double *dst, const double *src, size_t n);
+void numvec_f64_scale (double *dst, double k, size_t n);
+double numvec_f64_dot (const double *a, const double *b, size_t n);
+double numvec_f64_sum (const double *a, size_t n);
+
+#endif
@@ -1,18 +1,32 @@
+#include <fcntl.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
+#include "bignum.h"
 #include "heap.h"
+#include "isolate.h"
+#include "numvec.h"
 #include "object.h"
+#include "pool.h"
+#include "port.h"
+#include "reader.h"
+#include "regexp.h"
+#include "text.h"
 #include "utils.h"
 
 #define STACK_GROWTH_FACTOR 0.85
 #define ENVIRON_GROWTH_FACTOR 0.75
+#define SYMTAB_GROWTH_FACTOR 0.75
+#define SYMTAB_INITIAL_SIZE 256
+#define DISPATCH_DENSE_RATIO 2
+#define DISPATCH_DENSE_MAX 1024
 
 object_t *
 object_new (objtype_t type, void *value, heap_t *heap)
 {
-  object_t *obj = calloc (1, sizeof (object_t));
+  object_t *obj = heap_alloc (heap);
   obj->type = type;
   obj->hash = 0;
   obj->marked = false;
@@ -24,11 +38,14 @@ object_new (objtype_t type, void *value, heap_t *heap)
     case OBJ_Nil:
       break;
     case OBJ_String:
+      obj->v_string = (string_t *)value;
+      break;
     case OBJ_Label:
-      obj->buffz = (const char32_t *)value;
+      obj->v_buffz = (const char32_t *)value;
       break;
     case OBJ_OpCode:
       obj->v_opcode = *(opcode_t *)value;
+      break;
     case OBJ_Symbol:
       obj->v_symbol = (symbol_t *)value;
       break;
@@ -54,7 +71,7 @@ object_new (objtype_t type, void *value, heap_t *heap)
       obj->v_vector = (vector_t *)value;
       break;
     case OBJ_Bytevector:
-      obj->v_bytevector = (vector_t *)value;
+      obj->v_bytevector = (bytevector_t *)value;
       break;
     case OBJ_Port:
       obj->v_port = (port_t *)value;
@@ -77,115 +94,142 @@ object_new (objtype_t type, void *value, heap_t *heap)
     case OBJ_Formal:
       obj->v_formal = (formal_t *)value;
       break;
+    case OBJ_Box:
+      obj->v_box = (box_t *)value;
+      break;
+    case OBJ_Dispatch:
+      obj->v_dispatch = (dispatch_t *)value;
+      break;
+    case OBJ_Channel:
+      obj->v_channel = (channel_t *)value;
+      break;
+    case OBJ_Isolate:
+      obj->v_isolate = (isolate_t *)value;
+      break;
+    case OBJ_Future:
+      obj->v_future = (task_t *)value;
+      break;
+    case OBJ_Regexp:
+      obj->v_regexp = (regexp_t *)value;
+      break;
+    case OBJ_Bignum:
+      obj->v_bignum = (bignum_t *)value;
+      break;
+    case OBJ_Numvector:
+      obj->v_numvector = (numvector_t *)value;
+      break;
     case OBJ_Conti:
       obj->v_conti = (conti_t *)value;
+      break;
     case OBJ_Stack:
       obj->v_stack = (stack_t *)value;
+      break;
     default:
       break;
     }
 
-  heap_add_root (heap, obj);
   return obj;
 }
 
+/* Free what OBJ owns outside the heap, leaving the objects it refers to
+   to the collector.  */
 void
-object_delete (object_t *obj)
+object_release (object_t *obj)
 {
-  if (!obj)
-    return;
-
-  object_t *next = obj->next;
   switch (obj->type)
     {
-    case OBJ_Nil:
-    case oBJ_Bool:
-    case OBJ_Integer:
-    case OBJ_Real:
-    case OBJ_Complex:
-    case OBJ_Builtin:
-    case OBJ_OpCode:
-      break;
     case OBJ_String:
+      string_release (obj->v_string);
+      free (obj->v_string);
+      break;
     case OBJ_Label:
-      free (obj->v_buffz);
+      free ((void *)obj->v_buffz);
       break;
     case OBJ_Symbol:
-      free (obj->v_symbol->id);
+      free ((void *)obj->v_symbol->id);
       free (obj->v_symbol);
       break;
     case OBJ_Synobj:
-      object_delete (obj->v_synobj->datum);
-      object_delete (obj->v_synobj->env);
       free (obj->v_synobj);
       break;
     case OBJ_Environ:
       for (size_t i = 0; i < obj->v_environ->size; i++)
-        {
-          entry_t *e = obj->v_environ->entries[i];
-          while (e)
-            {
-              entry_t *next = e->next;
-              object_delete (e->key);
-              object_delete (e->value);
-              free (e);
-              e = next;
-            }
-        }
+        for (entry_t *e = obj->v_environ->entries[i]; e;)
+          {
+            entry_t *next = e->next;
+            free (e);
+            e = next;
+          }
       free (obj->v_environ->entries);
       free (obj->v_environ);
       break;
     case OBJ_Vector:
-      for (size_t i = 0; i < obj->v_vector->size; i++)
-        object_delete (obj->v_vector->vals[i]);
       free (obj->v_vector->vals);
       free (obj->v_vector);
       break;
     case OBJ_Bytevector:
-      free (obj->v_bytevector->vals);
+      if (!obj->v_bytevector->mapped)
+        free (obj->v_bytevector->vals);
+      else if (obj->v_bytevector->vals)
+        munmap (obj->v_bytevector->vals, obj->v_bytevector->size);
       free (obj->v_bytevector);
       break;
     case OBJ_Formal:
-      object_delete (obj->v_formal->value);
       free (obj->v_formal);
       break;
     case OBJ_Closure:
-      object_delete (obj->v_closure->formals);
-      object_delete (obj->v_closure->env);
-      object_delete (obj->v_closure->body);
+      free (obj->v_closure->frees);
       free (obj->v_closure);
       break;
+    case OBJ_Box:
+      free (obj->v_box);
+      break;
+    case OBJ_Dispatch:
+      free (obj->v_dispatch->entries);
+      free (obj->v_dispatch->dense);
+      free (obj->v_dispatch);
+      break;
+    case OBJ_Channel:
+      free (obj->v_channel->buf);
+      free (obj->v_channel);
+      break;
+    case OBJ_Isolate:
+      isolate_release (obj->v_isolate);
+      break;
+    case OBJ_Future:
+      task_release (obj->v_future);
+      break;
+    case OBJ_Regexp:
+      regexp_release (obj->v_regexp);
+      break;
+    case OBJ_Bignum:
+      bignum_release (obj->v_bignum);
+      break;
+    case OBJ_Numvector:
+      numvec_release (obj->v_numvector);
+      break;
     case OBJ_Conti:
-      object_delete (obj->v_conti->captured_stack);
       free (obj->v_conti);
       break;
     case OBJ_Stack:
-      for (size_t i = 0; i < obj->v_stack->count; i++)
-        object_delete (obj->v_stack->objs[i]);
+      free (obj->v_stack->objs);
       free (obj->v_stack);
       break;
     case OBJ_Procedure:
-      object_delete (obj->v_procedure->value);
       free (obj->v_procedure);
       break;
     case OBJ_Port:
-      if (!obj->v_port->stdio)
-        fclose (obj->v_port->stream);
+      if (obj->v_port->reader)
+        reader_close (obj->v_port->reader);
+      port_close (obj->v_port);
       free (obj->v_port);
+      break;
     case OBJ_Pair:
-      object_delete (obj->v_pair->first);
-      object_delete (obj = > v_pair->rest);
       free (obj->v_pair);
       break;
-    case OBJ_Stack:
-      for (size_t i = 0; i < obj->v_stack->count; i++)
-        object_delete (obj->v_stack->objs[i]);
-      free (obj->v_stack->objs);
-      free (obj->v_stack);
+    default:
+      break;
     }
-
-  free (obj);
-  object_delete (next);
 }
 
 void
@@ -207,6 +251,8 @@ object_hash (object_t *obj)
   switch (obj->type)
     {
     case OBJ_String:
+      obj->hash = string_hash (obj->v_string) + 1;
+      break;
     case OBJ_Label:
       obj->hash = fnv1a_hash32 (obj->v_buffz) + 1;
       break;
@@ -214,13 +260,17 @@ object_hash (object_t *obj)
       obj->hash = fnv1a_hash32 (obj->v_symbol->id) + obj->v_symbol->mark;
       break;
     case OBJ_Integer:
-      obj->hash = splitmax_int_hash32 (obj->v_integer) + 1;
+      obj->hash = splitmix_hash32 ((uint64_t)obj->v_integer) + 1;
+      break;
+    case OBJ_Bignum:
+      obj->hash = bignum_hash (obj->v_bignum) + 1;
       break;
     case OBJ_Real:
-      obj->hash = splitmax_real_hash32 (obj->v_real) + 1;
+      obj->hash = splitmix_hash32 (double_bits (obj->v_real)) + 1;
       break;
     case OBJ_Complex:
-      obj->hash = splitmax_complex_hash32 (obj->v_complex) + 1;
+      obj->hash = splitmix_hash32 (double_bits (creal (obj->v_complex))
+                                   ^ double_bits (cimag (obj->v_complex))) + 1;
       break;
     case OBJ_Bool:
       obj->hash = obj->v_bool + 2;
@@ -237,6 +287,10 @@ object_equals (object_t *obj1, object_t *obj2)
 {
   if (obj1->type != obj2->type)
     return false;
+  if (obj1->type == OBJ_String)
+    return string_equal (obj1->v_string, obj2->v_string);
+  if (obj1->type == OBJ_Bignum)
+    return !bignum_compare (obj1->v_bignum, obj2->v_bignum);
 
   return object_hash (obj1) == object_hash (obj2);
 }
@@ -259,38 +313,85 @@ object_new_port (const char *path, bool read, bool write, bool append,
   port->write = write;
   port->append = append;
   port->binary = binary;
+  port->reader = NULL;
 
-  if ((int)path == STDIN_FILENO)
-    {
-      port->stream = stdin;
-      port->stdio = true;
-    }
-  else if ((int)path == STDOUT_FILENO)
-    {
-      port->stream = stdout;
-      port->stdio = true;
-    }
-  else if ((int)path == STDERR_FILENO)
-    {
-      port->stream = stderr;
-      port->stdio = true;
-    }
+  int flags = O_CLOEXEC;
+  if (read && (write || append))
+    flags |= O_RDWR | O_CREAT;
+  else if (write || append)
+    flags |= O_WRONLY | O_CREAT;
   else
+    flags |= O_RDONLY;
+  if (append)
+    flags |= O_APPEND;
+  else if (write && !read)
+    flags |= O_TRUNC;
+
+  int fd = open (path, flags, 0666);
+  if (fd < 0)
     {
-      const char flags[8] = { 0 };
-      int n = 0;
-      if (read)
-        flags[n++] = 'r';
-      if (write)
-        flags[n++] = 'w';
-      if (append)
-        flags[n++] = 'a';
-      if (binary)
-        flags[n++] = 'b';
-      port->stream = fopen (path, &flags[0]);
-      strncat (&port->path[0], path, PATH_MAX);
-      port->path[PATH_MAX] = '\0';
+      free (port);
+      raise_runtime_error ("Could not open %s", path);
     }
+  port->stdio = false;
+  strncpy ((char *)&port->fpath[0], path, PATH_MAX);
+  ((char *)port->fpath)[PATH_MAX] = '\0';
+  port_init (port, fd, PORT_BUFFER_SIZE);
+
+  return object_new (OBJ_Port, (void *)port, heap);
+}
+
+/* A port on one of the standard descriptors, which closing leaves open.  */
+object_t *
+object_new_port_fd (int fd, bool read, bool write, bool binary, heap_t *heap)
+{
+  port_t *port = malloc (sizeof (port_t));
+  port->read = read;
+  port->write = write;
+  port->append = false;
+  port->binary = binary;
+  port->stdio = true;
+  port->reader = NULL;
+  ((char *)port->fpath)[0] = '\0';
+  port_init (port, fd, PORT_BUFFER_SIZE);
+
+  return object_new (OBJ_Port, (void *)port, heap);
+}
+
+object_t *
+object_new_port_memory (bool read, bool write, bool binary, heap_t *heap)
+{
+  port_t *port = malloc (sizeof (port_t));
+  port->read = read;
+  port->write = write;
+  port->append = false;
+  port->binary = binary;
+  port->stdio = false;
+  port->reader = NULL;
+  port_init_memory (port, NULL, 0);
+  ((char *)port->fpath)[0] = '\0';
+
+  return object_new (OBJ_Port, (void *)port, heap);
+}
+
+object_t *
+object_new_port_mapped (const char *path, heap_t *heap)
+{
+  size_t size;
+  uint8_t *map = port_map_file (path, &size, MADV_SEQUENTIAL);
+
+  port_t *port = malloc (sizeof (port_t));
+  port->read = true;
+  port->write = false;
+  port->append = false;
+  port->binary = true;
+  port->stdio = false;
+  port->reader = NULL;
+  port_init_mapped (port, map, size);
+  if (map)
+    heap_note_mapping (heap);
+  strncpy ((char *)&port->fpath[0], path, PATH_MAX);
+  ((char *)port->fpath)[PATH_MAX] = '\0';
 
   return object_new (OBJ_Port, (void *)port, heap);
 }
@@ -303,15 +404,47 @@ object_new_closure (object_t *formals, object_t *env, object_t *body,
   closure->formals = formals;
   closure->env = env;
   closure->body = body;
+  closure->arity = 0;
+  closure->variadic = false;
+  closure->frees = NULL;
+  closure->nfrees = 0;
+
+  object_t *f = formals;
+  while (f->type == OBJ_Pair)
+    {
+      closure->arity++;
+      f = f->v_pair->rest;
+    }
+  if (f->type == OBJ_Symbol)
+    closure->variadic = true;
+
+  return object_new (OBJ_Closure, (void *)closure, heap);
+}
+
+object_t *
+object_new_flat_closure (object_t *proto, size_t nfrees, heap_t *heap)
+{
+  closure_t *closure = malloc (sizeof (closure_t));
+  memmove (closure, proto->v_closure, sizeof (closure_t));
+  closure->frees = nfrees ? calloc (nfrees, sizeof (object_t *)) : NULL;
+  closure->nfrees = nfrees;
 
   return object_new (OBJ_Closure, (void *)closure, heap);
 }
 
+object_t *
+object_new_box (object_t *value, heap_t *heap)
+{
+  box_t *box = malloc (sizeof (box_t));
+  box->value = value;
+  return object_new (OBJ_Box, (void *)box, heap);
+}
+
 object_t *
 object_new_environ (environ_t *parent, size_t size, heap_t *heap)
 {
   environ_t *env = malloc (sizeof (environ_t));
-  env->entries = calloc (size, sizeof (entry_t));
+  env->entries = calloc (size, sizeof (entry_t *));
   env->size = size;
   env->count = 0;
   env->parent = parent;
@@ -335,6 +468,32 @@ object_new_bytevector (size_t size, heap_t *heap)
   bv->vals = calloc (size, sizeof (uint8_t));
   bv->size = size;
   bv->count = 0;
+  bv->mapped = false;
+  return object_new (OBJ_Bytevector, bv, heap);
+}
+
+/* Takes ownership of VALS, which must come from malloc.  */
+object_t *
+object_new_bytevector_from (uint8_t *vals, size_t count, heap_t *heap)
+{
+  bytevector_t *bv = malloc (sizeof (bytevector_t));
+  bv->vals = vals;
+  bv->size = count;
+  bv->count = count;
+  bv->mapped = false;
+  return object_new (OBJ_Bytevector, bv, heap);
+}
+
+object_t *
+object_new_bytevector_mapped (uint8_t *map, size_t size, heap_t *heap)
+{
+  bytevector_t *bv = malloc (sizeof (bytevector_t));
+  bv->vals = map;
+  bv->size = size;
+  bv->count = size;
+  bv->mapped = true;
+  if (map)
+    heap_note_mapping (heap);
   return object_new (OBJ_Bytevector, bv, heap);
 }
 
@@ -372,9 +531,61 @@ object_new_conti (object_t *captured_stack, heap_t *heap)
 {
   conti_t *c = malloc (sizeof (conti_t));
   c->captured_stack = captured_stack;
+  c->delimited = false;
   return object_new (OBJ_Conti, c, heap);
 }
 
+object_t *
+object_new_channel (size_t capacity, heap_t *heap)
+{
+  channel_t *ch = calloc (1, sizeof (channel_t));
+  ch->buf = capacity ? calloc (capacity, sizeof (object_t *)) : NULL;
+  ch->capacity = capacity;
+  return object_new (OBJ_Channel, ch, heap);
+}
+
+/* Takes over one reference to ISO.  */
+object_t *
+object_new_isolate (isolate_t *iso, heap_t *heap)
+{
+  return object_new (OBJ_Isolate, iso, heap);
+}
+
+/* Takes over one reference to TASK.  */
+object_t *
+object_new_future (task_t *task, heap_t *heap)
+{
+  return object_new (OBJ_Future, task, heap);
+}
+
+/* Takes over RE.  */
+object_t *
+object_new_regexp (regexp_t *re, heap_t *heap)
+{
+  return object_new (OBJ_Regexp, re, heap);
+}
+
+/* Takes over B.  A value that fits a fixnum comes back as one, so an
+   integer has only one representation.  */
+object_t *
+object_new_bignum (bignum_t *b, heap_t *heap)
+{
+  intmax_t v;
+  if (bignum_fits_int (b, &v))
+    {
+      bignum_release (b);
+      return object_new_integer (v, heap);
+    }
+  return object_new (OBJ_Bignum, b, heap);
+}
+
+/* Takes over NV.  */
+object_t *
+object_new_numvector (numvector_t *nv, heap_t *heap)
+{
+  return object_new (OBJ_Numvector, nv, heap);
+}
+
 object_t *
 object_new_stack (size_t size, heap_t *heap)
 {
@@ -382,6 +593,10 @@ object_new_stack (size_t size, heap_t *heap)
   s->objs = calloc (size, sizeof (object_t *));
   s->size = size;
   s->count = 0;
+  s->base = 0;
+  s->link = NULL;
+  s->oneshot = false;
+  s->prompt = false;
   return object_new (OBJ_Stack, s, heap);
 }
 
@@ -424,6 +639,123 @@ object_new_symbol (const char32_t *id, size_t id_len, heap_t *heap)
   return object_new (OBJ_Symbol, (void *)sym, heap);
 }
 
+static uint32_t
+symbol_id_hash (const char32_t *id, size_t id_len)
+{
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < id_len; i++)
+    {
+      hash ^= (uint32_t)id[i];
+      hash *= 16777619u;
+    }
+  return hash;
+}
+
+static bool
+symbol_id_matches (object_t *sym, const char32_t *id, size_t id_len)
+{
+  const char32_t *sid = sym->v_symbol->id;
+  for (size_t i = 0; i < id_len; i++)
+    if (sid[i] != id[i])
+      return false;
+  return sid[id_len] == U'\0';
+}
+
+/* Rehash the table into SIZE slots, keeping only the symbols marked by
+   the collection in progress when PRUNE is set.  */
+static void
+symtab_rebuild (heap_t *heap, size_t size, bool prune)
+{
+  size_t old_size = heap->symbols_size;
+  object_t **old = heap->symbols;
+
+  heap->symbols_size = size;
+  heap->symbols = calloc (size, sizeof (object_t *));
+  heap->symbols_count = 0;
+
+  size_t mask = size - 1;
+  for (size_t i = 0; i < old_size; i++)
+    {
+      if (!old[i] || (prune && !old[i]->marked))
+        continue;
+      const char32_t *id = old[i]->v_symbol->id;
+      size_t idx = symbol_id_hash (id, u32strlen (id)) & mask;
+      while (heap->symbols[idx])
+        idx = (idx + 1) & mask;
+      heap->symbols[idx] = old[i];
+      heap->symbols_count++;
+    }
+
+  free (old);
+}
+
+static void
+symtab_grow (heap_t *heap)
+{
+  symtab_rebuild (heap,
+                  heap->symbols_size ? heap->symbols_size * 2
+                                     : SYMTAB_INITIAL_SIZE,
+                  false);
+}
+
+/* The symbol table is weak: called by the collector once marking is
+   done, this drops the symbols nothing else refers to, which the sweep
+   then frees.  Interning the name again makes a new symbol, and nothing
+   can tell it from the old one.  */
+void
+object_prune_symbols (heap_t *heap)
+{
+  if (heap->symbols_size)
+    symtab_rebuild (heap, heap->symbols_size, true);
+}
+
+/* The slot holding the symbol ID in the table, or the empty slot it
+   would go in.  */
+static size_t
+symtab_probe (heap_t *heap, const char32_t *id, size_t id_len)
+{
+  size_t mask = heap->symbols_size - 1;
+  size_t idx = symbol_id_hash (id, id_len) & mask;
+  while (heap->symbols[idx]
+         && !symbol_id_matches (heap->symbols[idx], id, id_len))
+    idx = (idx + 1) & mask;
+  return idx;
+}
+
+/* Interned symbols are unique per heap, so they can be compared and hashed
+   by identity.  They carry no hygiene mark.  The table is shared by every
+   thread on the heap and guarded by its lock, which allocation takes too,
+   so a new symbol is made with the lock released; a thread that loses the
+   race to intern the same name drops its copy.  */
+object_t *
+object_intern_symbol (const char32_t *id, size_t id_len, heap_t *heap)
+{
+  pthread_mutex_lock (&heap->lock);
+  object_t *sym
+      = heap->symbols_size
+            ? heap->symbols[symtab_probe (heap, id, id_len)]
+            : NULL;
+  pthread_mutex_unlock (&heap->lock);
+  if (sym)
+    return sym;
+
+  object_t *fresh = object_new_symbol (id, id_len, heap);
+  fresh->v_symbol->mark = 0;
+
+  pthread_mutex_lock (&heap->lock);
+  if (heap->symbols_count + 1 > heap->symbols_size * SYMTAB_GROWTH_FACTOR)
+    symtab_grow (heap);
+  size_t idx = symtab_probe (heap, id, id_len);
+  sym = heap->symbols[idx];
+  if (!sym)
+    {
+      sym = heap->symbols[idx] = fresh;
+      heap->symbols_count++;
+    }
+  pthread_mutex_unlock (&heap->lock);
+  return sym;
+}
+
 object_t *
 object_new_synobj (object_t *datum, object_t *env, heap_t *heap)
 {
@@ -436,21 +768,34 @@ object_new_synobj (object_t *datum, object_t *env, heap_t *heap)
 object_t *
 object_new_string (const char32_t *str, size_t str_len, heap_t *heap)
 {
-  char32_t *dup = u32strndup (utf8, str_len);
-  return object_new (OBJ_String, dup, heap);
+  size_t size;
+  uint8_t *bytes = string_encode (str, str_len, &size);
+  return object_new_string_from (bytes, size, heap);
 }
 
 object_t *
-object_new_label (const char32_t *lbl, size_t lbl_len, heap_t *heap)
+object_new_string_utf8 (const uint8_t *bytes, size_t size, heap_t *heap)
 {
-  char32_t *dup = u32strndup (utf8, lbl_len);
-  return object_new (OBJ_Label, dup, heap);
+  uint8_t *dup = malloc (size + 1);
+  memcpy (dup, bytes, size);
+  return object_new_string_from (dup, size, heap);
+}
+
+/* Takes ownership of BYTES, which must come from malloc with room for one
+   more byte.  */
+object_t *
+object_new_string_from (uint8_t *bytes, size_t size, heap_t *heap)
+{
+  string_t *str = malloc (sizeof (string_t));
+  string_init (str, bytes, size);
+  return object_new (OBJ_String, str, heap);
 }
 
 object_t *
-object_new_synobj (object_t *val, heap_t *heap)
+object_new_label (const char32_t *lbl, size_t lbl_len, heap_t *heap)
 {
-  return object_new (OBJ_Synobj, val, heap);
+  char32_t *dup = u32strndup (lbl, lbl_len);
+  return object_new (OBJ_Label, dup, heap);
 }
 
 object_t *
@@ -460,9 +805,149 @@ object_new_nil (heap_t *heap)
 }
 
 object_t *
-object_new_opcode (opcode_t opcode, heap_t heap)
+object_new_opcode (opcode_t opcode, heap_t *heap)
+{
+  return object_new (OBJ_OpCode, &opcode, heap);
+}
+
+bool
+dispatch_keyable (object_t *obj)
+{
+  switch (obj->type)
+    {
+    case OBJ_Symbol:
+    case OBJ_Integer:
+    case OBJ_Character:
+    case OBJ_Bool:
+    case OBJ_Nil:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline uintptr_t
+dispatch_key (object_t *obj)
+{
+  switch (obj->type)
+    {
+    case OBJ_Integer:
+      return (uintptr_t)obj->v_integer;
+    case OBJ_Character:
+      return (uintptr_t)obj->v_char;
+    case OBJ_Bool:
+      return (uintptr_t)obj->v_bool;
+    case OBJ_Nil:
+      return 0;
+    default:
+      return (uintptr_t)obj;
+    }
+}
+
+static inline size_t
+dispatch_slot (objtype_t type, uintptr_t key, size_t mask)
+{
+  uint64_t h = ((uint64_t)key ^ ((uint64_t)type << 56)) * 0x9e3779b97f4a7c15ull;
+  return (size_t)(h >> 32) & mask;
+}
+
+static inline intmax_t
+dispatch_ordinal (object_t *obj)
+{
+  return obj->type == OBJ_Integer ? obj->v_integer : (intmax_t)obj->v_char;
+}
+
+/* Build a table mapping each of the N KEYS to the matching entry of CODES.
+   When a key repeats, the first occurrence wins, as it would in a chain of
+   `eqv?' tests.  */
+object_t *
+object_new_dispatch (object_t **keys, object_t **codes, size_t n,
+                     heap_t *heap)
+{
+  dispatch_t *d = calloc (1, sizeof (dispatch_t));
+
+  objtype_t type = keys[0]->type;
+  bool dense = type == OBJ_Integer || type == OBJ_Character;
+  intmax_t lo = 0, hi = 0;
+  for (size_t i = 0; dense && i < n; i++)
+    {
+      if (keys[i]->type != type)
+        {
+          dense = false;
+          break;
+        }
+      intmax_t v = dispatch_ordinal (keys[i]);
+      if (i == 0 || v < lo)
+        lo = v;
+      if (i == 0 || v > hi)
+        hi = v;
+    }
+
+  uintmax_t span = (uintmax_t)hi - (uintmax_t)lo + 1;
+  if (dense && span <= n * DISPATCH_DENSE_RATIO && span <= DISPATCH_DENSE_MAX)
+    {
+      d->dense_type = type;
+      d->dense_min = lo;
+      d->dense_span = span;
+      d->dense = calloc (span, sizeof (object_t *));
+      for (size_t i = 0; i < n; i++)
+        {
+          size_t off = (uintmax_t)dispatch_ordinal (keys[i]) - (uintmax_t)lo;
+          if (!d->dense[off])
+            d->dense[off] = codes[i];
+        }
+      return object_new (OBJ_Dispatch, d, heap);
+    }
+
+  d->size = 8;
+  while (d->size < n * 2)
+    d->size *= 2;
+  d->entries = calloc (d->size, sizeof (dispatch_entry_t));
+
+  size_t mask = d->size - 1;
+  for (size_t i = 0; i < n; i++)
+    {
+      uintptr_t key = dispatch_key (keys[i]);
+      size_t idx = dispatch_slot (keys[i]->type, key, mask);
+      while (d->entries[idx].code
+             && !(d->entries[idx].type == keys[i]->type
+                  && d->entries[idx].key == key))
+        idx = (idx + 1) & mask;
+
+      if (d->entries[idx].code)
+        continue;
+      d->entries[idx].type = keys[i]->type;
+      d->entries[idx].key = key;
+      d->entries[idx].code = codes[i];
+    }
+
+  return object_new (OBJ_Dispatch, d, heap);
+}
+
+object_t *
+dispatch_lookup (dispatch_t *dispatch, object_t *key)
 {
-  return object_new (OBJ_OpCode, (void *)opcode, heap);
+  if (dispatch->dense)
+    {
+      if (key->type != dispatch->dense_type)
+        return NULL;
+      uintmax_t off = (uintmax_t)dispatch_ordinal (key)
+                      - (uintmax_t)dispatch->dense_min;
+      return off < dispatch->dense_span ? dispatch->dense[off] : NULL;
+    }
+
+  if (!dispatch_keyable (key))
+    return NULL;
+
+  uintptr_t k = dispatch_key (key);
+  size_t mask = dispatch->size - 1;
+  for (size_t idx = dispatch_slot (key->type, k, mask);
+       dispatch->entries[idx].code; idx = (idx + 1) & mask)
+    if (dispatch->entries[idx].type == key->type
+        && dispatch->entries[idx].key == k)
+      return dispatch->entries[idx].code;
+
+  return NULL;
 }
 
 void
@@ -476,6 +961,31 @@ stack_push (stack_t *stk, object_t *obj)
   stk->objs[stk->count++] = obj;
 }
 
+/* Seal the slots of STK below the logical index SPLIT into a new stack
+   segment object, handing it the current buffer, and continue STK on a
+   fresh empty segment linked to it.  */
+object_t *
+stack_seal (stack_t *stk, size_t split, heap_t *heap)
+{
+  stack_t *seg = malloc (sizeof (stack_t));
+  seg->objs = stk->objs;
+  seg->size = stk->size;
+  seg->count = split - stk->base;
+  seg->base = stk->base;
+  seg->link = stk->link;
+  seg->oneshot = false;
+  seg->prompt = false;
+
+  object_t *sealed = object_new (OBJ_Stack, seg, heap);
+
+  stk->objs = calloc (STACK_SEGMENT_SIZE, sizeof (object_t *));
+  stk->size = STACK_SEGMENT_SIZE;
+  stk->count = 0;
+  stk->base = split;
+  stk->link = sealed;
+  return sealed;
+}
+
 object_t *
 stack_pop (stack_t *stk)
 {
@@ -484,100 +994,81 @@ stack_pop (stack_t *stk)
   return stk->objs[--stk->count];
 }
 
-void
-environ_install (environ_t *env, object_t *key, object_t *value)
+static void
+environ_grow (environ_t *env)
 {
-  if (env->count / env->size >= ENVIRON_GROWTH_FACTOR)
-    {
-      environ_t *new_env = malloc (sizeof (environ_t));
-      new_env->entries = calloc (env->size * 2, sizeof (entry_t));
-      new_env->size = env->size * 2;
-      new_env->count = 0;
-      new_env->parent = env->parent;
+  size_t size = env->size * 2;
+  entry_t **entries = calloc (size, sizeof (entry_t *));
 
-      for (size_t i = 0; i < env->size; i++)
-        {
-          entry_t *e = env->entries[i];
-          while (e)
-            {
-              environ_install (new_env, e->key, e->value);
-              e = e->next;
-            }
-        }
+  for (size_t i = 0; i < env->size; i++)
+    for (entry_t *e = env->entries[i], *next; e; e = next)
+      {
+        next = e->next;
+        uint32_t idx = object_hash (e->key) % size;
+        e->next = entries[idx];
+        entries[idx] = e;
+      }
 
-      environ_t **envp = &env;
-      free (env->entries);
-      free (env);
-      *envp = new_env;
-    }
+  free (env->entries);
+  env->entries = entries;
+  env->size = size;
+}
 
+void
+environ_install (environ_t *env, object_t *key, object_t *value)
+{
   uint32_t idx = object_hash (key) % env->size;
 
-  entry_t *e = env->entries[idx];
-  while (e->next)
+  for (entry_t *e = env->entries[idx]; e; e = e->next)
+    if (object_equals (e->key, key))
+      {
+        e->value = value;
+        return;
+      }
+
+  if ((double)(env->count + 1) / env->size > ENVIRON_GROWTH_FACTOR)
     {
-      if (object_equals (e->key, key))
-        {
-          e->value = value;
-          return;
-        }
-      e = e->next;
+      environ_grow (env);
+      idx = object_hash (key) % env->size;
     }
 
-  e->next = malloc (sizeof (entry_t));
-  e->next->key = key;
-  e->next->value = value;
-  e->next->next = NULL;
+  entry_t *e = malloc (sizeof (entry_t));
+  e->key = key;
+  e->value = value;
+  e->next = env->entries[idx];
+  env->entries[idx] = e;
+  env->count++;
 }
 
 object_t *
 environ_retrieve (environ_t *env, object_t *key)
 {
-  if (!env)
-    return NULL;
-
-  uint32_t idx = object_hash (key) % env->size;
-
-  entry_t *e = env->entries[idx];
-  object_t *found = NULL;
-  while (e)
+  for (; env; env = env->parent)
     {
-      if (object_equals (e->key, key))
-        {
-          found = e->value;
-          break;
-        }
-      e = e->next;
+      uint32_t idx = object_hash (key) % env->size;
+      for (entry_t *e = env->entries[idx]; e; e = e->next)
+        if (object_equals (e->key, key))
+          return e->value;
     }
 
-  return found ? found : environ_retrieve (env->parent, key);
+  return NULL;
 }
 
 void
 environ_delete (environ_t *env, object_t *key)
 {
-  if (!env)
-    return;
-
-  uint32_t idx = object_hash (key) % env->size;
-
-  entry_t *e, *e_prev;
-  bool deleted = false;
-
-  for (e = env->entries[idx]; e; e_prev = e, e = e->next)
-    if (object_equals (e->key, key))
-      break;
-
-  if (!e)
-    environ_delete (env->parent, key);
-  else if (e == env->entries[idx])
-    {
-      object_t **ep = &e;
-      *ep = e->next;
-    }
-  else
+  for (; env; env = env->parent)
     {
-      e_prev->next = e->next;
+      uint32_t idx = object_hash (key) % env->size;
+      for (entry_t **ep = &env->entries[idx]; *ep; ep = &(*ep)->next)
+        if (object_equals ((*ep)->key, key))
+          {
+            entry_t *e = *ep;
+            *ep = e->next;
+            free (e);
+            env->count--;
+            return;
+          }
     }
 }
 
@@ -587,11 +1078,18 @@ create_list (heap_t *heap, size_t n, ...)
   va_list args;
   va_start (args, n);
 
-  object_t *result = object_new_nil (heap);
+  object_t *nil = object_new_nil (heap);
+  object_t *result = nil;
+  object_t *tail = NULL;
   for (size_t i = 0; i < n; i++)
     {
       object_t *elem = va_arg (args, object_t *);
-      result = object_new_pair (elem, result, heap);
+      object_t *pair = object_new_pair (elem, nil, heap);
+      if (tail)
+        tail->v_pair->rest = pair;
+      else
+        result = pair;
+      tail = pair;
     }
 
   va_end (args);
@@ -11,8 +11,9 @@
 #include <uchar.h>
 
 #include "heap.h"
+#include "utils.h"
 
-#define MAX_PRIM_NAME 16
+#define MAX_PRIM_NAME 32
 
 typedef struct Object object_t;
 typedef struct Pair pair_t;
@@ -21,6 +22,7 @@ typedef struct Port port_t;
 typedef struct Environ environ_t;
 typedef struct Vector vector_t;
 typedef struct Bytevector bytevector_t;
+typedef struct String string_t;
 typedef struct Procedure procedure_t;
 typedef struct Entry entry_t;
 typedef struct Synobj synobj_t;
@@ -29,8 +31,18 @@ typedef struct Builtin builtin_t;
 typedef struct Conti conti_t;
 typedef struct Stack stack_t;
 typedef struct Symbol symbol_t;
-
-typedef object_t *(*primfn_t) (object_t *args, object_t *env);
+typedef struct Box box_t;
+typedef struct Dispatch dispatch_t;
+typedef struct DispatchEntry dispatch_entry_t;
+typedef struct Channel channel_t;
+typedef struct Fiber fiber_t;
+typedef struct Isolate isolate_t;
+typedef struct Task task_t;
+typedef struct Regexp regexp_t;
+typedef struct Bignum bignum_t;
+typedef struct Numvector numvector_t;
+
+typedef object_t *(*primfn_t) (object_t **args, size_t argc, object_t *env);
 
 typedef enum ObjectType objtype_t;
 typedef enum OpCode opcode_t;
@@ -41,14 +53,29 @@ struct Pair
   object_t *rest;
 };
 
+/* A descriptor with a buffer of SIZE bytes in front of it.  Input waits
+   in [START, END); output accumulates in [0, END) while DIRTY is set.
+   A MAPPED port has no descriptor and its buffer is a read-only file
+   mapping; a MEMORY port has none either and its buffer grows to take
+   whatever is written.  SHARED is the object a memory port's buffer was
+   handed to, if the port has not written since.  */
 struct Port
 {
   bool read;
   bool write;
   bool append;
   bool binary;
-  FILE *stream;
+  int fd;
+  uint8_t *buf;
+  size_t size;
+  size_t start;
+  size_t end;
+  bool dirty;
+  bool mapped;
+  bool memory;
+  object_t *shared;
   bool stdio;
+  struct Reader *reader;
   const char fpath[PATH_MAX + 1];
 };
 
@@ -65,7 +92,7 @@ struct Environ
     object_t *key;
     object_t *value;
     entry_t *next;
-  } *entries;
+  } **entries;
   size_t size;
   size_t count;
   environ_t *parent;
@@ -73,16 +100,46 @@ struct Environ
 
 struct Vector
 {
-  object_t *vals;
+  object_t **vals;
   size_t size;
   size_t count;
 };
 
+enum StringKind
+{
+  STRING_Flat,
+  STRING_Slice,
+  STRING_Concat,
+};
+
+/* Text as UTF-8, SIZE bytes holding LENGTH characters.  A flat string
+   owns BYTES, NUL-terminated.  A slice is a view into the bytes of BASE.
+   A concatenation of LEFT and RIGHT, DEPTH levels deep, has no bytes
+   until something needs them flat; from then on it owns them and its
+   children are no longer reached through it.  ASCII text is indexed
+   directly; other text through CRUMBS, the byte offset of every
+   STRING_CRUMB_INTERVAL'th character, built on the first lookup.  */
+struct String
+{
+  enum StringKind kind;
+  uint8_t *bytes;
+  size_t size;
+  size_t length;
+  bool ascii;
+  size_t *crumbs;
+  object_t *left, *right;
+  object_t *base;
+  unsigned depth;
+};
+
+/* With MAPPED set VALS is external storage, a read-only file mapping of
+   SIZE bytes that the collector unmaps instead of freeing.  */
 struct Bytevector
 {
   uint8_t *vals;
   size_t size;
   size_t count;
+  bool mapped;
 };
 
 struct Closure
@@ -90,6 +147,10 @@ struct Closure
   object_t *formals;
   object_t *env;
   object_t *body;
+  size_t arity;
+  bool variadic;
+  object_t **frees;
+  size_t nfrees;
 };
 
 struct Procedure
@@ -105,23 +166,63 @@ struct Formal
   object_t *value;
 };
 
+/* A delimited continuation holds a copy of the slots between its prompt
+   and the capture point instead of a sealed segment chain.  */
 struct Conti
 {
   object_t *captured_stack;
+  bool delimited;
+};
+
+/* A channel buffers up to CAPACITY values; beyond that, and always when
+   unbuffered, senders park until a receiver arrives.  Parked fibers are
+   queued in FIFO order through their `next' links.  */
+struct Channel
+{
+  object_t **buf;
+  size_t capacity;
+  size_t head;
+  size_t count;
+  fiber_t *senders, *senders_tail;
+  fiber_t *receivers, *receivers_tail;
 };
 
+/* The VM stack is a chain of segments.  OBJS holds the slots from logical
+   index BASE upwards; slots below BASE live in the sealed segment LINK.
+   Capturing a continuation seals the current segment in place and starts
+   a fresh one, and frames are copied back from sealed segments only when a
+   return underflows into them.  A one-shot segment is owned by a single
+   continuation and is reinstated without copying.  PROMPT marks a segment
+   sealed by `reset', whose top is the delimiter for `shift'.  */
 struct Stack
 {
   object_t **objs;
   size_t size;
   size_t count;
+  size_t base;
+  object_t *link;
+  bool oneshot;
+  bool prompt;
+};
+
+#define STACK_SEGMENT_SIZE 256
+
+/* Frame pointers saved on the VM stack are tagged with the low bit so the
+   collector can tell them apart from object pointers.  */
+#define STACK_INDEX(n) ((object_t *)(((uintptr_t)(n) << 1) | 1))
+#define STACK_INDEX_VALUE(o) ((size_t)((uintptr_t)(o) >> 1))
+#define STACK_IS_INDEX(o) (((uintptr_t)(o) & 1) != 0)
+
+struct Box
+{
+  object_t *value;
 };
 
 struct Synobj
 {
   object_t *datum;
   object_t *env;
-  const char srcfile[MAX_PATH + 1];
+  char srcfile[PATH_MAX + 1];
   size_t line, column;
 };
 
@@ -135,14 +236,36 @@ enum OpCode
 {
   OP_Halt,
   OP_Refer,
+  OP_ReferLocal,
+  OP_ReferFree,
+  OP_Indirect,
   OP_Constant,
   OP_Close,
+  OP_Box,
   OP_Test,
+  OP_Dispatch,
   OP_Assign,
+  OP_AssignLocal,
+  OP_AssignIndirect,
+  OP_AssignFree,
   OP_Conti,
   OP_Nuate,
+  OP_Prompt,
+  OP_Fiber,
+  OP_Parallel,
+  OP_Bulk,
+  OP_FlConstant,
+  OP_FlLoad,
+  OP_FlUnbox,
+  OP_FlMove,
+  OP_FlArith,
+  OP_FlCompare,
+  OP_FlBox,
   OP_Frame,
   OP_Argument,
+  OP_Shift,
+  OP_Jump,
+  OP_Pop,
   OP_Apply,
   OP_Return,
 };
@@ -173,6 +296,15 @@ struct Object
     OBJ_Builtin,
     OBJ_Formal,
     OBJ_OpCode,
+    OBJ_Box,
+    OBJ_Dispatch,
+    OBJ_Channel,
+    OBJ_Isolate,
+    OBJ_Future,
+    OBJ_Regexp,
+    OBJ_Bignum,
+    OBJ_Numvector,
+    OBJ_Free,
   } type;
 
   union
@@ -190,12 +322,21 @@ struct Object
     stack_t *v_stack;
     symbol_t *v_symbol;
     synobj_t *v_synobj;
+    box_t *v_box;
+    dispatch_t *v_dispatch;
+    channel_t *v_channel;
+    isolate_t *v_isolate;
+    task_t *v_future;
+    regexp_t *v_regexp;
+    bignum_t *v_bignum;
+    numvector_t *v_numvector;
 
     opcode_t v_opcode;
     intmax_t v_integer;
     double v_real;
     double complex v_complex;
     const char32_t *v_buffz;
+    string_t *v_string;
     bool v_bool;
     char32_t v_char;
   };
@@ -205,22 +346,55 @@ struct Object
   object_t *next, *tail;
 };
 
+/* Jump table for `case' and `cond' over constants.  Keys are compared by
+   identity for interned symbols and by value for fixnums, characters,
+   booleans and the empty list.  Small dense ranges of fixnums or
+   characters are indexed directly.  */
+struct Dispatch
+{
+  struct DispatchEntry
+  {
+    objtype_t type;
+    uintptr_t key;
+    object_t *code;
+  } *entries;
+  size_t size;
+  objtype_t dense_type;
+  intmax_t dense_min;
+  object_t **dense;
+  size_t dense_span;
+};
+
 object_t *object_new (objtype_t type, void *value, heap_t *heap);
 void object_append (object_t *head, object_t *newobj);
-void object_delete (object_t *obj);
+void object_release (object_t *obj);
 uint32_t object_hash (object_t *obj);
 bool object_equals (object_t *obj1, object_t *obj2);
 
 object_t *object_new_pair (object_t *first, object_t *rest, heap_t *heap);
 object_t *object_new_port (const char *path, bool read, bool write,
                            bool append, bool binary, heap_t *heap);
+object_t *object_new_port_fd (int fd, bool read, bool write, bool binary,
+                              heap_t *heap);
+object_t *object_new_port_mapped (const char *path, heap_t *heap);
+object_t *object_new_port_memory (bool read, bool write, bool binary,
+                                  heap_t *heap);
 object_t *object_new_closure (object_t *formals, object_t *env, object_t *body,
                               heap_t *heap);
+object_t *object_new_flat_closure (object_t *proto, size_t nfrees,
+                                   heap_t *heap);
+object_t *object_new_box (object_t *value, heap_t *heap);
+object_t *object_new_dispatch (object_t **keys, object_t **codes, size_t n,
+                               heap_t *heap);
 
 object_t *object_new_environ (environ_t *parent, size_t size, heap_t *heap);
 
 object_t *object_new_vector (size_t size, heap_t *heap);
 object_t *object_new_bytevector (size_t size, heap_t *heap);
+object_t *object_new_bytevector_from (uint8_t *vals, size_t count,
+                                      heap_t *heap);
+object_t *object_new_bytevector_mapped (uint8_t *map, size_t size,
+                                        heap_t *heap);
 
 object_t *object_new_procedure (bool closure, object_t *value, heap_t *heap);
 object_t *object_new_formal (bool varargs, bool ellipses, object_t *value,
@@ -229,10 +403,19 @@ object_t *object_new_formal (bool varargs, bool ellipses, object_t *value,
 object_t *object_new_builtin (const char *name, primfn_t *fn, heap_t *heap);
 
 object_t *object_new_conti (object_t *captured_stack, heap_t *heap);
+object_t *object_new_channel (size_t capacity, heap_t *heap);
+object_t *object_new_isolate (isolate_t *iso, heap_t *heap);
+object_t *object_new_future (task_t *task, heap_t *heap);
+object_t *object_new_regexp (regexp_t *re, heap_t *heap);
+object_t *object_new_bignum (bignum_t *b, heap_t *heap);
+object_t *object_new_numvector (numvector_t *nv, heap_t *heap);
 
 object_t *object_new_stack (size_t size, heap_t *heap);
 
 object_t *object_new_symbol (const char32_t *id, size_t id_len, heap_t *heap);
+object_t *object_intern_symbol (const char32_t *id, size_t id_len,
+                                heap_t *heap);
+void object_prune_symbols (heap_t *heap);
 object_t *object_new_synobj (object_t *datum, object_t *env, heap_t *heap);
 
 object_t *object_new_integer (intmax_t value, heap_t *heap);
@@ -243,18 +426,24 @@ object_t *object_new_character (uint32_t ch, heap_t *heap);
 
 object_t *object_new_string (const char32_t *str, size_t str_len,
                              heap_t *heap);
+object_t *object_new_string_utf8 (const uint8_t *bytes, size_t size,
+                                  heap_t *heap);
+object_t *object_new_string_from (uint8_t *bytes, size_t size, heap_t *heap);
 object_t *object_new_label (const char32_t *lbl, size_t lbl_len, heap_t *heap);
 
-object_t *object_new_synobj (object_t *val, heap_t *heap);
 object_t *object_new_nil (heap_t *heap);
 
 object_t *object_new_opcode (opcode_t opcode, heap_t *heap);
 
 void stack_push (stack_t *stk, object_t *obj);
-stack_t *stack_pop (stack_t *stk);
+object_t *stack_pop (stack_t *stk);
+object_t *stack_seal (stack_t *stk, size_t split, heap_t *heap);
+
+bool dispatch_keyable (object_t *obj);
+object_t *dispatch_lookup (dispatch_t *dispatch, object_t *key);
 
 void environ_install (environ_t *env, object_t *key, object_t *value);
-object_t *environ_retrieve (environ_t *env, environ_t *key);
+object_t *environ_retrieve (environ_t *env, object_t *key);
 void environ_delete (environ_t *env, object_t *key);
 
 object_t *
@@ -278,17 +467,11 @@ cdr (object_t *pair)
   return pair->v_pair->rest;
 }
 
-static inline object_t *
-cons (object_t *car, object_t *cdr)
-{
-  return object_new_pair (car, cdr);
-}
-
 static inline size_t
 list_length (object_t *lst)
 {
-  size_t length = 1;
-  while (lst->type == OBJ_Pair && lst->type != OBJ_Nil)
+  size_t length = 0;
+  while (lst->type == OBJ_Pair)
     {
       length++;
       lst = cdr (lst);
@@ -0,0 +1,378 @@
+#include <sched.h>
+#include <stdlib.h>
+
+#include "heap.h"
+#include "interp.h"
+#include "pool.h"
+#include "utils.h"
+
+#define DEQUE_INITIAL_SIZE 256
+#define POOL_SPIN_ROUNDS 64
+
+typedef struct
+{
+  pool_t *pool;
+  size_t index;
+} worker_arg_t;
+
+/* Which deque the running thread owns and the interpreter it runs tasks
+   with.  Threads outside the pool have no deque.  */
+static _Thread_local pool_t *pool_self;
+static _Thread_local size_t pool_index;
+static _Thread_local interp_t *pool_interp;
+static _Thread_local uint64_t pool_seed;
+
+static deque_array_t *
+deque_array_new (size_t size, deque_array_t *retired)
+{
+  deque_array_t *a
+      = malloc (sizeof (deque_array_t) + size * sizeof (_Atomic (task_t *)));
+  a->size = size;
+  a->retired = retired;
+  return a;
+}
+
+static void
+deque_init (deque_t *q)
+{
+  atomic_init (&q->top, 0);
+  atomic_init (&q->bottom, 0);
+  atomic_init (&q->array, deque_array_new (DEQUE_INITIAL_SIZE, NULL));
+}
+
+static void
+deque_free (deque_t *q)
+{
+  for (deque_array_t *a = atomic_load (&q->array); a;)
+    {
+      deque_array_t *next = a->retired;
+      free (a);
+      a = next;
+    }
+}
+
+static deque_array_t *
+deque_grow (deque_t *q, deque_array_t *a, long top, long bottom)
+{
+  deque_array_t *b = deque_array_new (a->size * 2, a);
+  for (long i = top; i < bottom; i++)
+    atomic_store_explicit (
+        &b->buf[i % b->size],
+        atomic_load_explicit (&a->buf[i % a->size], memory_order_relaxed),
+        memory_order_relaxed);
+  atomic_store_explicit (&q->array, b, memory_order_release);
+  return b;
+}
+
+static void
+deque_push (deque_t *q, task_t *task)
+{
+  long b = atomic_load_explicit (&q->bottom, memory_order_relaxed);
+  long t = atomic_load_explicit (&q->top, memory_order_acquire);
+  deque_array_t *a = atomic_load_explicit (&q->array, memory_order_relaxed);
+  if (b - t > (long)a->size - 1)
+    a = deque_grow (q, a, t, b);
+
+  atomic_store_explicit (&a->buf[b % a->size], task, memory_order_relaxed);
+  atomic_thread_fence (memory_order_release);
+  atomic_store_explicit (&q->bottom, b + 1, memory_order_relaxed);
+}
+
+static task_t *
+deque_pop (deque_t *q)
+{
+  long b = atomic_load_explicit (&q->bottom, memory_order_relaxed) - 1;
+  deque_array_t *a = atomic_load_explicit (&q->array, memory_order_relaxed);
+  atomic_store_explicit (&q->bottom, b, memory_order_relaxed);
+  atomic_thread_fence (memory_order_seq_cst);
+  long t = atomic_load_explicit (&q->top, memory_order_relaxed);
+
+  if (t > b)
+    {
+      atomic_store_explicit (&q->bottom, b + 1, memory_order_relaxed);
+      return NULL;
+    }
+
+  task_t *task
+      = atomic_load_explicit (&a->buf[b % a->size], memory_order_relaxed);
+  if (t == b)
+    {
+      if (!atomic_compare_exchange_strong_explicit (&q->top, &t, t + 1,
+                                                    memory_order_seq_cst,
+                                                    memory_order_relaxed))
+        task = NULL;
+      atomic_store_explicit (&q->bottom, b + 1, memory_order_relaxed);
+    }
+  return task;
+}
+
+static task_t *
+deque_steal (deque_t *q)
+{
+  long t = atomic_load_explicit (&q->top, memory_order_acquire);
+  atomic_thread_fence (memory_order_seq_cst);
+  long b = atomic_load_explicit (&q->bottom, memory_order_acquire);
+  if (t >= b)
+    return NULL;
+
+  deque_array_t *a = atomic_load_explicit (&q->array, memory_order_acquire);
+  task_t *task
+      = atomic_load_explicit (&a->buf[t % a->size], memory_order_relaxed);
+  if (!atomic_compare_exchange_strong_explicit (&q->top, &t, t + 1,
+                                                memory_order_seq_cst,
+                                                memory_order_relaxed))
+    return NULL;
+  return task;
+}
+
+task_t *
+task_new (enum TaskKind kind, object_t *fn)
+{
+  task_t *task = calloc (1, sizeof (task_t));
+  task->kind = kind;
+  task->fn = fn;
+  atomic_init (&task->done, false);
+  atomic_init (&task->refs, 1);
+  return task;
+}
+
+void
+task_release (task_t *task)
+{
+  if (atomic_fetch_sub (&task->refs, 1) == 1)
+    free (task);
+}
+
+static void
+task_run (task_t *task, interp_t *interp)
+{
+  switch (task->kind)
+    {
+    case TASK_Thunk:
+      task->value = eval_apply (interp, task->fn, 0, NULL);
+      break;
+    case TASK_Map:
+      for (size_t i = task->lo; i < task->hi; i++)
+        task->out[i] = eval_apply (interp, task->fn, 1, &task->in[i]);
+      break;
+    case TASK_ForEach:
+      for (size_t i = task->lo; i < task->hi; i++)
+        eval_apply (interp, task->fn, 1, &task->in[i]);
+      break;
+    case TASK_Reduce:
+      {
+        object_t *args[2] = { task->in[task->lo], NULL };
+        for (size_t i = task->lo + 1; i < task->hi; i++)
+          {
+            args[1] = task->in[i];
+            args[0] = eval_apply (interp, task->fn, 2, args);
+          }
+        task->out[task->lo] = args[0];
+      }
+      break;
+    }
+
+  atomic_size_t *pending = task->pending;
+  atomic_store_explicit (&task->done, true, memory_order_release);
+  if (pending)
+    atomic_fetch_sub_explicit (pending, 1, memory_order_release);
+  task_release (task);
+}
+
+static inline uint64_t
+pool_random (void)
+{
+  pool_seed ^= pool_seed << 13;
+  pool_seed ^= pool_seed >> 7;
+  pool_seed ^= pool_seed << 17;
+  return pool_seed;
+}
+
+/* Pop from our own deque, else steal from a victim picked at random.  */
+static task_t *
+pool_take (pool_t *pool)
+{
+  task_t *task = deque_pop (&pool->deques[pool_index]);
+  if (!task)
+    {
+      size_t start = pool_random () % pool->nthreads;
+      for (size_t i = 0; i < pool->nthreads && !task; i++)
+        {
+          size_t victim = (start + i) % pool->nthreads;
+          if (victim != pool_index)
+            task = deque_steal (&pool->deques[victim]);
+        }
+    }
+  if (task)
+    atomic_fetch_sub (&pool->pending, 1);
+  return task;
+}
+
+static bool
+pool_help (pool_t *pool)
+{
+  task_t *task = pool_take (pool);
+  if (!task)
+    return false;
+  task_run (task, pool_interp);
+  return true;
+}
+
+static void *
+pool_worker (void *arg)
+{
+  worker_arg_t *w = arg;
+  pool_t *pool = w->pool;
+  pool_self = pool;
+  pool_index = w->index;
+  pool_seed = 0x9e3779b97f4a7c15u * (w->index + 1);
+  free (w);
+
+  current_heap = pool->heap;
+  object_nil = pool->nil;
+  object_true = pool->true_obj;
+  object_false = pool->false_obj;
+  pool_interp = interp_fork (pool->owner);
+
+  while (!atomic_load (&pool->shutdown))
+    {
+      bool ran = false;
+      for (size_t i = 0; i < POOL_SPIN_ROUNDS && !ran; i++)
+        ran = pool_help (pool);
+      if (ran)
+        continue;
+
+      heap_block (pool->heap);
+      pthread_mutex_lock (&pool->lock);
+      atomic_fetch_add (&pool->sleepers, 1);
+      while (!atomic_load (&pool->pending) && !atomic_load (&pool->shutdown))
+        pthread_cond_wait (&pool->wake, &pool->lock);
+      atomic_fetch_sub (&pool->sleepers, 1);
+      pthread_mutex_unlock (&pool->lock);
+      heap_unblock (pool->heap);
+    }
+
+  interp_delete (pool_interp);
+  return NULL;
+}
+
+pool_t *
+pool_new (interp_t *owner, size_t nthreads)
+{
+  pool_t *pool = calloc (1, sizeof (pool_t));
+  pool->nthreads = nthreads;
+  pool->owner = owner;
+  pool->heap = current_heap;
+  pool->nil = object_nil;
+  pool->true_obj = object_true;
+  pool->false_obj = object_false;
+  atomic_init (&pool->pending, 0);
+  atomic_init (&pool->sleepers, 0);
+  atomic_init (&pool->shutdown, false);
+  pthread_mutex_init (&pool->lock, NULL);
+  pthread_cond_init (&pool->wake, NULL);
+
+  pool->deques = calloc (nthreads, sizeof (deque_t));
+  for (size_t i = 0; i < nthreads; i++)
+    deque_init (&pool->deques[i]);
+
+  pool_self = pool;
+  pool_index = 0;
+  pool_interp = owner;
+  pool_seed = 0x9e3779b97f4a7c15u;
+
+  pool->threads = calloc (nthreads, sizeof (pthread_t));
+  for (size_t i = 1; i < nthreads; i++)
+    {
+      worker_arg_t *w = malloc (sizeof (worker_arg_t));
+      w->pool = pool;
+      w->index = i;
+      if (pthread_create (&pool->threads[i], NULL, pool_worker, w))
+        raise_runtime_error ("Could not start worker thread");
+    }
+  return pool;
+}
+
+void
+pool_delete (pool_t *pool)
+{
+  pthread_mutex_lock (&pool->lock);
+  atomic_store (&pool->shutdown, true);
+  pthread_cond_broadcast (&pool->wake);
+  pthread_mutex_unlock (&pool->lock);
+
+  for (size_t i = 1; i < pool->nthreads; i++)
+    pthread_join (pool->threads[i], NULL);
+  for (size_t i = 0; i < pool->nthreads; i++)
+    deque_free (&pool->deques[i]);
+
+  if (pool_self == pool)
+    pool_self = NULL;
+  pthread_mutex_destroy (&pool->lock);
+  pthread_cond_destroy (&pool->wake);
+  free (pool->deques);
+  free (pool->threads);
+  free (pool);
+}
+
+void
+pool_submit (pool_t *pool, task_t *task)
+{
+  if (pool_self != pool)
+    raise_runtime_error ("Task submitted from outside its pool");
+
+  atomic_fetch_add (&task->refs, 1);
+  atomic_fetch_add (&pool->pending, 1);
+  deque_push (&pool->deques[pool_index], task);
+  if (atomic_load (&pool->sleepers))
+    {
+      pthread_mutex_lock (&pool->lock);
+      pthread_cond_signal (&pool->wake);
+      pthread_mutex_unlock (&pool->lock);
+    }
+}
+
+/* Waiting threads keep running other tasks rather than block, so a task
+   that touches a future cannot starve the thread that would run it.  They
+   also poll for collections, which the task they wait on may need.  */
+void
+pool_wait (pool_t *pool, task_t *task)
+{
+  while (!atomic_load_explicit (&task->done, memory_order_acquire))
+    if (!pool_help (pool))
+      {
+        heap_safepoint (pool->heap);
+        sched_yield ();
+      }
+}
+
+void
+pool_wait_all (pool_t *pool, atomic_size_t *pending)
+{
+  while (atomic_load_explicit (pending, memory_order_acquire))
+    if (!pool_help (pool))
+      {
+        heap_safepoint (pool->heap);
+        sched_yield ();
+      }
+}
+
+/* Mark what queued tasks refer to.  Only called with the world stopped, so
+   the deques hold still while they are walked.  */
+void
+pool_mark (pool_t *pool)
+{
+  for (size_t i = 0; i < pool->nthreads; i++)
+    {
+      deque_t *q = &pool->deques[i];
+      long t = atomic_load (&q->top);
+      long b = atomic_load (&q->bottom);
+      deque_array_t *a = atomic_load (&q->array);
+      for (long j = t; j < b; j++)
+        {
+          task_t *task = atomic_load (&a->buf[j % a->size]);
+          heap_mark (task->fn);
+          heap_mark (task->value);
+        }
+    }
+}
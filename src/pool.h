@@ -0,0 +1,89 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "eval.h"
+#include "object.h"
+
+typedef struct Task task_t;
+typedef struct Deque deque_t;
+typedef struct DequeArray deque_array_t;
+typedef struct Pool pool_t;
+
+/* A unit of work.  Thunk tasks back futures; chunk tasks apply FN over
+   IN[LO, HI), storing into OUT for maps or folding into OUT[LO] for
+   reductions, and count down PENDING when finished.  OUT is rooted by
+   the submitter, so finished chunks' results survive collections that
+   happen while other chunks run.  A queued task is
+   referenced both by its submitter and by the deque, hence REFS.  Every
+   task is run by exactly the thread that took it off a deque.  */
+struct Task
+{
+  enum TaskKind
+  {
+    TASK_Thunk,
+    TASK_Map,
+    TASK_ForEach,
+    TASK_Reduce,
+  } kind;
+  object_t *fn;
+  object_t **in;
+  object_t **out;
+  size_t lo, hi;
+  object_t *value;
+  atomic_bool done;
+  atomic_size_t refs;
+  atomic_size_t *pending;
+};
+
+/* Chase-Lev work-stealing deque.  The owner pushes and pops at BOTTOM;
+   thieves take from TOP.  Arrays replaced when growing are kept on
+   RETIRED until the pool goes away, since a thief may still read them.  */
+struct DequeArray
+{
+  size_t size;
+  deque_array_t *retired;
+  _Atomic (task_t *) buf[];
+};
+
+struct Deque
+{
+  atomic_long top;
+  atomic_long bottom;
+  _Atomic (deque_array_t *) array;
+};
+
+/* Deque 0 belongs to the thread that created the pool; workers own the
+   rest and each runs its own interpreter over the shared heap.  Idle
+   workers sleep on WAKE until PENDING says there is something to steal.  */
+struct Pool
+{
+  size_t nthreads;
+  deque_t *deques;
+  pthread_t *threads;
+  interp_t *owner;
+  heap_t *heap;
+  object_t *nil, *true_obj, *false_obj;
+  atomic_size_t pending;
+  atomic_size_t sleepers;
+  atomic_bool shutdown;
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+};
+
+pool_t *pool_new (interp_t *owner, size_t nthreads);
+void pool_delete (pool_t *pool);
+
+task_t *task_new (enum TaskKind kind, object_t *fn);
+void task_release (task_t *task);
+
+void pool_submit (pool_t *pool, task_t *task);
+void pool_wait (pool_t *pool, task_t *task);
+void pool_wait_all (pool_t *pool, atomic_size_t *pending);
+void pool_mark (pool_t *pool);
+
+#endif
@@ -0,0 +1,549 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "port.h"
+#include "utf8.h"
+#include "utils.h"
+
+#define PORT_LINE_INITIAL_SIZE 128
+#define PORT_MEMORY_INITIAL_SIZE 256
+#define PORT_COPY_CHUNK ((size_t)1 << 30)
+#define PORT_COPY_BUFFER_SIZE ((size_t)1 << 20)
+
+void
+port_init (port_t *port, int fd, size_t size)
+{
+  if (size < PORT_BUFFER_MIN)
+    size = PORT_BUFFER_MIN;
+  port->fd = fd;
+  port->buf = malloc (size);
+  port->size = size;
+  port->start = port->end = 0;
+  port->dirty = false;
+  port->mapped = false;
+  port->memory = false;
+  port->shared = NULL;
+}
+
+/* A port reading straight out of a file mapping: the whole file sits in
+   its buffer from the start and there is nothing to refill from.  */
+void
+port_init_mapped (port_t *port, uint8_t *map, size_t size)
+{
+  port->fd = -1;
+  port->buf = map;
+  port->size = size;
+  port->start = 0;
+  port->end = size;
+  port->dirty = false;
+  port->mapped = true;
+  port->memory = false;
+  port->shared = NULL;
+}
+
+/* A port over memory, holding a copy of the N bytes at DATA as its input.
+   Writes append to the buffer, which doubles as needed.  */
+void
+port_init_memory (port_t *port, const uint8_t *data, size_t n)
+{
+  size_t size = PORT_MEMORY_INITIAL_SIZE;
+  while (size < n)
+    size *= 2;
+  port->fd = -1;
+  port->buf = malloc (size);
+  if (n)
+    memcpy (port->buf, data, n);
+  port->size = size;
+  port->start = 0;
+  port->end = n;
+  port->dirty = false;
+  port->mapped = false;
+  port->memory = true;
+  port->shared = NULL;
+}
+
+/* Make room for N more bytes at the end of a memory port, taking the
+   buffer back from the object it was handed to first.  */
+static void
+port_reserve (port_t *port, size_t n)
+{
+  if (port->end + n <= port->size && !port->shared)
+    return;
+
+  size_t size = port->size ? port->size : PORT_MEMORY_INITIAL_SIZE;
+  while (size < port->end + n)
+    size *= 2;
+  if (port->shared)
+    {
+      uint8_t *buf = malloc (size);
+      memcpy (buf, port->buf, port->end);
+      port->buf = buf;
+      port->shared = NULL;
+    }
+  else
+    port->buf = realloc (port->buf, size);
+  port->size = size;
+}
+
+/* Give the contents of a memory port to OWNER, which frees the buffer
+   from now on.  The port keeps reading the same bytes until its next
+   write, which copies them first.  The contents are followed by a NUL
+   for strings that take them over.  */
+uint8_t *
+port_share (port_t *port, object_t *owner, size_t *n)
+{
+  port_reserve (port, 1);
+  port->buf[port->end] = '\0';
+  port->shared = owner;
+  *n = port->end;
+  return port->buf;
+}
+
+void
+port_close (port_t *port)
+{
+  if (port->memory)
+    {
+      if (!port->shared)
+        free (port->buf);
+      return;
+    }
+  if (port->mapped)
+    {
+      if (port->buf)
+        munmap (port->buf, port->size);
+      return;
+    }
+  port_flush (port);
+  if (!port->stdio)
+    close (port->fd);
+  free (port->buf);
+}
+
+/* Map PATH read-only, returning NULL for an empty file.  ADVICE is passed
+   on to madvise.  */
+uint8_t *
+port_map_file (const char *path, size_t *size, int advice)
+{
+  int fd = open (path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    raise_runtime_error ("Could not open %s", path);
+
+  struct stat st;
+  if (fstat (fd, &st) < 0)
+    {
+      close (fd);
+      raise_runtime_error ("Could not stat %s", path);
+    }
+
+  uint8_t *map = NULL;
+  if (st.st_size)
+    {
+      map = mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map == MAP_FAILED)
+        {
+          close (fd);
+          raise_runtime_error ("Could not map %s", path);
+        }
+      madvise (map, st.st_size, advice);
+    }
+  close (fd);
+  *size = st.st_size;
+  return map;
+}
+
+/* Resizing loses nothing: pending output is flushed first and buffered
+   input is carried over, the buffer never shrinking below it.  Mapped
+   and memory ports keep the buffer they have.  */
+void
+port_set_buffer_size (port_t *port, size_t size)
+{
+  if (port->mapped || port->memory)
+    return;
+  port_flush (port);
+  size_t avail = port->end - port->start;
+  if (size < avail)
+    size = avail;
+  if (size < PORT_BUFFER_MIN)
+    size = PORT_BUFFER_MIN;
+
+  uint8_t *buf = malloc (size);
+  memcpy (buf, port->buf + port->start, avail);
+  free (port->buf);
+  port->buf = buf;
+  port->size = size;
+  port->start = 0;
+  port->end = avail;
+}
+
+/* Read more input behind what is buffered, first moving that to the front
+   of the buffer.  Returns the number of bytes read, 0 at the end of input
+   and -1 on error with errno set.  */
+ssize_t
+port_fill (port_t *port)
+{
+  if (port->mapped || port->memory)
+    return 0;
+  if (!port_flush (port))
+    return -1;
+
+  size_t avail = port->end - port->start;
+  if (port->start)
+    {
+      memmove (port->buf, port->buf + port->start, avail);
+      port->start = 0;
+      port->end = avail;
+    }
+  if (port->end == port->size)
+    {
+      errno = ENOBUFS;
+      return -1;
+    }
+
+  ssize_t n;
+  do
+    n = read (port->fd, port->buf + port->end, port->size - port->end);
+  while (n < 0 && errno == EINTR);
+  if (n > 0)
+    port->end += n;
+  return n;
+}
+
+/* Like read(2): return what is buffered, else wait for some input.  Reads
+   at least as large as the buffer go straight into DST.  */
+ssize_t
+port_read (port_t *port, uint8_t *dst, size_t n)
+{
+  if (!port_flush (port))
+    return -1;
+
+  size_t avail = port->end - port->start;
+  if (!avail && (port->mapped || port->memory))
+    return 0;
+  if (!avail && n >= port->size)
+    {
+      ssize_t r;
+      do
+        r = read (port->fd, dst, n);
+      while (r < 0 && errno == EINTR);
+      return r;
+    }
+  if (!avail)
+    {
+      ssize_t r = port_fill (port);
+      if (r <= 0)
+        return r;
+      avail = port->end - port->start;
+    }
+
+  size_t k = n < avail ? n : avail;
+  memcpy (dst, port->buf + port->start, k);
+  port->start += k;
+  return k;
+}
+
+static bool
+write_all (int fd, const uint8_t *src, size_t n, size_t *done)
+{
+  while (*done < n)
+    {
+      ssize_t w = write (fd, src + *done, n - *done);
+      if (w < 0 && errno == EINTR)
+        continue;
+      if (w < 0)
+        return false;
+      *done += w;
+    }
+  return true;
+}
+
+/* Give input read ahead back to the descriptor before writing to it.  */
+static void
+port_unread (port_t *port)
+{
+  if (port->dirty || port->fd < 0)
+    return;
+  size_t avail = port->end - port->start;
+  if (avail)
+    lseek (port->fd, -(off_t)avail, SEEK_CUR);
+  port->start = port->end = 0;
+}
+
+/* Buffer SRC, or write it straight out when it would not fit in the
+   buffer anyway.  Input read ahead is given back to the descriptor first,
+   where it can seek, so writes land where the reader had got to.  Ports
+   on the standard streams are flushed on every call to keep them in
+   order with other users of those streams.  Expects a blocking
+   descriptor.  Memory ports just grow.  */
+ssize_t
+port_write (port_t *port, const uint8_t *src, size_t n)
+{
+  if (port->memory)
+    {
+      port_reserve (port, n);
+      memcpy (port->buf + port->end, src, n);
+      port->end += n;
+      return n;
+    }
+  port_unread (port);
+
+  if (port->end + n > port->size && !port_flush (port))
+    return -1;
+  if (n >= port->size)
+    {
+      size_t done = 0;
+      if (!write_all (port->fd, src, n, &done))
+        return -1;
+    }
+  else
+    {
+      memcpy (port->buf + port->end, src, n);
+      port->end += n;
+      port->dirty = true;
+    }
+
+  if (port->stdio && !port_flush (port))
+    return -1;
+  return n;
+}
+
+/* Returns false on error with errno set, keeping what was not written.  */
+bool
+port_flush (port_t *port)
+{
+  if (!port->dirty)
+    return true;
+
+  size_t done = 0;
+  bool ok = write_all (port->fd, port->buf, port->end, &done);
+  memmove (port->buf, port->buf + done, port->end - done);
+  port->end -= done;
+  port->dirty = port->end > 0;
+  return ok;
+}
+
+/* Append K bytes from SRC to the buffer OUT of SIZE bytes holding N,
+   keeping room for a terminating NUL.  */
+static void
+append_bytes (uint8_t **out, size_t *n, size_t *size, const uint8_t *src,
+              size_t k)
+{
+  if (*n + k + 1 > *size)
+    {
+      size_t grown = *size ? *size : PORT_LINE_INITIAL_SIZE;
+      while (grown < *n + k + 1)
+        grown *= 2;
+      *out = realloc (*out, grown);
+      *size = grown;
+    }
+  memcpy (*out + *n, src, k);
+  *n += k;
+}
+
+/* Read up to the next newline, which is consumed but not returned along
+   with a carriage return before it.  The line comes back as UTF-8 from
+   malloc, with room for a terminating NUL, ready for a string to take
+   over.  Returns NULL at the end of input.  */
+uint8_t *
+port_read_line (port_t *port, size_t *len)
+{
+  uint8_t *line = NULL;
+  size_t n = 0, size = 0;
+  bool any = false;
+
+  for (;;)
+    {
+      if (port->start == port->end)
+        {
+          ssize_t r = port_fill (port);
+          if (r < 0)
+            {
+              free (line);
+              raise_runtime_error ("read failed");
+            }
+          if (!r)
+            break;
+        }
+      any = true;
+
+      const uint8_t *p = port->buf + port->start;
+      size_t avail = port->end - port->start;
+      const uint8_t *nl = memchr (p, '\n', avail);
+      size_t k = nl ? (size_t)(nl - p) : avail;
+      port->start += nl ? k + 1 : k;
+      append_bytes (&line, &n, &size, p, k);
+      if (nl)
+        break;
+    }
+
+  if (!any)
+    return NULL;
+  if (!line)
+    line = malloc (1);
+  if (n && line[n - 1] == '\r')
+    n--;
+  *len = n;
+  return line;
+}
+
+/* Read up to K characters, fewer only at the end of input, as UTF-8 like
+   port_read_line.  Returns NULL if there was nothing left to read.  */
+uint8_t *
+port_read_string (port_t *port, size_t k, size_t *len)
+{
+  uint8_t *text = NULL;
+  size_t n = 0, size = 0, chars = 0;
+  bool eof = false;
+
+  while (chars < k)
+    {
+      if (port->end - port->start < 4 && !eof)
+        {
+          ssize_t r = port_fill (port);
+          if (r < 0)
+            {
+              free (text);
+              raise_runtime_error ("read failed");
+            }
+          eof = r == 0;
+        }
+      if (port->start == port->end)
+        break;
+
+      /* A sequence starting in the last three bytes may continue past
+         them, so unless the input has ended it is decoded only once all
+         of it is buffered; otherwise the loop stops at its lead byte and
+         the fill above reads the rest first.  */
+      const uint8_t *buf = port->buf;
+      size_t i = port->start, end = port->end;
+      size_t safe = eof ? end : end > 3 ? end - 3 : 0;
+      while (chars < k && i < end
+             && (i < safe || i + utf8_sequence_length (buf[i]) <= end))
+        {
+          char32_t ch;
+          i += buf[i] < 0x80 ? 1 : utf8_decode (buf + i, end - i, &ch);
+          chars++;
+        }
+      append_bytes (&text, &n, &size, buf + port->start, i - port->start);
+      port->start = i;
+    }
+
+  if (!chars && k)
+    {
+      free (text);
+      return NULL;
+    }
+  if (!text)
+    text = malloc (1);
+  *len = n;
+  return text;
+}
+
+enum CopyMethod
+{
+  COPY_FileRange,
+  COPY_Sendfile,
+  COPY_Splice,
+  COPY_Buffer,
+};
+
+/* Move up to N bytes between descriptors with the cheapest method left.
+   Returns 0 at the end of input; an error saying METHOD does not apply
+   to these descriptors moves on to the next one.  */
+static ssize_t
+copy_chunk (port_t *src, port_t *dst, size_t n, enum CopyMethod *method,
+            uint8_t **buf)
+{
+  int from = src->fd, to = dst->fd;
+  for (;;)
+    {
+      ssize_t r;
+      switch (*method)
+        {
+        case COPY_FileRange:
+          r = copy_file_range (from, NULL, to, NULL, n, 0);
+          break;
+        case COPY_Sendfile:
+          r = sendfile (to, from, NULL, n);
+          break;
+        case COPY_Splice:
+          r = splice (from, NULL, to, NULL, n, SPLICE_F_MOVE);
+          break;
+        default:
+          if (!*buf)
+            *buf = malloc (PORT_COPY_BUFFER_SIZE);
+          if (n > PORT_COPY_BUFFER_SIZE)
+            n = PORT_COPY_BUFFER_SIZE;
+          do
+            r = read (from, *buf, n);
+          while (r < 0 && errno == EINTR);
+          if (r > 0 && port_write (dst, *buf, r) < 0)
+            return -1;
+          break;
+        }
+
+      if (r >= 0)
+        return r;
+      if (errno == EINTR)
+        continue;
+      if (*method == COPY_Buffer
+          || (errno != EINVAL && errno != EXDEV && errno != ENOSYS
+              && errno != EOPNOTSUPP && errno != EBADF))
+        return -1;
+      (*method)++;
+    }
+}
+
+/* Copy up to LIMIT bytes from SRC to DST without going through either
+   port's buffer, beyond what is already buffered.  The kernel moves the
+   data where it can: copy_file_range between files, sendfile from a
+   file and splice through a pipe, before a loop over a large buffer,
+   which is all that is left when DST is in memory.
+   Returns the number of bytes copied, or -1 on error with errno set.  */
+ssize_t
+port_copy (port_t *dst, port_t *src, size_t limit)
+{
+  if (!port_flush (dst) || !port_flush (src))
+    return -1;
+
+  size_t total = 0;
+  size_t avail = src->end - src->start;
+  if (avail)
+    {
+      size_t k = avail < limit ? avail : limit;
+      if (port_write (dst, src->buf + src->start, k) < 0)
+        return -1;
+      src->start += k;
+      total += k;
+    }
+  if (!port_flush (dst))
+    return -1;
+  port_unread (dst);
+
+  enum CopyMethod method = dst->fd >= 0 ? COPY_FileRange : COPY_Buffer;
+  uint8_t *buf = NULL;
+  while (src->fd >= 0 && total < limit)
+    {
+      size_t n = limit - total;
+      ssize_t r = copy_chunk (src, dst,
+                              n < PORT_COPY_CHUNK ? n : PORT_COPY_CHUNK,
+                              &method, &buf);
+      if (r < 0)
+        {
+          free (buf);
+          return -1;
+        }
+      if (!r)
+        break;
+      total += r;
+    }
+  free (buf);
+  return total;
+}
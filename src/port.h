@@ -0,0 +1,33 @@
+#ifndef PORT_H
+#define PORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <uchar.h>
+
+#include "object.h"
+
+#define PORT_BUFFER_SIZE 65536
+/* Room for the longest UTF-8 sequence.  */
+#define PORT_BUFFER_MIN 4
+
+void port_init (port_t *port, int fd, size_t size);
+void port_init_mapped (port_t *port, uint8_t *map, size_t size);
+void port_init_memory (port_t *port, const uint8_t *data, size_t n);
+uint8_t *port_share (port_t *port, object_t *owner, size_t *n);
+void port_close (port_t *port);
+uint8_t *port_map_file (const char *path, size_t *size, int advice);
+void port_set_buffer_size (port_t *port, size_t size);
+
+ssize_t port_fill (port_t *port);
+ssize_t port_read (port_t *port, uint8_t *dst, size_t n);
+ssize_t port_write (port_t *port, const uint8_t *src, size_t n);
+bool port_flush (port_t *port);
+ssize_t port_copy (port_t *dst, port_t *src, size_t limit);
+
+uint8_t *port_read_line (port_t *port, size_t *len);
+uint8_t *port_read_string (port_t *port, size_t k, size_t *len);
+
+#endif
@@ -0,0 +1,1018 @@
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "bignum.h"
+#include "interp.h"
+#include "object.h"
+#include "port.h"
+#include "pow5.h"
+#include "reader.h"
+#include "utf8.h"
+#include "utils.h"
+
+#define READER_SCRATCH_INITIAL_SIZE 256
+#define READER_ITEMS_INITIAL_SIZE 16
+#define READER_MAX_DIGITS 19
+#define READER_PORT_BUFFER_SIZE 65536
+
+/* Byte scanners.  Each returns the offset of the first byte at or after
+   POS that ends the run it skips, or SIZE.  With SSE2 they test sixteen
+   bytes at a time and finish the tail one byte at a time.  */
+
+static inline bool
+is_space (uint8_t c)
+{
+  return c <= ' ';
+}
+
+static inline bool
+is_delimiter (uint8_t c)
+{
+  return c <= ' ' || c == '(' || c == ')' || c == '[' || c == ']' || c == '"'
+         || c == ';' || c == '|';
+}
+
+static size_t
+scan_space (const uint8_t *buf, size_t pos, size_t size)
+{
+#ifdef __SSE2__
+  const __m128i sp = _mm_set1_epi8 (' ');
+  for (; pos + 16 <= size; pos += 16)
+    {
+      __m128i v = _mm_loadu_si128 ((const __m128i *)(buf + pos));
+      __m128i ws = _mm_cmpeq_epi8 (_mm_max_epu8 (v, sp), sp);
+      unsigned mask = ~_mm_movemask_epi8 (ws) & 0xffff;
+      if (mask)
+        return pos + __builtin_ctz (mask);
+    }
+#endif
+  while (pos < size && is_space (buf[pos]))
+    pos++;
+  return pos;
+}
+
+static size_t
+scan_delimiter (const uint8_t *buf, size_t pos, size_t size)
+{
+#ifdef __SSE2__
+  const __m128i sp = _mm_set1_epi8 (' ');
+  const __m128i open = _mm_set1_epi8 ('(');
+  const __m128i close = _mm_set1_epi8 (')');
+  const __m128i bopen = _mm_set1_epi8 ('[');
+  const __m128i bclose = _mm_set1_epi8 (']');
+  const __m128i quote = _mm_set1_epi8 ('"');
+  const __m128i semi = _mm_set1_epi8 (';');
+  const __m128i bar = _mm_set1_epi8 ('|');
+  for (; pos + 16 <= size; pos += 16)
+    {
+      __m128i v = _mm_loadu_si128 ((const __m128i *)(buf + pos));
+      __m128i d = _mm_cmpeq_epi8 (_mm_max_epu8 (v, sp), sp);
+      d = _mm_or_si128 (d, _mm_cmpeq_epi8 (v, open));
+      d = _mm_or_si128 (d, _mm_cmpeq_epi8 (v, close));
+      d = _mm_or_si128 (d, _mm_cmpeq_epi8 (v, bopen));
+      d = _mm_or_si128 (d, _mm_cmpeq_epi8 (v, bclose));
+      d = _mm_or_si128 (d, _mm_cmpeq_epi8 (v, quote));
+      d = _mm_or_si128 (d, _mm_cmpeq_epi8 (v, semi));
+      d = _mm_or_si128 (d, _mm_cmpeq_epi8 (v, bar));
+      unsigned mask = _mm_movemask_epi8 (d);
+      if (mask)
+        return pos + __builtin_ctz (mask);
+    }
+#endif
+  while (pos < size && !is_delimiter (buf[pos]))
+    pos++;
+  return pos;
+}
+
+/* End of the plain run of a string or |symbol| body: the closing TERM or
+   a backslash escape.  */
+static size_t
+scan_quoted (const uint8_t *buf, size_t pos, size_t size, uint8_t term)
+{
+#ifdef __SSE2__
+  const __m128i t = _mm_set1_epi8 ((char)term);
+  const __m128i esc = _mm_set1_epi8 ('\\');
+  for (; pos + 16 <= size; pos += 16)
+    {
+      __m128i v = _mm_loadu_si128 ((const __m128i *)(buf + pos));
+      unsigned mask = _mm_movemask_epi8 (
+          _mm_or_si128 (_mm_cmpeq_epi8 (v, t), _mm_cmpeq_epi8 (v, esc)));
+      if (mask)
+        return pos + __builtin_ctz (mask);
+    }
+#endif
+  while (pos < size && buf[pos] != term && buf[pos] != '\\')
+    pos++;
+  return pos;
+}
+
+static size_t
+count_newlines (const uint8_t *buf, size_t pos, size_t end)
+{
+  size_t n = 0;
+#ifdef __SSE2__
+  const __m128i nl = _mm_set1_epi8 ('\n');
+  for (; pos + 16 <= end; pos += 16)
+    {
+      __m128i v = _mm_loadu_si128 ((const __m128i *)(buf + pos));
+      n += __builtin_popcount (_mm_movemask_epi8 (_mm_cmpeq_epi8 (v, nl)));
+    }
+#endif
+  for (; pos < end; pos++)
+    n += buf[pos] == '\n';
+  return n;
+}
+
+static void
+scratch_reserve (reader_t *rd, size_t n)
+{
+  if (n <= rd->scratch_size)
+    return;
+  while (rd->scratch_size < n)
+    rd->scratch_size *= 2;
+  rd->scratch = realloc (rd->scratch, rd->scratch_size * sizeof (char32_t));
+}
+
+/* Append BUF[FROM, TO) to the scratch buffer at LEN, widening ASCII
+   directly.  Returns the new length.  */
+static size_t
+scratch_append (reader_t *rd, size_t len, size_t from, size_t to)
+{
+  scratch_reserve (rd, len + (to - from) + 1);
+  const uint8_t *buf = rd->buf;
+  while (from < to)
+    {
+      if (buf[from] < 0x80)
+        rd->scratch[len++] = buf[from++];
+      else
+        from += utf8_decode (buf + from, to - from, &rd->scratch[len++]);
+    }
+  return len;
+}
+
+static reader_t *
+reader_init (const uint8_t *buf, size_t size, bool track, heap_t *heap)
+{
+  reader_t *rd = calloc (1, sizeof (reader_t));
+  rd->buf = buf;
+  rd->size = size;
+  rd->track = track;
+  rd->line = 1;
+  rd->heap = heap;
+  rd->scratch_size = READER_SCRATCH_INITIAL_SIZE;
+  rd->scratch = malloc (rd->scratch_size * sizeof (char32_t));
+  return rd;
+}
+
+reader_t *
+reader_new (const uint8_t *buf, size_t size, bool track, heap_t *heap)
+{
+  return reader_init (buf, size, track, heap);
+}
+
+/* The file is mapped whole and read in place; nothing is copied until a
+   symbol or string is decoded.  */
+reader_t *
+reader_open (const char *path, bool track, heap_t *heap)
+{
+  size_t size;
+  const uint8_t *buf = port_map_file (path, &size, MADV_SEQUENTIAL);
+
+  reader_t *rd = reader_init (buf, size, track, heap);
+  rd->mapped = buf != NULL;
+  strncpy (rd->path, path, PATH_MAX);
+  rd->path[PATH_MAX] = '\0';
+  return rd;
+}
+
+/* Read PORT one datum at a time through a buffer of its own.  Only the
+   datum being read has to fit in memory: the buffer grows to hold a datum
+   larger than it and shrinks back once past it.  A memory port's input
+   is all there already, so its buffer starts just large enough for it:
+   string ports are often made to read one short datum.  */
+reader_t *
+reader_port (port_t *port, heap_t *heap)
+{
+  size_t capacity = READER_PORT_BUFFER_SIZE;
+  if (port->memory && port->end - port->start < capacity)
+    capacity = port->end - port->start + 1;
+  reader_t *rd = reader_init (malloc (capacity), 0, false, heap);
+  rd->port = port;
+  rd->capacity = capacity;
+  strncpy (rd->path, port->fpath, PATH_MAX);
+  rd->path[PATH_MAX] = '\0';
+  return rd;
+}
+
+void
+reader_close (reader_t *rd)
+{
+  if (rd->mapped)
+    munmap ((void *)rd->buf, rd->size);
+  if (rd->port)
+    free ((void *)rd->buf);
+  free (rd->scratch);
+  free (rd);
+}
+
+/* Append more input from the port, growing the buffer when it is full.
+   Offsets into the buffer stay valid, but the buffer may move, so callers
+   must reload RD->BUF after a fill.  Returns false at the end of input,
+   and always for readers over a fixed buffer.  */
+static bool
+reader_fill (reader_t *rd)
+{
+  if (!rd->port)
+    return false;
+  if (rd->size == rd->capacity)
+    {
+      rd->capacity *= 2;
+      rd->buf = realloc ((void *)rd->buf, rd->capacity);
+    }
+  ssize_t n = port_read (rd->port, (uint8_t *)rd->buf + rd->size,
+                         rd->capacity - rd->size);
+  if (n < 0)
+    raise_runtime_error ("read failed");
+  rd->size += n;
+  return n > 0;
+}
+
+/* Load input up to END, returning false if it ends first.  */
+static inline bool
+reader_ensure (reader_t *rd, size_t end)
+{
+  while (rd->size < end)
+    if (!reader_fill (rd))
+      return false;
+  return true;
+}
+
+/* The scanners again, refilling while the run reaches the end of what is
+   loaded so that a token split across two reads is still seen whole.  */
+
+static size_t
+next_nonspace (reader_t *rd, size_t pos)
+{
+  while ((pos = scan_space (rd->buf, pos, rd->size)) == rd->size
+         && reader_fill (rd))
+    ;
+  return pos;
+}
+
+static size_t
+next_delimiter (reader_t *rd, size_t pos)
+{
+  while ((pos = scan_delimiter (rd->buf, pos, rd->size)) == rd->size
+         && reader_fill (rd))
+    ;
+  return pos;
+}
+
+static size_t
+next_quoted (reader_t *rd, size_t pos, uint8_t term)
+{
+  while ((pos = scan_quoted (rd->buf, pos, rd->size, term)) == rd->size
+         && reader_fill (rd))
+    ;
+  return pos;
+}
+
+static size_t
+next_line (reader_t *rd, size_t pos)
+{
+  for (;;)
+    {
+      const uint8_t *nl = memchr (rd->buf + pos, '\n', rd->size - pos);
+      if (nl)
+        return nl - rd->buf + 1;
+      pos = rd->size;
+      if (!reader_fill (rd))
+        return pos;
+    }
+}
+
+/* Bring the line count up to POS and return POS's line and column.  */
+static void
+reader_locate (reader_t *rd, size_t pos, size_t *line, size_t *column)
+{
+  if (pos > rd->line_scan)
+    {
+      size_t n = count_newlines (rd->buf, rd->line_scan, pos);
+      if (n)
+        {
+          rd->line += n;
+          const uint8_t *nl = memrchr (rd->buf + rd->line_scan, '\n',
+                                       pos - rd->line_scan);
+          rd->line_pos = nl - rd->buf + 1;
+        }
+      rd->line_scan = pos;
+    }
+  *line = rd->line;
+  *column = pos - rd->line_pos + 1;
+}
+
+/* Drop the input before the next datum so a port reader's buffer holds
+   only what is still unread.  Lines are counted over the dropped input
+   first; LINE_POS may then fall before the buffer, which column
+   arithmetic, being modular, tolerates.  */
+static void
+reader_compact (reader_t *rd)
+{
+  size_t line, column;
+  reader_locate (rd, rd->pos, &line, &column);
+
+  size_t delta = rd->pos;
+  memmove ((uint8_t *)rd->buf, rd->buf + delta, rd->size - delta);
+  rd->size -= delta;
+  rd->pos = 0;
+  rd->line_scan -= delta;
+  rd->line_pos -= delta;
+
+  if (rd->capacity > READER_PORT_BUFFER_SIZE
+      && rd->size <= READER_PORT_BUFFER_SIZE / 2)
+    {
+      rd->capacity = READER_PORT_BUFFER_SIZE;
+      rd->buf = realloc ((void *)rd->buf, rd->capacity);
+    }
+}
+
+static void
+reader_error (reader_t *rd, const char *what)
+{
+  size_t line, column;
+  reader_locate (rd, rd->pos < rd->size ? rd->pos : rd->size, &line,
+                 &column);
+  raise_runtime_error ("%s:%zu:%zu: %s", rd->path[0] ? rd->path : "<input>",
+                       line, column, what);
+}
+
+static void
+skip_block_comment (reader_t *rd)
+{
+  size_t depth = 1;
+  size_t pos = rd->pos + 2;
+  while (depth)
+    {
+      if (!reader_ensure (rd, pos + 2))
+        {
+          rd->pos = rd->size;
+          reader_error (rd, "Unterminated block comment");
+        }
+      if (rd->buf[pos] == '|' && rd->buf[pos + 1] == '#')
+        depth--, pos += 2;
+      else if (rd->buf[pos] == '#' && rd->buf[pos + 1] == '|')
+        depth++, pos += 2;
+      else
+        pos++;
+    }
+  rd->pos = pos;
+}
+
+static object_t *read_datum (reader_t *rd);
+
+/* Skip whitespace and comments.  Returns false at the end of input.  */
+static bool
+skip_atmosphere (reader_t *rd)
+{
+  for (;;)
+    {
+      rd->pos = next_nonspace (rd, rd->pos);
+      if (rd->pos >= rd->size)
+        return false;
+
+      uint8_t c = rd->buf[rd->pos];
+      uint8_t c1
+          = c == '#' && reader_ensure (rd, rd->pos + 2) ? rd->buf[rd->pos + 1]
+                                                        : 0;
+      if (c == ';')
+        rd->pos = next_line (rd, rd->pos);
+      else if (c1 == '|')
+        skip_block_comment (rd);
+      else if (c1 == ';')
+        {
+          rd->pos += 2;
+          if (!skip_atmosphere (rd))
+            reader_error (rd, "Missing datum after #;");
+          read_datum (rd);
+        }
+      else
+        return true;
+    }
+}
+
+/* Fast path for the common case: the decimal fits a double exactly and so
+   does the power of ten, so one IEEE operation rounds correctly.  */
+static const double exact_pow10[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/* Eisel-Lemire: round W * 10^Q to the nearest double using a 128-bit
+   approximation of the power of five.  */
+static double
+eisel_lemire (uint64_t w, int64_t q)
+{
+  if (!w || q < POW5_SMALLEST)
+    return 0.0;
+  if (q > POW5_LARGEST)
+    return INFINITY;
+
+  int lz = __builtin_clzll (w);
+  w <<= lz;
+
+  const uint64_t *p = pow5_table[q - POW5_SMALLEST];
+  unsigned __int128 first = (unsigned __int128)w * p[0];
+  uint64_t hi = (uint64_t)(first >> 64), lo = (uint64_t)first;
+  const uint64_t precision_mask = UINT64_MAX >> 55;
+  if ((hi & precision_mask) == precision_mask)
+    {
+      unsigned __int128 second = (unsigned __int128)w * p[1];
+      uint64_t second_hi = (uint64_t)(second >> 64);
+      lo += second_hi;
+      if (second_hi > lo)
+        hi++;
+    }
+
+  int upperbit = (int)(hi >> 63);
+  int shift = upperbit + 64 - 52 - 3;
+  uint64_t mantissa = hi >> shift;
+  int64_t power2
+      = (((152170 + 65536) * q) >> 16) + 63 + upperbit - lz + 1023;
+
+  if (power2 <= 0)
+    {
+      if (-power2 + 1 >= 64)
+        return 0.0;
+      mantissa >>= -power2 + 1;
+      mantissa += mantissa & 1;
+      mantissa >>= 1;
+      power2 = mantissa < (UINT64_C (1) << 52) ? 0 : 1;
+    }
+  else
+    {
+      if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1
+          && (mantissa << shift) == hi)
+        mantissa &= ~UINT64_C (1);
+      mantissa += mantissa & 1;
+      mantissa >>= 1;
+      if (mantissa >= (UINT64_C (2) << 52))
+        {
+          mantissa = UINT64_C (1) << 52;
+          power2++;
+        }
+      mantissa &= ~(UINT64_C (1) << 52);
+      if (power2 >= 0x7ff)
+        return INFINITY;
+    }
+
+  uint64_t bits = mantissa | (uint64_t)power2 << 52;
+  double d;
+  memcpy (&d, &bits, sizeof (d));
+  return d;
+}
+
+/* W holds the first significant digits of the decimal in S, scaled by
+   10^Q.  When digits were dropped the value lies between W and W + 1 ulp
+   of the last kept digit; if both ends round alike that is the answer,
+   otherwise fall back to the C library.  */
+static double
+decimal_to_double (uint64_t w, int64_t q, bool truncated, const uint8_t *s,
+                   size_t n)
+{
+  if (!truncated && w <= (UINT64_C (1) << 53) && q >= -22 && q <= 22)
+    return q < 0 ? (double)w / exact_pow10[-q] : (double)w * exact_pow10[q];
+
+  double d = eisel_lemire (w, q);
+  if (!truncated || d == eisel_lemire (w + 1, q))
+    return d;
+
+  char *copy = strndup ((const char *)s, n);
+  d = strtod (copy, NULL);
+  free (copy);
+  return d;
+}
+
+static int
+digit_value (uint8_t c, int radix)
+{
+  int v = c >= '0' && c <= '9'   ? c - '0'
+          : c >= 'a' && c <= 'z' ? c - 'a' + 10
+          : c >= 'A' && c <= 'Z' ? c - 'A' + 10
+                                 : 99;
+  return v < radix ? v : -1;
+}
+
+/* Parse S[0, N) as a number in RADIX.  Integers that overflow a fixnum
+   become bignums and decimals with a point or exponent become reals.
+   Returns false if S is not a number, so the caller can read it as a
+   symbol.  */
+bool
+reader_parse_number (const uint8_t *s, size_t n, int radix, object_t **out,
+                     heap_t *heap)
+{
+  size_t i = 0;
+  bool negative = false;
+  if (i < n && (s[i] == '+' || s[i] == '-'))
+    negative = s[i++] == '-';
+  if (i == n)
+    return false;
+
+  if (n - i == 5 && i == 1
+      && (!memcmp (s + 1, "inf.0", 5) || !memcmp (s + 1, "nan.0", 5)))
+    {
+      double d = s[1] == 'i' ? INFINITY : NAN;
+      *out = object_new_real (negative ? -d : d, heap);
+      return true;
+    }
+
+  uint64_t w = 0;
+  size_t ndigits = 0, nsig = 0;
+  int64_t q = 0;
+  bool truncated = false, overflow = false, real = false;
+  uintmax_t magnitude = 0;
+
+  for (; i < n; i++)
+    {
+      int v = digit_value (s[i], radix);
+      if (v < 0)
+        break;
+      ndigits++;
+      if (magnitude > (UINTMAX_MAX - v) / radix)
+        overflow = true;
+      else
+        magnitude = magnitude * radix + v;
+      if (radix != 10)
+        continue;
+      if (nsig < READER_MAX_DIGITS)
+        {
+          if (w || v)
+            nsig++;
+          w = w * 10 + v;
+        }
+      else
+        {
+          truncated |= v != 0;
+          q++;
+        }
+    }
+
+  if (radix == 10 && i < n && s[i] == '.')
+    {
+      real = true;
+      for (i++; i < n && s[i] >= '0' && s[i] <= '9'; i++)
+        {
+          ndigits++;
+          if (nsig < READER_MAX_DIGITS)
+            {
+              if (w || s[i] != '0')
+                nsig++;
+              w = w * 10 + (s[i] - '0');
+              q--;
+            }
+          else
+            truncated |= s[i] != '0';
+        }
+    }
+  if (!ndigits)
+    return false;
+
+  if (radix == 10 && i < n && (s[i] == 'e' || s[i] == 'E'))
+    {
+      real = true;
+      i++;
+      bool eneg = false;
+      if (i < n && (s[i] == '+' || s[i] == '-'))
+        eneg = s[i++] == '-';
+      if (i == n)
+        return false;
+      int64_t e = 0;
+      for (; i < n && s[i] >= '0' && s[i] <= '9'; i++)
+        if (e < 100000)
+          e = e * 10 + (s[i] - '0');
+      q += eneg ? -e : e;
+    }
+  if (i != n)
+    return false;
+
+  if (!real && !overflow
+      && magnitude <= (uintmax_t)INTMAX_MAX + (negative ? 1 : 0))
+    {
+      *out = object_new_integer (negative ? (intmax_t)(0 - magnitude)
+                                          : (intmax_t)magnitude,
+                                 heap);
+      return true;
+    }
+
+  if (!real)
+    {
+      *out = object_new_bignum (bignum_parse (s, n, radix), heap);
+      return true;
+    }
+
+  double d = decimal_to_double (w, q, truncated, s, n);
+  if (negative)
+    d = -d;
+  *out = object_new_real (d, heap);
+  return true;
+}
+
+static object_t *
+read_quoted (reader_t *rd, const char32_t *name)
+{
+  if (!skip_atmosphere (rd))
+    reader_error (rd, "Missing datum after quote");
+  object_t *datum = read_datum (rd);
+  object_t *sym = object_intern_symbol (name, u32strlen (name), rd->heap);
+  return object_new_pair (sym, object_new_pair (datum, object_nil, rd->heap),
+                          rd->heap);
+}
+
+static object_t *
+read_list (reader_t *rd, uint8_t close)
+{
+  object_t *head = object_nil, *last = NULL;
+  rd->pos++;
+  for (;;)
+    {
+      if (!skip_atmosphere (rd))
+        reader_error (rd, "Unterminated list");
+
+      uint8_t c = rd->buf[rd->pos];
+      if (c == close)
+        {
+          rd->pos++;
+          return head;
+        }
+      if (c == ')' || c == ']')
+        reader_error (rd, "Mismatched closing bracket");
+
+      if (c == '.' && last && reader_ensure (rd, rd->pos + 2)
+          && is_delimiter (rd->buf[rd->pos + 1]))
+        {
+          rd->pos++;
+          if (!skip_atmosphere (rd))
+            reader_error (rd, "Unterminated list");
+          last->v_pair->rest = read_datum (rd);
+          if (!skip_atmosphere (rd) || rd->buf[rd->pos] != close)
+            reader_error (rd, "Expected end of dotted list");
+          rd->pos++;
+          return head;
+        }
+
+      object_t *cell = object_new_pair (read_datum (rd), object_nil, rd->heap);
+      if (last)
+        last->v_pair->rest = cell;
+      else
+        head = cell;
+      last = cell;
+    }
+}
+
+/* Read the elements of a `#(' or `#u8(' literal into a temporary array;
+   the length is only known at the closing parenthesis.  */
+static object_t **
+read_items (reader_t *rd, size_t *count)
+{
+  size_t size = READER_ITEMS_INITIAL_SIZE, n = 0;
+  object_t **items = malloc (size * sizeof (object_t *));
+  for (;;)
+    {
+      if (!skip_atmosphere (rd))
+        reader_error (rd, "Unterminated vector");
+      if (rd->buf[rd->pos] == ')')
+        break;
+      if (n == size)
+        {
+          size *= 2;
+          items = realloc (items, size * sizeof (object_t *));
+        }
+      items[n++] = read_datum (rd);
+    }
+  rd->pos++;
+  *count = n;
+  return items;
+}
+
+static object_t *
+read_vector (reader_t *rd)
+{
+  size_t n;
+  object_t **items = read_items (rd, &n);
+  object_t *vec = object_new_vector (n, rd->heap);
+  memcpy (vec->v_vector->vals, items, n * sizeof (object_t *));
+  vec->v_vector->count = n;
+  free (items);
+  return vec;
+}
+
+static object_t *
+read_bytevector (reader_t *rd)
+{
+  size_t n;
+  object_t **items = read_items (rd, &n);
+  object_t *bv = object_new_bytevector (n, rd->heap);
+  for (size_t i = 0; i < n; i++)
+    {
+      object_t *item = items[i];
+      if (item->type == OBJ_Synobj)
+        item = item->v_synobj->datum;
+      if (item->type != OBJ_Integer || item->v_integer < 0
+          || item->v_integer > 255)
+        {
+          free (items);
+          reader_error (rd, "Bytevector elements must be bytes");
+        }
+      bv->v_bytevector->vals[i] = (uint8_t)item->v_integer;
+    }
+  bv->v_bytevector->count = n;
+  free (items);
+  return bv;
+}
+
+/* Decode the body of a string or |symbol| up to TERM into the scratch
+   buffer, returning its length.  Plain runs are found a block at a time
+   and only escapes are handled byte by byte.  */
+static size_t
+read_escaped (reader_t *rd, uint8_t term)
+{
+  size_t len = 0;
+  rd->pos++;
+  for (;;)
+    {
+      size_t end = next_quoted (rd, rd->pos, term);
+      len = scratch_append (rd, len, rd->pos, end);
+      rd->pos = end;
+      if (end >= rd->size)
+        reader_error (rd, term == '"' ? "Unterminated string"
+                                      : "Unterminated symbol");
+      if (rd->buf[end] == term)
+        {
+          rd->pos++;
+          rd->scratch[len] = U'\0';
+          return len;
+        }
+
+      rd->pos++;
+      if (!reader_ensure (rd, rd->pos + 1))
+        reader_error (rd, "Unterminated escape");
+      char32_t ch;
+      uint8_t c = rd->buf[rd->pos++];
+      switch (c)
+        {
+        case 'a':
+          ch = U'\a';
+          break;
+        case 'b':
+          ch = U'\b';
+          break;
+        case 't':
+          ch = U'\t';
+          break;
+        case 'n':
+          ch = U'\n';
+          break;
+        case 'r':
+          ch = U'\r';
+          break;
+        case '0':
+          ch = U'\0';
+          break;
+        case 'x':
+        case 'X':
+          {
+            ch = 0;
+            int v;
+            while (reader_ensure (rd, rd->pos + 1)
+                   && (v = digit_value (rd->buf[rd->pos], 16)) >= 0)
+              ch = ch * 16 + v, rd->pos++;
+            if (!reader_ensure (rd, rd->pos + 1) || rd->buf[rd->pos++] != ';')
+              reader_error (rd, "Malformed hex escape");
+          }
+          break;
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+          {
+            /* Line continuation: drop the line break and the leading
+               whitespace of the next line.  */
+            size_t p = rd->pos - 1;
+            while (reader_ensure (rd, p + 1)
+                   && (rd->buf[p] == ' ' || rd->buf[p] == '\t'))
+              p++;
+            if (reader_ensure (rd, p + 1) && rd->buf[p] == '\r')
+              p++;
+            if (reader_ensure (rd, p + 1) && rd->buf[p] == '\n')
+              p++;
+            while (reader_ensure (rd, p + 1)
+                   && (rd->buf[p] == ' ' || rd->buf[p] == '\t'))
+              p++;
+            rd->pos = p;
+            continue;
+          }
+        default:
+          ch = c;
+          break;
+        }
+      scratch_reserve (rd, len + 2);
+      rd->scratch[len++] = ch;
+    }
+}
+
+static const struct
+{
+  const char *name;
+  char32_t ch;
+} char_names[] = {
+  { "alarm", 0x07 },     { "backspace", 0x08 }, { "delete", 0x7f },
+  { "escape", 0x1b },    { "newline", 0x0a },   { "linefeed", 0x0a },
+  { "null", 0x00 },      { "nul", 0x00 },       { "return", 0x0d },
+  { "space", 0x20 },     { "tab", 0x09 },
+};
+
+static object_t *
+read_character (reader_t *rd)
+{
+  size_t start = rd->pos + 2;
+  if (!reader_ensure (rd, start + 1))
+    reader_error (rd, "Missing character after #\\");
+
+  char32_t ch;
+  reader_ensure (rd, start + 4);
+  size_t len = utf8_decode (rd->buf + start, rd->size - start, &ch);
+  size_t end = next_delimiter (rd, start + len);
+  const uint8_t *buf = rd->buf;
+  rd->pos = end;
+  if (end == start + len)
+    return object_new_character (ch, rd->heap);
+
+  size_t n = end - start;
+  if ((buf[start] == 'x' || buf[start] == 'X') && n > 1)
+    {
+      char32_t cp = 0;
+      size_t i = start + 1;
+      int v;
+      for (; i < end && (v = digit_value (buf[i], 16)) >= 0; i++)
+        cp = cp * 16 + v;
+      if (i == end)
+        return object_new_character (cp, rd->heap);
+    }
+  for (size_t i = 0; i < sizeof (char_names) / sizeof (char_names[0]); i++)
+    if (strlen (char_names[i].name) == n
+        && !memcmp (buf + start, char_names[i].name, n))
+      return object_new_character (char_names[i].ch, rd->heap);
+
+  reader_error (rd, "Unknown character name");
+  return NULL;
+}
+
+static object_t *
+read_hash (reader_t *rd)
+{
+  size_t pos = rd->pos;
+  if (!reader_ensure (rd, pos + 2))
+    reader_error (rd, "Unexpected end of input after #");
+
+  uint8_t c = rd->buf[pos + 1];
+  if (c == '(')
+    {
+      rd->pos += 2;
+      return read_vector (rd);
+    }
+  if (c == 'u' && reader_ensure (rd, pos + 4) && rd->buf[pos + 2] == '8'
+      && rd->buf[pos + 3] == '(')
+    {
+      rd->pos += 4;
+      return read_bytevector (rd);
+    }
+  if (c == '\\')
+    return read_character (rd);
+
+  size_t end = next_delimiter (rd, pos + 1);
+  const uint8_t *buf = rd->buf;
+  size_t n = end - pos;
+  rd->pos = end;
+  if ((n == 2 && c == 't') || (n == 5 && !memcmp (buf + pos, "#true", 5)))
+    return object_true;
+  if ((n == 2 && c == 'f') || (n == 6 && !memcmp (buf + pos, "#false", 6)))
+    return object_false;
+
+  int radix = c == 'x' || c == 'X'   ? 16
+              : c == 'b' || c == 'B' ? 2
+              : c == 'o' || c == 'O' ? 8
+              : c == 'd' || c == 'D' ? 10
+                                     : 0;
+  object_t *num;
+  if (radix && n > 2
+      && reader_parse_number (buf + pos + 2, n - 2, radix, &num, rd->heap))
+    return num;
+
+  rd->pos = pos;
+  reader_error (rd, "Unknown # syntax");
+  return NULL;
+}
+
+static object_t *
+read_atom (reader_t *rd)
+{
+  size_t start = rd->pos;
+  size_t end = next_delimiter (rd, start);
+  const uint8_t *buf = rd->buf;
+  rd->pos = end;
+
+  uint8_t c = buf[start];
+  object_t *num;
+  if (((c >= '0' && c <= '9') || c == '+' || c == '-' || c == '.')
+      && reader_parse_number (buf + start, end - start, 10, &num, rd->heap))
+    return num;
+
+  size_t len = scratch_append (rd, 0, start, end);
+  return object_intern_symbol (rd->scratch, len, rd->heap);
+}
+
+static object_t *
+read_datum (reader_t *rd)
+{
+  size_t line = 0, column = 0;
+  if (rd->track)
+    reader_locate (rd, rd->pos, &line, &column);
+
+  object_t *datum;
+  switch (rd->buf[rd->pos])
+    {
+    case '(':
+      datum = read_list (rd, ')');
+      break;
+    case '[':
+      datum = read_list (rd, ']');
+      break;
+    case ')':
+    case ']':
+      reader_error (rd, "Unexpected closing bracket");
+      return NULL;
+    case '\'':
+      rd->pos++;
+      datum = read_quoted (rd, U"quote");
+      break;
+    case '`':
+      rd->pos++;
+      datum = read_quoted (rd, U"quasiquote");
+      break;
+    case ',':
+      rd->pos++;
+      if (reader_ensure (rd, rd->pos + 1) && rd->buf[rd->pos] == '@')
+        {
+          rd->pos++;
+          datum = read_quoted (rd, U"unquote-splicing");
+        }
+      else
+        datum = read_quoted (rd, U"unquote");
+      break;
+    case '"':
+      {
+        size_t len = read_escaped (rd, '"');
+        datum = object_new_string (rd->scratch, len, rd->heap);
+      }
+      break;
+    case '|':
+      {
+        size_t len = read_escaped (rd, '|');
+        datum = object_intern_symbol (rd->scratch, len, rd->heap);
+      }
+      break;
+    case '#':
+      datum = read_hash (rd);
+      break;
+    default:
+      datum = read_atom (rd);
+      break;
+    }
+
+  if (!rd->track)
+    return datum;
+
+  object_t *syn = object_new_synobj (datum, NULL, rd->heap);
+  memcpy (syn->v_synobj->srcfile, rd->path, sizeof rd->path);
+  syn->v_synobj->line = line;
+  syn->v_synobj->column = column;
+  return syn;
+}
+
+/* Read the next datum, or return NULL at the end of input.  */
+object_t *
+reader_read (reader_t *rd)
+{
+  if (rd->port && rd->pos >= rd->capacity / 2)
+    reader_compact (rd);
+  if (!skip_atmosphere (rd))
+    return NULL;
+  return read_datum (rd);
+}
@@ -0,0 +1,50 @@
+#ifndef READER_H
+#define READER_H
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <uchar.h>
+
+#include "heap.h"
+#include "object.h"
+
+typedef struct Reader reader_t;
+
+/* Reads data from a byte buffer, normally a whole file mapped into memory.
+   A reader over a port instead owns a buffer of CAPACITY bytes, refilled
+   from PORT as parsing runs off its end and compacted between data.  With
+   TRACK set every datum comes wrapped in a syntax object recording where
+   it started.  Lines are counted lazily, up to LINE_SCAN; LINE_POS is
+   where the current line starts.  SCRATCH holds the decoded text of the
+   symbol or string being read.  */
+struct Reader
+{
+  const uint8_t *buf;
+  size_t size;
+  size_t pos;
+  size_t capacity;
+  port_t *port;
+  bool mapped;
+  bool track;
+  size_t line;
+  size_t line_pos;
+  size_t line_scan;
+  heap_t *heap;
+  char32_t *scratch;
+  size_t scratch_size;
+  char path[PATH_MAX + 1];
+};
+
+reader_t *reader_open (const char *path, bool track, heap_t *heap);
+reader_t *reader_new (const uint8_t *buf, size_t size, bool track,
+                      heap_t *heap);
+reader_t *reader_port (port_t *port, heap_t *heap);
+void reader_close (reader_t *rd);
+object_t *reader_read (reader_t *rd);
+
+bool reader_parse_number (const uint8_t *s, size_t n, int radix,
+                          object_t **out, heap_t *heap);
+
+#endif
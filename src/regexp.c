@@ -0,0 +1,1336 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "regexp.h"
+#include "search.h"
+#include "utf8.h"
+
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+/* Patterns are parsed to a tree, then compiled into programs for a
+   Pike-style NFA over UTF-8 bytes.  Classes of characters become
+   alternations of byte-range sequences, so the automata never decode.
+   Instructions are tried in priority order, which is what gives
+   leftmost-first semantics: a lazy quantifier just swaps its SPLIT.  */
+
+enum RegexpOp
+{
+  RE_Range, /* Consume a byte in LO..HI.  */
+  RE_Split, /* Continue at X, then at Y.  */
+  RE_Jump,
+  RE_Begin, /* Start of the text.  */
+  RE_End,   /* End of the text.  */
+  RE_Fail,
+  RE_Match,
+};
+
+typedef struct RegexpInst regexp_inst_t;
+
+struct RegexpInst
+{
+  uint8_t op;
+  uint8_t lo, hi;
+  uint32_t x, y;
+};
+
+struct RegexpProg
+{
+  regexp_inst_t *insts;
+  size_t n, cap;
+};
+
+typedef struct RegexpRange regexp_range_t;
+typedef struct RegexpSet regexp_set_t;
+typedef struct RegexpNode regexp_node_t;
+typedef struct RegexpParser regexp_parser_t;
+
+struct RegexpRange
+{
+  char32_t lo, hi;
+};
+
+struct RegexpSet
+{
+  regexp_range_t *ranges;
+  size_t n, cap;
+};
+
+enum RegexpNodeKind
+{
+  RE_NODE_Empty,
+  RE_NODE_Set,
+  RE_NODE_Concat,
+  RE_NODE_Alt,
+  RE_NODE_Repeat,
+  RE_NODE_Begin,
+  RE_NODE_End,
+};
+
+/* MAX is -1 for an unbounded repeat.  Every node is also on the parser's
+   LINK list, which is how the tree is freed.  */
+struct RegexpNode
+{
+  enum RegexpNodeKind kind;
+  regexp_set_t set;
+  regexp_node_t *left, *right;
+  int min, max;
+  bool greedy;
+  regexp_node_t *link;
+};
+
+struct RegexpParser
+{
+  const uint8_t *s;
+  size_t n, pos;
+  unsigned depth;
+  regexp_node_t *nodes;
+  const char *error;
+};
+
+/* Character sets, as sorted disjoint ranges once normalized.  */
+
+static void
+set_add (regexp_set_t *set, char32_t lo, char32_t hi)
+{
+  if (set->n == set->cap)
+    {
+      set->cap = set->cap ? set->cap * 2 : 4;
+      set->ranges = realloc (set->ranges, set->cap * sizeof (regexp_range_t));
+    }
+  set->ranges[set->n++] = (regexp_range_t){ lo, hi };
+}
+
+static int
+range_compare (const void *a, const void *b)
+{
+  const regexp_range_t *x = a, *y = b;
+  return (x->lo > y->lo) - (x->lo < y->lo);
+}
+
+static void
+set_normalize (regexp_set_t *set)
+{
+  if (!set->n)
+    return;
+  qsort (set->ranges, set->n, sizeof (regexp_range_t), range_compare);
+  size_t k = 0;
+  for (size_t i = 1; i < set->n; i++)
+    {
+      regexp_range_t r = set->ranges[i];
+      if (r.lo <= set->ranges[k].hi + 1)
+        {
+          if (r.hi > set->ranges[k].hi)
+            set->ranges[k].hi = r.hi;
+        }
+      else
+        set->ranges[++k] = r;
+    }
+  set->n = k + 1;
+}
+
+/* SET must be normalized.  */
+static void
+set_negate (regexp_set_t *set)
+{
+  regexp_set_t out = { NULL, 0, 0 };
+  char32_t next = 0;
+  for (size_t i = 0; i < set->n; i++)
+    {
+      if (set->ranges[i].lo > next)
+        set_add (&out, next, set->ranges[i].lo - 1);
+      next = set->ranges[i].hi + 1;
+    }
+  if (next <= 0x10ffff)
+    set_add (&out, next, 0x10ffff);
+  free (set->ranges);
+  *set = out;
+}
+
+static const regexp_range_t digit_ranges[] = { { '0', '9' } };
+static const regexp_range_t word_ranges[]
+    = { { '0', '9' }, { 'A', 'Z' }, { '_', '_' }, { 'a', 'z' } };
+static const regexp_range_t space_ranges[] = { { '\t', '\r' }, { ' ', ' ' } };
+
+/* Add the ranges of a \d, \w or \s family escape, or their negations
+   when NEGATE.  */
+static void
+set_add_family (regexp_set_t *set, const regexp_range_t *ranges, size_t n,
+                bool negate)
+{
+  regexp_set_t part = { NULL, 0, 0 };
+  for (size_t i = 0; i < n; i++)
+    set_add (&part, ranges[i].lo, ranges[i].hi);
+  if (negate)
+    set_negate (&part);
+  for (size_t i = 0; i < part.n; i++)
+    set_add (set, part.ranges[i].lo, part.ranges[i].hi);
+  free (part.ranges);
+}
+
+/* Parsing.  */
+
+static regexp_node_t *
+node_new (regexp_parser_t *p, enum RegexpNodeKind kind)
+{
+  regexp_node_t *node = calloc (1, sizeof (regexp_node_t));
+  node->kind = kind;
+  node->link = p->nodes;
+  p->nodes = node;
+  return node;
+}
+
+static regexp_node_t *
+node_pair (regexp_parser_t *p, enum RegexpNodeKind kind, regexp_node_t *left,
+           regexp_node_t *right)
+{
+  regexp_node_t *node = node_new (p, kind);
+  node->left = left;
+  node->right = right;
+  return node;
+}
+
+static regexp_node_t *
+node_char (regexp_parser_t *p, char32_t ch)
+{
+  regexp_node_t *node = node_new (p, RE_NODE_Set);
+  set_add (&node->set, ch, ch);
+  return node;
+}
+
+static bool
+at_end (regexp_parser_t *p)
+{
+  return p->pos >= p->n;
+}
+
+static char32_t
+peek_char (regexp_parser_t *p)
+{
+  char32_t ch;
+  utf8_decode (p->s + p->pos, p->n - p->pos, &ch);
+  return ch;
+}
+
+static char32_t
+next_char (regexp_parser_t *p)
+{
+  char32_t ch;
+  p->pos += utf8_decode (p->s + p->pos, p->n - p->pos, &ch);
+  return ch;
+}
+
+static void *
+parse_error (regexp_parser_t *p, const char *msg)
+{
+  if (!p->error)
+    p->error = msg;
+  return NULL;
+}
+
+static int
+hex_value (char32_t ch)
+{
+  if (ch >= '0' && ch <= '9')
+    return ch - '0';
+  if (ch >= 'a' && ch <= 'f')
+    return ch - 'a' + 10;
+  if (ch >= 'A' && ch <= 'F')
+    return ch - 'A' + 10;
+  return -1;
+}
+
+/* \xHH or \x{H...}.  */
+static bool
+parse_hex (regexp_parser_t *p, char32_t *cp)
+{
+  bool braced = !at_end (p) && peek_char (p) == '{';
+  if (braced)
+    p->pos++;
+
+  char32_t v = 0;
+  int digits = 0;
+  while (!at_end (p) && hex_value (peek_char (p)) >= 0
+         && (braced || digits < 2))
+    {
+      v = v * 16 + hex_value (next_char (p));
+      if (v > 0x10ffff)
+        return parse_error (p, "regexp hex escape out of range");
+      digits++;
+    }
+  if (braced && (at_end (p) || next_char (p) != '}'))
+    return parse_error (p, "regexp hex escape missing }");
+  if (!digits || (!braced && digits != 2))
+    return parse_error (p, "regexp hex escape needs two digits");
+  *cp = v;
+  return true;
+}
+
+/* The escape after a backslash: either a family such as \d, added to
+   SET, or a single character stored in *CP with *SINGLE set.  */
+static bool
+parse_escape (regexp_parser_t *p, regexp_set_t *set, bool *single,
+              char32_t *cp)
+{
+  if (at_end (p))
+    return parse_error (p, "regexp ends with a backslash");
+
+  char32_t ch = next_char (p);
+  *single = false;
+  switch (ch)
+    {
+    case 'd':
+    case 'D':
+      set_add_family (set, digit_ranges, 1, ch == 'D');
+      return true;
+    case 'w':
+    case 'W':
+      set_add_family (set, word_ranges, 4, ch == 'W');
+      return true;
+    case 's':
+    case 'S':
+      set_add_family (set, space_ranges, 2, ch == 'S');
+      return true;
+    case 'n':
+      *cp = '\n';
+      break;
+    case 't':
+      *cp = '\t';
+      break;
+    case 'r':
+      *cp = '\r';
+      break;
+    case 'f':
+      *cp = '\f';
+      break;
+    case 'v':
+      *cp = '\v';
+      break;
+    case 'x':
+      if (!parse_hex (p, cp))
+        return false;
+      break;
+    default:
+      if ((ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z')
+          || (ch >= 'A' && ch <= 'Z'))
+        return parse_error (p, "unknown regexp escape");
+      *cp = ch;
+      break;
+    }
+  *single = true;
+  return true;
+}
+
+/* One end of a range inside brackets.  */
+static bool
+parse_class_atom (regexp_parser_t *p, regexp_set_t *set, bool *single,
+                  char32_t *cp)
+{
+  char32_t ch = next_char (p);
+  if (ch == '\\')
+    return parse_escape (p, set, single, cp);
+  *single = true;
+  *cp = ch;
+  return true;
+}
+
+/* After the opening bracket.  A ] first is literal, as is a - first or
+   last.  */
+static regexp_node_t *
+parse_class (regexp_parser_t *p)
+{
+  regexp_node_t *node = node_new (p, RE_NODE_Set);
+  bool negate = !at_end (p) && peek_char (p) == '^';
+  if (negate)
+    p->pos++;
+
+  bool first = true;
+  for (;;)
+    {
+      if (at_end (p))
+        return parse_error (p, "regexp class missing ]");
+      if (peek_char (p) == ']' && !first)
+        {
+          p->pos++;
+          break;
+        }
+      first = false;
+
+      bool single;
+      char32_t lo;
+      if (!parse_class_atom (p, &node->set, &single, &lo))
+        return NULL;
+      if (!single)
+        continue;
+
+      char32_t hi = lo;
+      if (p->pos + 1 < p->n && p->s[p->pos] == '-' && p->s[p->pos + 1] != ']')
+        {
+          p->pos++;
+          regexp_set_t junk = { NULL, 0, 0 };
+          bool ok = parse_class_atom (p, &junk, &single, &hi);
+          free (junk.ranges);
+          if (!ok)
+            return NULL;
+          if (!single)
+            return parse_error (p, "regexp class range ends in a family");
+          if (hi < lo)
+            return parse_error (p, "regexp class range out of order");
+        }
+      set_add (&node->set, lo, hi);
+    }
+
+  set_normalize (&node->set);
+  if (negate)
+    set_negate (&node->set);
+  return node;
+}
+
+static regexp_node_t *parse_alt (regexp_parser_t *p);
+
+static regexp_node_t *
+parse_atom (regexp_parser_t *p)
+{
+  char32_t ch = next_char (p);
+  switch (ch)
+    {
+    case '(':
+      {
+        if (p->pos + 1 < p->n && p->s[p->pos] == '?')
+          {
+            if (p->s[p->pos + 1] != ':')
+              return parse_error (p, "unsupported regexp group");
+            p->pos += 2;
+          }
+        if (++p->depth > REGEXP_MAX_DEPTH)
+          return parse_error (p, "regexp nested too deeply");
+        regexp_node_t *sub = parse_alt (p);
+        p->depth--;
+        if (!sub)
+          return NULL;
+        if (at_end (p) || next_char (p) != ')')
+          return parse_error (p, "regexp missing )");
+        return sub;
+      }
+    case '[':
+      return parse_class (p);
+    case '.':
+      {
+        regexp_node_t *node = node_char (p, '\n');
+        set_negate (&node->set);
+        return node;
+      }
+    case '^':
+      return node_new (p, RE_NODE_Begin);
+    case '$':
+      return node_new (p, RE_NODE_End);
+    case '*':
+    case '+':
+    case '?':
+      return parse_error (p, "regexp repeats nothing");
+    case '\\':
+      {
+        regexp_node_t *node = node_new (p, RE_NODE_Set);
+        bool single;
+        char32_t cp;
+        if (!parse_escape (p, &node->set, &single, &cp))
+          return NULL;
+        if (single)
+          set_add (&node->set, cp, cp);
+        set_normalize (&node->set);
+        return node;
+      }
+    default:
+      return node_char (p, ch);
+    }
+}
+
+static bool
+parse_count (regexp_parser_t *p, int *v)
+{
+  if (at_end (p) || p->s[p->pos] < '0' || p->s[p->pos] > '9')
+    return false;
+  *v = 0;
+  while (!at_end (p) && p->s[p->pos] >= '0' && p->s[p->pos] <= '9')
+    {
+      *v = *v * 10 + (p->s[p->pos++] - '0');
+      if (*v > REGEXP_MAX_REPEAT)
+        *v = REGEXP_MAX_REPEAT + 1;
+    }
+  return true;
+}
+
+/* {N}, {N,} or {N,M}.  Anything else leaves the brace to be read as a
+   literal.  */
+static bool
+parse_braces (regexp_parser_t *p, int *min, int *max)
+{
+  size_t save = p->pos++;
+  if (!parse_count (p, min))
+    goto literal;
+  *max = *min;
+  if (!at_end (p) && p->s[p->pos] == ',')
+    {
+      p->pos++;
+      if (!parse_count (p, max))
+        *max = -1;
+    }
+  if (at_end (p) || p->s[p->pos] != '}')
+    goto literal;
+  p->pos++;
+  return true;
+
+literal:
+  p->pos = save;
+  return false;
+}
+
+static regexp_node_t *
+parse_repeat (regexp_parser_t *p)
+{
+  regexp_node_t *node = parse_atom (p);
+  while (node && !at_end (p))
+    {
+      int min, max;
+      switch (p->s[p->pos])
+        {
+        case '*':
+          min = 0, max = -1;
+          p->pos++;
+          break;
+        case '+':
+          min = 1, max = -1;
+          p->pos++;
+          break;
+        case '?':
+          min = 0, max = 1;
+          p->pos++;
+          break;
+        case '{':
+          if (!parse_braces (p, &min, &max))
+            return node;
+          if (min > REGEXP_MAX_REPEAT || max > REGEXP_MAX_REPEAT)
+            return parse_error (p, "regexp repeat count too large");
+          if (max >= 0 && max < min)
+            return parse_error (p, "regexp repeat bounds out of order");
+          break;
+        default:
+          return node;
+        }
+
+      regexp_node_t *rep = node_new (p, RE_NODE_Repeat);
+      rep->left = node;
+      rep->min = min;
+      rep->max = max;
+      rep->greedy = true;
+      if (!at_end (p) && p->s[p->pos] == '?')
+        {
+          p->pos++;
+          rep->greedy = false;
+        }
+      node = rep;
+    }
+  return node;
+}
+
+static regexp_node_t *
+parse_concat (regexp_parser_t *p)
+{
+  regexp_node_t *node = node_new (p, RE_NODE_Empty);
+  while (!at_end (p) && p->s[p->pos] != '|' && p->s[p->pos] != ')')
+    {
+      regexp_node_t *item = parse_repeat (p);
+      if (!item)
+        return NULL;
+      node = node->kind == RE_NODE_Empty
+                 ? item
+                 : node_pair (p, RE_NODE_Concat, node, item);
+    }
+  return node;
+}
+
+static regexp_node_t *
+parse_alt (regexp_parser_t *p)
+{
+  regexp_node_t *node = parse_concat (p);
+  while (node && !at_end (p) && p->s[p->pos] == '|')
+    {
+      p->pos++;
+      regexp_node_t *right = parse_concat (p);
+      if (!right)
+        return NULL;
+      node = node_pair (p, RE_NODE_Alt, node, right);
+    }
+  return node;
+}
+
+/* The operands of a chain of concatenations or alternatives, which the
+   parser builds leaning left, in order.  Walking them this way keeps
+   long patterns from recursing once per character.  */
+static const regexp_node_t **
+chain_items (const regexp_node_t *node, size_t *n)
+{
+  size_t k = 1;
+  for (const regexp_node_t *t = node; t->kind == node->kind; t = t->left)
+    k++;
+
+  const regexp_node_t **items = malloc (k * sizeof (regexp_node_t *));
+  const regexp_node_t *t = node;
+  for (size_t i = k - 1; i > 0; i--, t = t->left)
+    items[i] = t->right;
+  items[0] = t;
+  *n = k;
+  return items;
+}
+
+/* The literal text every match must begin with.  Returns whether NODE
+   is literal through to its end, so that a concatenation can go on
+   past it.  */
+static bool
+literal_prefix (const regexp_node_t *node, uint8_t **buf, size_t *n)
+{
+  switch (node->kind)
+    {
+    case RE_NODE_Empty:
+      return true;
+    case RE_NODE_Set:
+      if (node->set.n != 1 || node->set.ranges[0].lo != node->set.ranges[0].hi)
+        return false;
+      *buf = realloc (*buf, *n + 4);
+      *n += utf8_encode (node->set.ranges[0].lo, *buf + *n);
+      return true;
+    case RE_NODE_Concat:
+      {
+        size_t k;
+        const regexp_node_t **items = chain_items (node, &k);
+        size_t i = 0;
+        while (i < k && literal_prefix (items[i], buf, n))
+          i++;
+        free (items);
+        return i == k;
+      }
+    case RE_NODE_Repeat:
+      if (node->min > 0)
+        literal_prefix (node->left, buf, n);
+      return false;
+    default:
+      return false;
+    }
+}
+
+/* Compiling.  */
+
+typedef struct RegexpCompiler regexp_compiler_t;
+
+struct RegexpCompiler
+{
+  regexp_prog_t *prog;
+  bool reverse;
+  unsigned depth;
+  const char *error;
+};
+
+static size_t
+emit (regexp_compiler_t *c, uint8_t op, uint8_t lo, uint8_t hi)
+{
+  regexp_prog_t *prog = c->prog;
+  if (prog->n == REGEXP_MAX_INSTS)
+    {
+      c->error = "regexp too large";
+      return prog->n - 1;
+    }
+  if (prog->n == prog->cap)
+    {
+      prog->cap = prog->cap ? prog->cap * 2 : 64;
+      prog->insts = realloc (prog->insts, prog->cap * sizeof (regexp_inst_t));
+    }
+  prog->insts[prog->n] = (regexp_inst_t){ op, lo, hi, 0, 0 };
+  return prog->n++;
+}
+
+typedef struct RegexpSeq regexp_seq_t;
+
+/* A run of one to four byte ranges matching the UTF-8 encodings of a
+   range of characters.  */
+struct RegexpSeq
+{
+  uint8_t lo[4], hi[4];
+  uint8_t len;
+};
+
+typedef struct
+{
+  regexp_seq_t *seqs;
+  size_t n, cap;
+} regexp_seqs_t;
+
+/* Split LO..HI, within one encoded length, until each piece is a plain
+   run of byte ranges: pieces whose continuation bytes do not all span
+   80..BF are cut at the boundaries where they would.  */
+static void
+utf8_sequences (char32_t lo, char32_t hi, regexp_seqs_t *out)
+{
+  static const char32_t limits[] = { 0x7f, 0x7ff, 0xffff };
+  for (int i = 0; i < 3; i++)
+    if (lo <= limits[i] && hi > limits[i])
+      {
+        utf8_sequences (lo, limits[i], out);
+        utf8_sequences (limits[i] + 1, hi, out);
+        return;
+      }
+
+  for (int i = 1; i < 4; i++)
+    {
+      char32_t m = (1u << (6 * i)) - 1;
+      if ((lo & ~m) != (hi & ~m))
+        {
+          if (lo & m)
+            {
+              utf8_sequences (lo, lo | m, out);
+              utf8_sequences ((lo | m) + 1, hi, out);
+              return;
+            }
+          if ((hi & m) != m)
+            {
+              utf8_sequences (lo, (hi & ~m) - 1, out);
+              utf8_sequences (hi & ~m, hi, out);
+              return;
+            }
+        }
+    }
+
+  if (out->n == out->cap)
+    {
+      out->cap = out->cap ? out->cap * 2 : 8;
+      out->seqs = realloc (out->seqs, out->cap * sizeof (regexp_seq_t));
+    }
+  regexp_seq_t *seq = &out->seqs[out->n++];
+  seq->len = utf8_encode (lo, seq->lo);
+  utf8_encode (hi, seq->hi);
+}
+
+static void
+compile_set (regexp_compiler_t *c, const regexp_set_t *set)
+{
+  regexp_seqs_t seqs = { NULL, 0, 0 };
+  for (size_t i = 0; i < set->n; i++)
+    {
+      char32_t lo = set->ranges[i].lo, hi = set->ranges[i].hi;
+      if (lo < 0xd800 && hi >= 0xd800)
+        utf8_sequences (lo, 0xd7ff, &seqs);
+      if (hi > 0xdfff && lo <= 0xdfff)
+        utf8_sequences (0xe000, hi, &seqs);
+      if (hi < 0xd800 || lo > 0xdfff)
+        utf8_sequences (lo, hi, &seqs);
+    }
+
+  if (!seqs.n)
+    emit (c, RE_Fail, 0, 0);
+
+  size_t *jumps = malloc (seqs.n * sizeof (size_t));
+  for (size_t i = 0; i < seqs.n && !c->error; i++)
+    {
+      size_t split = 0;
+      if (i + 1 < seqs.n)
+        {
+          split = emit (c, RE_Split, 0, 0);
+          c->prog->insts[split].x = split + 1;
+        }
+      regexp_seq_t *seq = &seqs.seqs[i];
+      for (size_t j = 0; j < seq->len; j++)
+        {
+          size_t k = c->reverse ? seq->len - 1 - j : j;
+          emit (c, RE_Range, seq->lo[k], seq->hi[k]);
+        }
+      if (i + 1 < seqs.n)
+        {
+          jumps[i] = emit (c, RE_Jump, 0, 0);
+          c->prog->insts[split].y = c->prog->n;
+        }
+    }
+  if (!c->error)
+    for (size_t i = 0; i + 1 < seqs.n; i++)
+      c->prog->insts[jumps[i]].x = c->prog->n;
+  free (jumps);
+  free (seqs.seqs);
+}
+
+/* A SPLIT whose preferred branch is the next instruction, or TARGET when
+   not GREEDY.  */
+static void
+patch_split (regexp_compiler_t *c, size_t split, size_t target, bool greedy)
+{
+  regexp_inst_t *in = &c->prog->insts[split];
+  in->x = greedy ? split + 1 : target;
+  in->y = greedy ? target : split + 1;
+}
+
+static void
+compile_node (regexp_compiler_t *c, const regexp_node_t *node)
+{
+  if (c->error)
+    return;
+  if (++c->depth > REGEXP_MAX_DEPTH)
+    {
+      c->error = "regexp nested too deeply";
+      return;
+    }
+
+  size_t k;
+  const regexp_node_t **items;
+  switch (node->kind)
+    {
+    case RE_NODE_Empty:
+      break;
+    case RE_NODE_Set:
+      compile_set (c, &node->set);
+      break;
+    case RE_NODE_Begin:
+      emit (c, c->reverse ? RE_End : RE_Begin, 0, 0);
+      break;
+    case RE_NODE_End:
+      emit (c, c->reverse ? RE_Begin : RE_End, 0, 0);
+      break;
+    case RE_NODE_Concat:
+      items = chain_items (node, &k);
+      for (size_t i = 0; i < k; i++)
+        compile_node (c, items[c->reverse ? k - 1 - i : i]);
+      free (items);
+      break;
+    case RE_NODE_Alt:
+      {
+        items = chain_items (node, &k);
+        size_t *jumps = malloc (k * sizeof (size_t));
+        for (size_t i = 0; i + 1 < k && !c->error; i++)
+          {
+            size_t split = emit (c, RE_Split, 0, 0);
+            compile_node (c, items[i]);
+            jumps[i] = emit (c, RE_Jump, 0, 0);
+            c->prog->insts[split].x = split + 1;
+            c->prog->insts[split].y = jumps[i] + 1;
+          }
+        compile_node (c, items[k - 1]);
+        if (!c->error)
+          for (size_t i = 0; i + 1 < k; i++)
+            c->prog->insts[jumps[i]].x = c->prog->n;
+        free (jumps);
+        free (items);
+      }
+      break;
+    case RE_NODE_Repeat:
+      for (int i = 0; i < node->min && !c->error; i++)
+        compile_node (c, node->left);
+      if (node->max < 0)
+        {
+          size_t split = emit (c, RE_Split, 0, 0);
+          compile_node (c, node->left);
+          size_t jump = emit (c, RE_Jump, 0, 0);
+          if (c->error)
+            return;
+          c->prog->insts[jump].x = split;
+          patch_split (c, split, jump + 1, node->greedy);
+        }
+      else
+        {
+          size_t optional = node->max - node->min;
+          size_t *splits = malloc ((optional + 1) * sizeof (size_t));
+          for (size_t i = 0; i < optional && !c->error; i++)
+            {
+              splits[i] = emit (c, RE_Split, 0, 0);
+              compile_node (c, node->left);
+            }
+          if (!c->error)
+            for (size_t i = 0; i < optional; i++)
+              patch_split (c, splits[i], c->prog->n, node->greedy);
+          free (splits);
+        }
+      break;
+    }
+  c->depth--;
+}
+
+static regexp_prog_t *
+compile_prog (const regexp_node_t *root, bool reverse, const char **error)
+{
+  regexp_prog_t *prog = calloc (1, sizeof (regexp_prog_t));
+  regexp_compiler_t c = { prog, reverse, 0, NULL };
+  compile_node (&c, root);
+  emit (&c, RE_Match, 0, 0);
+  if (c.error)
+    {
+      *error = c.error;
+      free (prog->insts);
+      free (prog);
+      return NULL;
+    }
+  return prog;
+}
+
+/* Lazy DFAs.  A state is the ordered list of NFA instructions that are
+   waiting on input, RANGE and END, and is built the first time some
+   state sees a byte of a class it has no transition for yet.  MATCH is
+   set if a match ends on entering the state.  For leftmost-first search,
+   threads behind a match are dropped as the Pike VM would, and MATCHED
+   remembers that one was found so that no new starting threads are
+   added; the search then runs until the state empties.  */
+
+typedef struct RegexpState regexp_state_t;
+
+/* The instructions are stored after the transitions, which sit at a
+   fixed offset for the search loops.  */
+struct RegexpState
+{
+  uint32_t hash;
+  bool match;
+  bool matched;
+  int8_t eof;
+  size_t n;
+  uint32_t *insts;
+  regexp_state_t *next[];
+};
+
+/* LONGEST keeps every thread instead of stopping at the first match;
+   UNANCHORED starts a new thread at every position.  START holds the
+   initial states at and after the start of the text.  */
+struct RegexpDfa
+{
+  const regexp_prog_t *prog;
+  const uint8_t *classes;
+  unsigned nclasses;
+  bool longest;
+  bool unanchored;
+  regexp_state_t **table;
+  size_t size, count;
+  size_t bytes;
+  unsigned flushes;
+  regexp_state_t *start[2];
+  uint32_t *stack;
+  uint32_t *list, *spare;
+  uint32_t *seen;
+  uint32_t gen;
+};
+
+static regexp_dfa_t *
+dfa_new (const regexp_prog_t *prog, const regexp_t *re, bool longest,
+         bool unanchored)
+{
+  regexp_dfa_t *d = calloc (1, sizeof (regexp_dfa_t));
+  d->prog = prog;
+  d->classes = re->classes;
+  d->nclasses = re->nclasses;
+  d->longest = longest;
+  d->unanchored = unanchored;
+  d->size = 64;
+  d->table = calloc (d->size, sizeof (regexp_state_t *));
+  d->stack = malloc ((2 * prog->n + 2) * sizeof (uint32_t));
+  d->list = malloc (prog->n * sizeof (uint32_t));
+  d->spare = malloc (prog->n * sizeof (uint32_t));
+  d->seen = calloc (prog->n, sizeof (uint32_t));
+  return d;
+}
+
+static void
+dfa_flush (regexp_dfa_t *d)
+{
+  for (size_t i = 0; i < d->size; i++)
+    if (d->table[i])
+      {
+        free (d->table[i]);
+        d->table[i] = NULL;
+      }
+  d->count = 0;
+  d->bytes = 0;
+  d->start[0] = d->start[1] = NULL;
+  d->flushes++;
+}
+
+static void
+dfa_delete (regexp_dfa_t *d)
+{
+  if (!d)
+    return;
+  dfa_flush (d);
+  free (d->table);
+  free (d->stack);
+  free (d->list);
+  free (d->spare);
+  free (d->seen);
+  free (d);
+}
+
+static void
+dfa_begin_step (regexp_dfa_t *d)
+{
+  if (++d->gen == 0)
+    {
+      memset (d->seen, 0, d->prog->n * sizeof (uint32_t));
+      d->gen = 1;
+    }
+}
+
+/* Append to the list the instructions reachable from PC without
+   consuming input, in priority order, skipping those already on it.
+   BEGIN and END say whether those assertions hold here.  Returns
+   whether a match was reached; for leftmost-first search everything
+   after it is cut.  */
+static bool
+dfa_add (regexp_dfa_t *d, uint32_t pc, bool begin, bool end, size_t *n)
+{
+  const regexp_inst_t *insts = d->prog->insts;
+  size_t sp = 0;
+  bool match = false;
+  d->stack[sp++] = pc;
+  while (sp)
+    {
+      pc = d->stack[--sp];
+      if (d->seen[pc] == d->gen)
+        continue;
+      d->seen[pc] = d->gen;
+
+      const regexp_inst_t *in = &insts[pc];
+      switch (in->op)
+        {
+        case RE_Split:
+          d->stack[sp++] = in->y;
+          d->stack[sp++] = in->x;
+          break;
+        case RE_Jump:
+          d->stack[sp++] = in->x;
+          break;
+        case RE_Begin:
+          if (begin)
+            d->stack[sp++] = pc + 1;
+          break;
+        case RE_End:
+          if (end)
+            d->stack[sp++] = pc + 1;
+          else
+            d->list[(*n)++] = pc;
+          break;
+        case RE_Range:
+          d->list[(*n)++] = pc;
+          break;
+        case RE_Match:
+          if (!d->longest)
+            return true;
+          match = true;
+          break;
+        default:
+          break;
+        }
+    }
+  return match;
+}
+
+static void
+dfa_grow (regexp_dfa_t *d)
+{
+  size_t size = d->size * 2;
+  regexp_state_t **table = calloc (size, sizeof (regexp_state_t *));
+  for (size_t i = 0; i < d->size; i++)
+    {
+      regexp_state_t *s = d->table[i];
+      if (!s)
+        continue;
+      size_t j = s->hash & (size - 1);
+      while (table[j])
+        j = (j + 1) & (size - 1);
+      table[j] = s;
+    }
+  free (d->table);
+  d->table = table;
+  d->size = size;
+}
+
+static regexp_state_t *dfa_start (regexp_dfa_t *d, bool begin);
+
+/* The state for the N instructions on the list, made if new.  Making
+   one past the cache budget flushes the others first.  The idle start
+   state of a search is then made again at once, on the spare list, as
+   the search loop compares against it.  */
+static regexp_state_t *
+dfa_intern (regexp_dfa_t *d, size_t n, bool match, bool matched)
+{
+  uint32_t hash = FNV_OFFSET_BASIS;
+  hash = (hash ^ (match | matched << 1)) * FNV_PRIME;
+  for (size_t i = 0; i < n; i++)
+    hash = (hash ^ d->list[i]) * FNV_PRIME;
+
+  size_t mask = d->size - 1, i = hash & mask;
+  for (regexp_state_t *s; (s = d->table[i]); i = (i + 1) & mask)
+    if (s->hash == hash && s->n == n && s->match == match
+        && s->matched == matched
+        && !memcmp (s->insts, d->list, n * sizeof (uint32_t)))
+      return s;
+
+  size_t bytes = sizeof (regexp_state_t) + n * sizeof (uint32_t)
+                 + d->nclasses * sizeof (regexp_state_t *);
+  if (d->count > 1 && d->bytes + bytes > REGEXP_CACHE_SIZE)
+    {
+      dfa_flush (d);
+      if (d->unanchored)
+        {
+          uint32_t *list = d->list;
+          d->list = d->spare;
+          dfa_start (d, false);
+          d->spare = d->list;
+          d->list = list;
+          return dfa_intern (d, n, match, matched);
+        }
+    }
+  if (2 * (d->count + 1) > d->size)
+    dfa_grow (d);
+  mask = d->size - 1;
+  for (i = hash & mask; d->table[i]; i = (i + 1) & mask)
+    ;
+
+  regexp_state_t *s = malloc (bytes);
+  memset (s->next, 0, d->nclasses * sizeof (regexp_state_t *));
+  s->insts = (uint32_t *)(s->next + d->nclasses);
+  s->hash = hash;
+  s->match = match;
+  s->matched = matched;
+  s->eof = -1;
+  s->n = n;
+  memcpy (s->insts, d->list, n * sizeof (uint32_t));
+  d->table[i] = s;
+  d->count++;
+  d->bytes += bytes;
+  return s;
+}
+
+static regexp_state_t *
+dfa_start (regexp_dfa_t *d, bool begin)
+{
+  if (d->start[begin])
+    return d->start[begin];
+
+  dfa_begin_step (d);
+  size_t n = 0;
+  bool match = dfa_add (d, 0, begin, false, &n);
+  regexp_state_t *s = dfa_intern (d, n, match, match && !d->longest);
+  d->start[begin] = s;
+  return s;
+}
+
+static regexp_state_t *
+dfa_step (regexp_dfa_t *d, regexp_state_t *s, uint8_t byte)
+{
+  const regexp_inst_t *insts = d->prog->insts;
+  size_t n = 0;
+  bool match = false;
+  dfa_begin_step (d);
+  for (size_t i = 0; i < s->n; i++)
+    {
+      const regexp_inst_t *in = &insts[s->insts[i]];
+      if (in->op != RE_Range || byte < in->lo || byte > in->hi)
+        continue;
+      if (dfa_add (d, s->insts[i] + 1, false, false, &n))
+        {
+          match = true;
+          if (!d->longest)
+            break;
+        }
+    }
+
+  bool matched = !d->longest && (s->matched || match);
+  if (d->unanchored && !matched && dfa_add (d, 0, false, false, &n))
+    match = matched = true;
+
+  unsigned flushes = d->flushes;
+  regexp_state_t *t = dfa_intern (d, n, match, matched);
+  if (d->flushes == flushes)
+    s->next[d->classes[byte]] = t;
+  return t;
+}
+
+/* Whether a match ends at the end of the text from state S, through the
+   END instructions waiting there.  BEGIN is only set for an empty text,
+   the one place both assertions hold, and is not worth caching.  */
+static bool
+dfa_eof (regexp_dfa_t *d, regexp_state_t *s, bool begin)
+{
+  if (s->eof >= 0 && !begin)
+    return s->eof;
+
+  dfa_begin_step (d);
+  size_t n = 0;
+  bool match = false;
+  for (size_t i = 0; i < s->n && !match; i++)
+    if (d->prog->insts[s->insts[i]].op == RE_End)
+      match = dfa_add (d, s->insts[i] + 1, begin, true, &n);
+  if (!begin)
+    s->eof = match;
+  return match;
+}
+
+static inline regexp_state_t *
+dfa_next (regexp_dfa_t *d, regexp_state_t *s, uint8_t byte)
+{
+  regexp_state_t *t = s->next[d->classes[byte]];
+  return t ? t : dfa_step (d, s, byte);
+}
+
+/* Compile PATTERN, SIZE bytes of UTF-8.  Returns NULL with *ERROR set if
+   it is malformed or too large.  */
+regexp_t *
+regexp_compile (const uint8_t *pattern, size_t size, const char **error)
+{
+  regexp_parser_t p = { pattern, size, 0, 0, NULL, NULL };
+  regexp_node_t *root = parse_alt (&p);
+  if (root && !at_end (&p))
+    root = parse_error (&p, "regexp has an unmatched )");
+
+  regexp_t *re = NULL;
+  if (root)
+    {
+      re = calloc (1, sizeof (regexp_t));
+      re->forward = compile_prog (root, false, error);
+      re->reverse = re->forward ? compile_prog (root, true, error) : NULL;
+      if (re->reverse)
+        literal_prefix (root, &re->prefix, &re->prefix_size);
+      else
+        {
+          regexp_release (re);
+          re = NULL;
+        }
+    }
+  else
+    *error = p.error;
+
+  for (regexp_node_t *node = p.nodes, *next; node; node = next)
+    {
+      next = node->link;
+      free (node->set.ranges);
+      free (node);
+    }
+  if (!re)
+    return NULL;
+
+  bool edge[257] = { false };
+  for (size_t i = 0; i < re->forward->n; i++)
+    {
+      const regexp_inst_t *in = &re->forward->insts[i];
+      if (in->op == RE_Range)
+        edge[in->lo] = edge[in->hi + 1] = true;
+    }
+  unsigned k = 0;
+  for (unsigned b = 0; b < 256; b++)
+    {
+      if (b && edge[b])
+        k++;
+      re->classes[b] = k;
+    }
+  re->nclasses = k + 1;
+
+  re->first = dfa_new (re->forward, re, false, true);
+  re->full = dfa_new (re->forward, re, true, false);
+  re->back = dfa_new (re->reverse, re, true, false);
+  return re;
+}
+
+static void
+prog_delete (regexp_prog_t *prog)
+{
+  if (!prog)
+    return;
+  free (prog->insts);
+  free (prog);
+}
+
+void
+regexp_release (regexp_t *re)
+{
+  dfa_delete (re->first);
+  dfa_delete (re->full);
+  dfa_delete (re->back);
+  prog_delete (re->forward);
+  prog_delete (re->reverse);
+  free (re->prefix);
+  free (re);
+}
+
+/* Whether all N bytes of S match.  */
+bool
+regexp_match (regexp_t *re, const uint8_t *s, size_t n)
+{
+  regexp_dfa_t *d = re->full;
+  regexp_state_t *st = dfa_start (d, true);
+  for (size_t pos = 0; pos < n; pos++)
+    {
+      if (!st->n)
+        return false;
+      st = dfa_next (d, st, s[pos]);
+    }
+  return st->match || dfa_eof (d, st, !n);
+}
+
+/* Where the match ending at END starts: the reverse program run back
+   from END, anchored there, keeping the last point it matched.  No
+   match may start before FROM, where the search began.  */
+static size_t
+search_back (regexp_t *re, const uint8_t *s, size_t n, size_t from,
+             size_t end)
+{
+  regexp_dfa_t *d = re->back;
+  regexp_state_t *st = dfa_start (d, end == n);
+  size_t start = SEARCH_NONE, pos = end;
+  for (;;)
+    {
+      if (st->match)
+        start = pos;
+      if (pos == from)
+        {
+          if (!from && dfa_eof (d, st, end == n && !n))
+            start = 0;
+          return start;
+        }
+      if (!st->n)
+        return start;
+      st = dfa_next (d, st, s[--pos]);
+    }
+}
+
+/* Find the leftmost-first match in the N bytes of S at or after byte
+   offset FROM, storing its bounds in *START and *END.  The forward
+   automaton finds where the match ends and the reverse one where it
+   begins, each in a single pass, so the search is linear in N.  While
+   no thread is in progress the automaton is in its start state, and the
+   text up to the next occurrence of the literal prefix can be skipped
+   with a vectorized search.  */
+bool
+regexp_search (regexp_t *re, const uint8_t *s, size_t n, size_t from,
+               size_t *start, size_t *end)
+{
+  regexp_dfa_t *d = re->first;
+  dfa_start (d, false);
+  regexp_state_t *st = dfa_start (d, from == 0);
+  size_t last = st->match ? from : SEARCH_NONE;
+  size_t pos = from;
+  while (st->n)
+    {
+      if (pos == n)
+        {
+          if (dfa_eof (d, st, !n))
+            last = n;
+          break;
+        }
+      if (st == d->start[0] && re->prefix_size)
+        {
+          size_t at = search_bytes (s + pos, n - pos, re->prefix,
+                                    re->prefix_size);
+          if (at == SEARCH_NONE)
+            break;
+          pos += at;
+        }
+      st = dfa_next (d, st, s[pos++]);
+      if (st->match)
+        last = pos;
+    }
+
+  if (last == SEARCH_NONE)
+    return false;
+  *end = last;
+  *start = search_back (re, s, n, from, last);
+  return true;
+}
@@ -0,0 +1,50 @@
+#ifndef REGEXP_H
+#define REGEXP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "object.h"
+
+/* Bounds on what a pattern may expand to, so compiling cannot run away
+   on counted repetition.  */
+#define REGEXP_MAX_INSTS 65536
+#define REGEXP_MAX_REPEAT 1000
+#define REGEXP_MAX_DEPTH 1000
+
+/* Bytes of cached DFA states each automaton may hold before its cache
+   is thrown away and rebuilt from where the search is.  */
+#define REGEXP_CACHE_SIZE (1 << 20)
+
+typedef struct RegexpProg regexp_prog_t;
+typedef struct RegexpDfa regexp_dfa_t;
+
+/* A pattern compiled to byte-level NFA programs, one running forward and
+   one backward, each run through DFAs built lazily as input is seen.
+   FIRST finds where the leftmost-first match ends, BACK then finds where
+   it starts and FULL tests whole strings.  Bytes are mapped to CLASSES
+   that no instruction tells apart.  PREFIX is a literal every match
+   begins with, if any.  */
+struct Regexp
+{
+  regexp_prog_t *forward;
+  regexp_prog_t *reverse;
+  uint8_t classes[256];
+  unsigned nclasses;
+  regexp_dfa_t *first;
+  regexp_dfa_t *full;
+  regexp_dfa_t *back;
+  uint8_t *prefix;
+  size_t prefix_size;
+};
+
+regexp_t *regexp_compile (const uint8_t *pattern, size_t size,
+                          const char **error);
+void regexp_release (regexp_t *re);
+
+bool regexp_match (regexp_t *re, const uint8_t *s, size_t n);
+bool regexp_search (regexp_t *re, const uint8_t *s, size_t n, size_t from,
+                    size_t *start, size_t *end);
+
+#endif
@@ -0,0 +1,168 @@
+#include <stdatomic.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SEARCH_AVX2 1
+#endif
+
+#include "search.h"
+
+/* Needles longer than this skip ahead with Horspool's table instead of
+   testing every position; the shift then outruns a vector's width.  */
+#define SEARCH_SKIP_MIN 64
+
+typedef size_t (*search_fn) (const uint8_t *, size_t, const uint8_t *,
+                             size_t);
+
+/* Boyer-Moore-Horspool.  The portable kernel, and the one for long
+   needles everywhere.  */
+static size_t
+find_horspool (const uint8_t *hay, size_t n, const uint8_t *needle, size_t m)
+{
+  size_t skip[256];
+  for (size_t i = 0; i < 256; i++)
+    skip[i] = m;
+  for (size_t i = 0; i + 1 < m; i++)
+    skip[needle[i]] = m - 1 - i;
+
+  uint8_t last = needle[m - 1];
+  for (size_t i = 0; i + m <= n; i += skip[hay[i + m - 1]])
+    if (hay[i + m - 1] == last && memcmp (hay + i, needle, m - 1) == 0)
+      return i;
+  return SEARCH_NONE;
+}
+
+/* Positions from POS on that are too close to the end for a full
+   vector.  */
+static size_t
+find_tail (const uint8_t *hay, size_t pos, size_t n, const uint8_t *needle,
+           size_t m)
+{
+  for (; pos + m <= n; pos++)
+    if (hay[pos] == needle[0] && hay[pos + m - 1] == needle[m - 1]
+        && memcmp (hay + pos + 1, needle + 1, m - 2) == 0)
+      return pos;
+  return SEARCH_NONE;
+}
+
+/* The vector kernels compare a block of candidate positions against the
+   first and the last byte of the needle at once, and check the middle
+   only where both match.  M is at least 2.  */
+
+#ifdef __SSE2__
+static size_t
+find_sse2 (const uint8_t *hay, size_t n, const uint8_t *needle, size_t m)
+{
+  const __m128i first = _mm_set1_epi8 ((char)needle[0]);
+  const __m128i last = _mm_set1_epi8 ((char)needle[m - 1]);
+  size_t pos = 0;
+  for (; pos + m - 1 + 16 <= n; pos += 16)
+    {
+      __m128i a = _mm_loadu_si128 ((const __m128i *)(hay + pos));
+      __m128i b = _mm_loadu_si128 ((const __m128i *)(hay + pos + m - 1));
+      unsigned mask = _mm_movemask_epi8 (
+          _mm_and_si128 (_mm_cmpeq_epi8 (a, first), _mm_cmpeq_epi8 (b, last)));
+      for (; mask; mask &= mask - 1)
+        {
+          size_t i = pos + __builtin_ctz (mask);
+          if (memcmp (hay + i + 1, needle + 1, m - 2) == 0)
+            return i;
+        }
+    }
+  return find_tail (hay, pos, n, needle, m);
+}
+#endif
+
+#ifdef SEARCH_AVX2
+__attribute__ ((target ("avx2"))) static size_t
+find_avx2 (const uint8_t *hay, size_t n, const uint8_t *needle, size_t m)
+{
+  const __m256i first = _mm256_set1_epi8 ((char)needle[0]);
+  const __m256i last = _mm256_set1_epi8 ((char)needle[m - 1]);
+  size_t pos = 0;
+  for (; pos + m - 1 + 32 <= n; pos += 32)
+    {
+      __m256i a = _mm256_loadu_si256 ((const __m256i *)(hay + pos));
+      __m256i b = _mm256_loadu_si256 ((const __m256i *)(hay + pos + m - 1));
+      unsigned mask = _mm256_movemask_epi8 (_mm256_and_si256 (
+          _mm256_cmpeq_epi8 (a, first), _mm256_cmpeq_epi8 (b, last)));
+      for (; mask; mask &= mask - 1)
+        {
+          size_t i = pos + __builtin_ctz (mask);
+          if (memcmp (hay + i + 1, needle + 1, m - 2) == 0)
+            return i;
+        }
+    }
+  return find_tail (hay, pos, n, needle, m);
+}
+#endif
+
+static search_fn
+search_resolve (void)
+{
+#ifdef SEARCH_AVX2
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("avx2"))
+    return find_avx2;
+#endif
+#ifdef __SSE2__
+  return find_sse2;
+#else
+  return find_horspool;
+#endif
+}
+
+/* Picked on first use from what the CPU supports.  Threads racing to
+   pick it store the same kernel.  */
+static _Atomic search_fn search_kernel;
+
+/* Offset of the first occurrence of the M bytes of NEEDLE in the N bytes
+   of HAY, or SEARCH_NONE.  */
+size_t
+search_bytes (const uint8_t *hay, size_t n, const uint8_t *needle, size_t m)
+{
+  if (!m)
+    return 0;
+  if (m > n)
+    return SEARCH_NONE;
+  if (m == 1)
+    {
+      const uint8_t *p = memchr (hay, needle[0], n);
+      return p ? (size_t)(p - hay) : SEARCH_NONE;
+    }
+  if (m > SEARCH_SKIP_MIN)
+    return find_horspool (hay, n, needle, m);
+
+  search_fn kernel = atomic_load_explicit (&search_kernel,
+                                           memory_order_relaxed);
+  if (!kernel)
+    {
+      kernel = search_resolve ();
+      atomic_store_explicit (&search_kernel, kernel, memory_order_relaxed);
+    }
+  return kernel (hay, n, needle, m);
+}
+
+/* Characters in N bytes of well-formed UTF-8: the bytes that are not
+   continuation bytes, 10xxxxxx, which as signed bytes are those below
+   -64.  */
+size_t
+search_count_chars (const uint8_t *s, size_t n)
+{
+  size_t k = 0, pos = 0;
+#ifdef __SSE2__
+  const __m128i cont = _mm_set1_epi8 (-65);
+  for (; pos + 16 <= n; pos += 16)
+    {
+      __m128i v = _mm_loadu_si128 ((const __m128i *)(s + pos));
+      k += __builtin_popcount (_mm_movemask_epi8 (_mm_cmpgt_epi8 (v, cont)));
+    }
+#endif
+  for (; pos < n; pos++)
+    k += (s[pos] & 0xc0) != 0x80;
+  return k;
+}
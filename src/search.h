@@ -0,0 +1,13 @@
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SEARCH_NONE SIZE_MAX
+
+size_t search_bytes (const uint8_t *hay, size_t n, const uint8_t *needle,
+                     size_t m);
+size_t search_count_chars (const uint8_t *s, size_t n);
+
+#endif
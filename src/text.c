@@ -0,0 +1,477 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "heap.h"
+#include "search.h"
+#include "text.h"
+#include "utf8.h"
+
+#define ASCII_MASK 0x8080808080808080ull
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+/* Length of the run of ASCII at the start of S, a word at a time.  */
+static size_t
+ascii_prefix (const uint8_t *s, size_t n)
+{
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    {
+      uint64_t w;
+      memcpy (&w, s + i, 8);
+      if (w & ASCII_MASK)
+        break;
+    }
+  while (i < n && s[i] < 0x80)
+    i++;
+  return i;
+}
+
+/* Count the characters from POS on, or return false at the first
+   malformed sequence.  */
+static bool
+count_characters (const uint8_t *s, size_t pos, size_t n, size_t *length)
+{
+  size_t k = 0;
+  while (pos < n)
+    {
+      if (s[pos] < 0x80)
+        {
+          pos++;
+          k++;
+          continue;
+        }
+      char32_t ch;
+      size_t len = utf8_decode (s + pos, n - pos, &ch);
+      if (len == 1)
+        return false;
+      pos += len;
+      k++;
+    }
+  *length = k;
+  return true;
+}
+
+bool
+string_valid (const uint8_t *bytes, size_t size)
+{
+  size_t ascii = ascii_prefix (bytes, size), rest;
+  return ascii == size || count_characters (bytes, ascii, size, &rest);
+}
+
+/* Take over BYTES, SIZE bytes of UTF-8 from malloc with room for a
+   terminating NUL.  Malformed sequences are replaced by U+FFFD up front,
+   so that indexing can step by lead bytes alone.  */
+void
+string_init (string_t *str, uint8_t *bytes, size_t size)
+{
+  size_t ascii = ascii_prefix (bytes, size);
+  size_t rest = 0;
+  if (ascii < size && !count_characters (bytes, ascii, size, &rest))
+    {
+      char32_t *text = malloc ((size + 1) * sizeof (char32_t));
+      size_t len = 0;
+      for (size_t i = 0; i < size;)
+        i += utf8_decode (bytes + i, size - i, &text[len++]);
+      free (bytes);
+      bytes = string_encode (text, len, &size);
+      free (text);
+      ascii = 0;
+      count_characters (bytes, 0, size, &rest);
+    }
+
+  bytes[size] = '\0';
+  str->kind = STRING_Flat;
+  str->bytes = bytes;
+  str->size = size;
+  str->length = ascii + rest;
+  str->ascii = ascii == size;
+  str->crumbs = NULL;
+  str->left = str->right = str->base = NULL;
+  str->depth = 0;
+}
+
+void
+string_release (string_t *str)
+{
+  if (str->kind != STRING_Slice)
+    free (str->bytes);
+  free (str->crumbs);
+}
+
+/* The children of a concatenation that is still a tree, or a slice's
+   base.  Flattened concatenations keep nothing else alive.  */
+void
+string_mark (string_t *str)
+{
+  if (str->kind == STRING_Slice)
+    heap_mark (str->base);
+  else if (str->kind == STRING_Concat
+           && !atomic_load_explicit ((_Atomic (uint8_t *) *)&str->bytes,
+                                     memory_order_acquire))
+    {
+      heap_mark (str->left);
+      heap_mark (str->right);
+    }
+}
+
+static inline uint8_t *
+string_load_bytes (const string_t *str)
+{
+  return atomic_load_explicit ((_Atomic (uint8_t *) *)&str->bytes,
+                               memory_order_acquire);
+}
+
+/* Copy the leaves of a tree into DST in order.  Trees are balanced, so
+   an explicit stack as deep as the tree suffices.  */
+static void
+string_gather (const string_t *str, uint8_t *dst)
+{
+  const string_t **stack = malloc ((str->depth + 1) * sizeof (string_t *));
+  size_t n = 0, pos = 0;
+  stack[n++] = str;
+  while (n)
+    {
+      const string_t *s = stack[--n];
+      const uint8_t *bytes = string_load_bytes (s);
+      if (bytes)
+        {
+          memcpy (dst + pos, bytes, s->size);
+          pos += s->size;
+          continue;
+        }
+      stack[n++] = s->right->v_string;
+      stack[n++] = s->left->v_string;
+    }
+  free (stack);
+}
+
+/* The bytes of STR, flattening a concatenation the first time.  The
+   flat copy is published with a compare-and-swap since strings are
+   shared between threads; a thread losing the race frees its copy.  A
+   slice's bytes are not NUL-terminated.  */
+const uint8_t *
+string_bytes (string_t *str)
+{
+  uint8_t *bytes = string_load_bytes (str);
+  if (bytes)
+    return bytes;
+
+  bytes = malloc (str->size + 1);
+  string_gather (str, bytes);
+  bytes[str->size] = '\0';
+
+  uint8_t *expected = NULL;
+  if (!atomic_compare_exchange_strong_explicit (
+          (_Atomic (uint8_t *) *)&str->bytes, &expected, bytes,
+          memory_order_acq_rel, memory_order_acquire))
+    {
+      free (bytes);
+      bytes = expected;
+    }
+  return bytes;
+}
+
+/* Published like the flat bytes.  */
+static size_t *
+string_crumbs (string_t *str)
+{
+  _Atomic (size_t *) *slot = (_Atomic (size_t *) *)&str->crumbs;
+  size_t *crumbs = atomic_load_explicit (slot, memory_order_acquire);
+  if (crumbs)
+    return crumbs;
+
+  const uint8_t *bytes = string_bytes (str);
+  size_t n = str->length / STRING_CRUMB_INTERVAL + 1;
+  crumbs = malloc (n * sizeof (size_t));
+  size_t pos = 0;
+  for (size_t k = 0; k < str->length; k++)
+    {
+      if (k % STRING_CRUMB_INTERVAL == 0)
+        crumbs[k / STRING_CRUMB_INTERVAL] = pos;
+      pos += utf8_sequence_length (bytes[pos]);
+    }
+  if (str->length % STRING_CRUMB_INTERVAL == 0)
+    crumbs[n - 1] = pos;
+
+  size_t *expected = NULL;
+  if (!atomic_compare_exchange_strong_explicit (slot, &expected, crumbs,
+                                                memory_order_acq_rel,
+                                                memory_order_acquire))
+    {
+      free (crumbs);
+      crumbs = expected;
+    }
+  return crumbs;
+}
+
+/* Byte offset of character K, which may be the length of the string.
+   Past the nearest breadcrumb at most STRING_CRUMB_INTERVAL - 1 lead
+   bytes are stepped over.  */
+size_t
+string_offset (string_t *str, size_t k)
+{
+  if (str->ascii)
+    return k;
+  if (k == str->length)
+    return str->size;
+
+  size_t pos = string_crumbs (str)[k / STRING_CRUMB_INTERVAL];
+  const uint8_t *bytes = string_bytes (str);
+  for (size_t i = k % STRING_CRUMB_INTERVAL; i; i--)
+    pos += utf8_sequence_length (bytes[pos]);
+  return pos;
+}
+
+/* Random access flattens a tree first.  */
+char32_t
+string_ref (string_t *str, size_t k)
+{
+  const uint8_t *bytes = string_bytes (str);
+  if (str->ascii)
+    return bytes[k];
+
+  size_t pos = string_offset (str, k);
+  char32_t ch;
+  utf8_decode (bytes + pos, str->size - pos, &ch);
+  return ch;
+}
+
+bool
+string_equal (string_t *a, string_t *b)
+{
+  return a == b
+         || (a->length == b->length && a->size == b->size
+             && memcmp (string_bytes (a), string_bytes (b), a->size) == 0);
+}
+
+/* UTF-8 orders like the code points it encodes, so comparing bytes
+   compares characters.  */
+int
+string_compare (string_t *a, string_t *b)
+{
+  if (a == b)
+    return 0;
+  size_t n = a->size < b->size ? a->size : b->size;
+  int c = memcmp (string_bytes (a), string_bytes (b), n);
+  if (c)
+    return c;
+  return (a->size > b->size) - (a->size < b->size);
+}
+
+/* Byte offset of the first occurrence of the M bytes of PAT in STR at or
+   after byte offset FROM, or SEARCH_NONE.  With both well-formed a match
+   can only begin on a character boundary.  */
+size_t
+string_find (string_t *str, const uint8_t *pat, size_t m, size_t from)
+{
+  size_t at = search_bytes (string_bytes (str) + from, str->size - from, pat,
+                            m);
+  return at == SEARCH_NONE ? at : from + at;
+}
+
+/* Character index of byte offset POS, the inverse of string_offset.  */
+size_t
+string_index (string_t *str, size_t pos)
+{
+  return str->ascii ? pos : search_count_chars (string_bytes (str), pos);
+}
+
+uint32_t
+string_hash (string_t *str)
+{
+  const uint8_t *bytes = string_bytes (str);
+  uint32_t h = FNV_OFFSET_BASIS;
+  for (size_t i = 0; i < str->size; i++)
+    h = (h ^ bytes[i]) * FNV_PRIME;
+  return h;
+}
+
+/* Encode LEN characters of TEXT into a fresh NUL-terminated buffer.  */
+uint8_t *
+string_encode (const char32_t *text, size_t len, size_t *size)
+{
+  size_t n = 0;
+  for (size_t i = 0; i < len; i++)
+    n += text[i] < 0x80     ? 1
+         : text[i] < 0x800   ? 2
+         : text[i] < 0x10000 ? 3
+                             : 4;
+
+  uint8_t *bytes = malloc (n + 1);
+  size_t pos = 0;
+  for (size_t i = 0; i < len; i++)
+    {
+      if (text[i] < 0x80)
+        bytes[pos++] = text[i];
+      else
+        pos += utf8_encode (text[i], bytes + pos);
+    }
+  bytes[n] = '\0';
+  *size = n;
+  return bytes;
+}
+
+static inline unsigned
+string_depth (object_t *s)
+{
+  string_t *str = s->v_string;
+  return str->kind == STRING_Concat && !string_load_bytes (str) ? str->depth
+                                                                 : 0;
+}
+
+static object_t *
+string_node (object_t *left, object_t *right, heap_t *heap)
+{
+  string_t *str = malloc (sizeof (string_t));
+  unsigned dl = string_depth (left), dr = string_depth (right);
+  str->kind = STRING_Concat;
+  str->bytes = NULL;
+  str->size = left->v_string->size + right->v_string->size;
+  str->length = left->v_string->length + right->v_string->length;
+  str->ascii = left->v_string->ascii && right->v_string->ascii;
+  str->crumbs = NULL;
+  str->left = left;
+  str->right = right;
+  str->base = NULL;
+  str->depth = (dl > dr ? dl : dr) + 1;
+  return object_new (OBJ_String, str, heap);
+}
+
+/* A child flattened since its parent was built counts as a leaf and
+   cannot be rotated through; the tree is then left slightly unbalanced
+   rather than looking inside it.  */
+static object_t *
+rotate_left (object_t *s, heap_t *heap)
+{
+  object_t *r = s->v_string->right;
+  if (!string_depth (r))
+    return s;
+  return string_node (string_node (s->v_string->left, r->v_string->left, heap),
+                      r->v_string->right, heap);
+}
+
+static object_t *
+rotate_right (object_t *s, heap_t *heap)
+{
+  object_t *l = s->v_string->left;
+  if (!string_depth (l))
+    return s;
+  return string_node (l->v_string->left,
+                      string_node (l->v_string->right, s->v_string->right,
+                                   heap),
+                      heap);
+}
+
+/* Join trees whose depths differ by more than one the way AVL trees are
+   joined: descend the spine of the deeper one to a subtree about as deep
+   as the other, join there and rotate on the way back up.  Nodes are
+   shared, so rotations build new ones.  */
+static object_t *
+join_right (object_t *l, object_t *r, heap_t *heap)
+{
+  object_t *a = l->v_string->left, *c = l->v_string->right;
+  object_t *t;
+  if (string_depth (c) <= string_depth (r) + 1)
+    {
+      t = string_node (c, r, heap);
+      if (string_depth (t) <= string_depth (a) + 1)
+        return string_node (a, t, heap);
+      return rotate_left (string_node (a, rotate_right (t, heap), heap), heap);
+    }
+  t = join_right (c, r, heap);
+  object_t *u = string_node (a, t, heap);
+  return string_depth (t) <= string_depth (a) + 1 ? u : rotate_left (u, heap);
+}
+
+static object_t *
+join_left (object_t *l, object_t *r, heap_t *heap)
+{
+  object_t *c = r->v_string->left, *b = r->v_string->right;
+  object_t *t;
+  if (string_depth (c) <= string_depth (l) + 1)
+    {
+      t = string_node (l, c, heap);
+      if (string_depth (t) <= string_depth (b) + 1)
+        return string_node (t, b, heap);
+      return rotate_right (string_node (rotate_left (t, heap), b, heap), heap);
+    }
+  t = join_left (l, c, heap);
+  object_t *u = string_node (t, b, heap);
+  return string_depth (t) <= string_depth (b) + 1 ? u : rotate_right (u, heap);
+}
+
+static object_t *
+string_join (object_t *l, object_t *r, heap_t *heap)
+{
+  unsigned dl = string_depth (l), dr = string_depth (r);
+  if (dl > dr + 1)
+    return join_right (l, r, heap);
+  if (dr > dl + 1)
+    return join_left (l, r, heap);
+  return string_node (l, r, heap);
+}
+
+static object_t *
+string_merge (object_t *l, object_t *r, heap_t *heap)
+{
+  size_t size = l->v_string->size + r->v_string->size;
+  uint8_t *bytes = malloc (size + 1);
+  memcpy (bytes, string_bytes (l->v_string), l->v_string->size);
+  memcpy (bytes + l->v_string->size, string_bytes (r->v_string),
+          r->v_string->size);
+  return object_new_string_from (bytes, size, heap);
+}
+
+/* Concatenate without copying, keeping the tree balanced so it stays
+   O(log n) deep however it is built.  Short pieces are merged into flat
+   leaves instead, including a short piece appended to a tree whose
+   rightmost leaf is short, so building text a little at a time does not
+   leave a leaf per call.  */
+object_t *
+string_concat (object_t *l, object_t *r, heap_t *heap)
+{
+  string_t *ls = l->v_string, *rs = r->v_string;
+  if (!rs->size)
+    return l;
+  if (!ls->size)
+    return r;
+  if (ls->size + rs->size <= STRING_LEAF_SIZE)
+    return string_merge (l, r, heap);
+
+  if (rs->size < STRING_LEAF_SIZE && string_depth (l))
+    {
+      object_t *last = ls->right;
+      if (!string_depth (last)
+          && last->v_string->size + rs->size <= STRING_LEAF_SIZE)
+        return string_join (ls->left, string_merge (last, r, heap), heap);
+    }
+  return string_join (l, r, heap);
+}
+
+/* Characters START to END of S.  Long substrings are views sharing the
+   bytes of S, which is flattened first; short ones are copied so they do
+   not keep a large string alive.  */
+object_t *
+string_slice (object_t *s, size_t start, size_t end, heap_t *heap)
+{
+  string_t *str = s->v_string;
+  const uint8_t *bytes = string_bytes (str);
+  size_t from = string_offset (str, start);
+  size_t to = string_offset (str, end);
+  if (to - from <= STRING_LEAF_SIZE)
+    return object_new_string_utf8 (bytes + from, to - from, heap);
+
+  string_t *slice = malloc (sizeof (string_t));
+  slice->kind = STRING_Slice;
+  slice->bytes = (uint8_t *)bytes + from;
+  slice->size = to - from;
+  slice->length = end - start;
+  slice->ascii = str->ascii;
+  slice->crumbs = NULL;
+  slice->left = slice->right = NULL;
+  slice->base = str->kind == STRING_Slice ? str->base : s;
+  slice->depth = 0;
+  return object_new (OBJ_String, slice, heap);
+}
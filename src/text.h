@@ -0,0 +1,34 @@
+#ifndef TEXT_H
+#define TEXT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <uchar.h>
+
+#include "object.h"
+
+#define STRING_CRUMB_INTERVAL 32
+#define STRING_LEAF_SIZE 512
+
+bool string_valid (const uint8_t *bytes, size_t size);
+void string_init (string_t *str, uint8_t *bytes, size_t size);
+void string_release (string_t *str);
+void string_mark (string_t *str);
+const uint8_t *string_bytes (string_t *str);
+
+size_t string_offset (string_t *str, size_t k);
+char32_t string_ref (string_t *str, size_t k);
+bool string_equal (string_t *a, string_t *b);
+int string_compare (string_t *a, string_t *b);
+uint32_t string_hash (string_t *str);
+
+size_t string_find (string_t *str, const uint8_t *pat, size_t m, size_t from);
+size_t string_index (string_t *str, size_t pos);
+
+object_t *string_concat (object_t *l, object_t *r, heap_t *heap);
+object_t *string_slice (object_t *s, size_t start, size_t end, heap_t *heap);
+
+uint8_t *string_encode (const char32_t *text, size_t len, size_t *size);
+
+#endif
@@ -0,0 +1,227 @@
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "unicode.h"
+#include "utf8.h"
+
+#include "unidata.h"
+
+#define UNICODE_LIMIT 0x110000
+#define CAPITAL_SIGMA 0x3a3
+#define FINAL_SIGMA 0x3c2
+/* Room for one character's full mapping.  */
+#define UNICODE_MAX_EXPANSION 12
+
+/* Two loads, one per stage.  Code points past the last plane read as
+   unassigned.  */
+const unicode_record_t *
+unicode_record (char32_t ch)
+{
+  if (ch >= UNICODE_LIMIT)
+    ch = UNICODE_LIMIT - 1;
+  unsigned block = unidata_stage1[ch >> UNIDATA_SHIFT];
+  return &unidata_records[unidata_stage2[(block << UNIDATA_SHIFT)
+                                         | (ch & UNIDATA_MASK)]];
+}
+
+/* Letters of every category.  */
+bool
+unicode_alphabetic (char32_t ch)
+{
+  return unicode_record (ch)->category <= UC_Lo;
+}
+
+bool
+unicode_numeric (char32_t ch)
+{
+  return unicode_record (ch)->category == UC_Nd;
+}
+
+/* The White_Space property: the separators and the ASCII and Latin-1
+   control characters that act as spaces.  */
+bool
+unicode_whitespace (char32_t ch)
+{
+  if (ch < 0x80)
+    return ch == ' ' || (ch >= '\t' && ch <= '\r');
+  uint8_t category = unicode_record (ch)->category;
+  return ch == 0x85 || category == UC_Zs || category == UC_Zl
+         || category == UC_Zp;
+}
+
+bool
+unicode_upper_case (char32_t ch)
+{
+  return unicode_record (ch)->flags & UNICODE_UPPERCASE;
+}
+
+bool
+unicode_lower_case (char32_t ch)
+{
+  return unicode_record (ch)->flags & UNICODE_LOWERCASE;
+}
+
+int
+unicode_digit_value (char32_t ch)
+{
+  return unicode_record (ch)->digit;
+}
+
+char32_t
+unicode_upcase (char32_t ch)
+{
+  return ch + unicode_record (ch)->upper;
+}
+
+char32_t
+unicode_downcase (char32_t ch)
+{
+  return ch + unicode_record (ch)->lower;
+}
+
+char32_t
+unicode_foldcase (char32_t ch)
+{
+  return ch + unicode_record (ch)->fold;
+}
+
+static int
+special_compare (const void *key, const void *elem)
+{
+  char32_t ch = *(const char32_t *)key;
+  const unicode_special_t *sp = elem;
+  return (ch > sp->ch) - (ch < sp->ch);
+}
+
+static const char32_t *
+special_mapping (char32_t ch, enum UnicodeCase mode)
+{
+  const unicode_special_t *sp
+      = bsearch (&ch, unidata_special,
+                 sizeof (unidata_special) / sizeof (unidata_special[0]),
+                 sizeof (unicode_special_t), special_compare);
+  return mode == UNICODE_Upcase     ? sp->upper
+         : mode == UNICODE_Downcase ? sp->lower
+                                    : sp->fold;
+}
+
+static bool
+is_cased (const unicode_record_t *rec)
+{
+  return rec->flags & (UNICODE_UPPERCASE | UNICODE_LOWERCASE)
+         || rec->category == UC_Lt;
+}
+
+/* Capital sigma lowercases to the final form at the end of a word: after
+   a cased letter and not before one.  The characters that Unicode lets
+   come in between are not skipped.  */
+static bool
+final_sigma (const uint8_t *s, size_t n, size_t pos, size_t len)
+{
+  if (!pos)
+    return false;
+  size_t prev = pos - 1;
+  while (prev && (s[prev] & 0xc0) == 0x80)
+    prev--;
+  char32_t ch;
+  utf8_decode (s + prev, pos - prev, &ch);
+  if (!is_cased (unicode_record (ch)))
+    return false;
+  if (pos + len == n)
+    return true;
+  utf8_decode (s + pos + len, n - pos - len, &ch);
+  return !is_cased (unicode_record (ch));
+}
+
+/* Convert the run of ASCII at the start of SRC into DST, sixteen bytes
+   at a time, and return its length.  Upcasing moves a-z down by 0x20;
+   downcasing and folding move A-Z up.  */
+static size_t
+convert_ascii (uint8_t *dst, const uint8_t *src, size_t n,
+               enum UnicodeCase mode)
+{
+  uint8_t lo = mode == UNICODE_Upcase ? 'a' : 'A';
+  size_t pos = 0;
+#ifdef __SSE2__
+  const __m128i below = _mm_set1_epi8 ((char)(lo - 1));
+  const __m128i above = _mm_set1_epi8 ((char)(lo + 26));
+  const __m128i bit = _mm_set1_epi8 (0x20);
+  for (; pos + 16 <= n; pos += 16)
+    {
+      __m128i v = _mm_loadu_si128 ((const __m128i *)(src + pos));
+      if (_mm_movemask_epi8 (v))
+        break;
+      __m128i letter = _mm_and_si128 (_mm_cmpgt_epi8 (v, below),
+                                      _mm_cmplt_epi8 (v, above));
+      _mm_storeu_si128 ((__m128i *)(dst + pos),
+                        _mm_xor_si128 (v, _mm_and_si128 (letter, bit)));
+    }
+#endif
+  for (; pos < n && src[pos] < 0x80; pos++)
+    {
+      uint8_t c = src[pos];
+      dst[pos] = c >= lo && c < lo + 26 ? c ^ 0x20 : c;
+    }
+  return pos;
+}
+
+/* The full case conversion of N bytes of UTF-8 as a fresh buffer from
+   malloc with room for a NUL, its length stored in *SIZE.  Runs of ASCII
+   take the vector path; anything else is looked up a character at a
+   time.  */
+uint8_t *
+unicode_convert (const uint8_t *s, size_t n, enum UnicodeCase mode,
+                 size_t *size)
+{
+  size_t cap = n + UNICODE_MAX_EXPANSION;
+  uint8_t *out = malloc (cap + 1);
+  size_t len = 0, pos = 0;
+  while (pos < n)
+    {
+      size_t run = convert_ascii (out + len, s + pos, n - pos, mode);
+      len += run;
+      pos += run;
+      if (pos == n)
+        break;
+
+      if (len + UNICODE_MAX_EXPANSION > cap)
+        {
+          cap = 2 * cap + UNICODE_MAX_EXPANSION;
+          out = realloc (out, cap + 1);
+        }
+
+      char32_t ch;
+      size_t k = utf8_decode (s + pos, n - pos, &ch);
+      const unicode_record_t *rec = unicode_record (ch);
+      if (rec->flags & UNICODE_SPECIAL)
+        {
+          const char32_t *m = special_mapping (ch, mode);
+          for (size_t i = 0; i < 3 && m[i]; i++)
+            len += utf8_encode (m[i], out + len);
+        }
+      else if (mode == UNICODE_Downcase && ch == CAPITAL_SIGMA
+               && final_sigma (s, n, pos, k))
+        len += utf8_encode (FINAL_SIGMA, out + len);
+      else
+        {
+          int32_t delta = mode == UNICODE_Upcase     ? rec->upper
+                          : mode == UNICODE_Downcase ? rec->lower
+                                                     : rec->fold;
+          len += utf8_encode (ch + delta, out + len);
+        }
+      pos += k;
+
+      if (len + (n - pos) > cap)
+        {
+          cap = len + (n - pos) + UNICODE_MAX_EXPANSION;
+          out = realloc (out, cap + 1);
+        }
+    }
+  out[len] = '\0';
+  *size = len;
+  return out;
+}
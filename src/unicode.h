@@ -0,0 +1,92 @@
+#ifndef UNICODE_H
+#define UNICODE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <uchar.h>
+
+#define UNICODE_UPPERCASE 1
+#define UNICODE_LOWERCASE 2
+#define UNICODE_SPECIAL 4
+
+typedef struct UnicodeRecord unicode_record_t;
+typedef struct UnicodeSpecial unicode_special_t;
+
+enum UnicodeCategory
+{
+  UC_Lu,
+  UC_Ll,
+  UC_Lt,
+  UC_Lm,
+  UC_Lo,
+  UC_Mn,
+  UC_Mc,
+  UC_Me,
+  UC_Nd,
+  UC_Nl,
+  UC_No,
+  UC_Pc,
+  UC_Pd,
+  UC_Ps,
+  UC_Pe,
+  UC_Pi,
+  UC_Pf,
+  UC_Po,
+  UC_Sm,
+  UC_Sc,
+  UC_Sk,
+  UC_So,
+  UC_Zs,
+  UC_Zl,
+  UC_Zp,
+  UC_Cc,
+  UC_Cf,
+  UC_Cs,
+  UC_Co,
+  UC_Cn,
+};
+
+enum UnicodeCase
+{
+  UNICODE_Upcase,
+  UNICODE_Downcase,
+  UNICODE_Foldcase,
+};
+
+/* What the tables in unidata.h hold for a character.  DIGIT is -1 for
+   anything but a decimal digit; the mappings are deltas to add to the
+   code point.  UNICODE_SPECIAL marks characters with an entry in the
+   table of longer full mappings.  */
+struct UnicodeRecord
+{
+  uint8_t category;
+  uint8_t flags;
+  int8_t digit;
+  int32_t upper, lower, fold;
+};
+
+/* Full mappings of up to three characters, padded with zeros.  */
+struct UnicodeSpecial
+{
+  char32_t ch;
+  char32_t upper[3], lower[3], fold[3];
+};
+
+const unicode_record_t *unicode_record (char32_t ch);
+
+bool unicode_alphabetic (char32_t ch);
+bool unicode_numeric (char32_t ch);
+bool unicode_whitespace (char32_t ch);
+bool unicode_upper_case (char32_t ch);
+bool unicode_lower_case (char32_t ch);
+int unicode_digit_value (char32_t ch);
+
+char32_t unicode_upcase (char32_t ch);
+char32_t unicode_downcase (char32_t ch);
+char32_t unicode_foldcase (char32_t ch);
+
+uint8_t *unicode_convert (const uint8_t *s, size_t n, enum UnicodeCase mode,
+                          size_t *size);
+
+#endif
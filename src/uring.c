@@ -0,0 +1,265 @@
+#include <stdlib.h>
+
+#include "uring.h"
+
+/* Building with NO_URING leaves only the stubs below, so that every port
+   operation takes the synchronous path, for example to benchmark against
+   it.  */
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)                   \
+    && !defined(NO_URING)
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static int
+sys_io_uring_setup (unsigned entries, struct io_uring_params *p)
+{
+  return syscall (__NR_io_uring_setup, entries, p);
+}
+
+static int
+sys_io_uring_enter (int fd, unsigned to_submit, unsigned min_complete,
+                    unsigned flags)
+{
+  return syscall (__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+                  NULL, 0);
+}
+
+static int
+sys_io_uring_register (int fd, unsigned opcode, void *arg, unsigned n)
+{
+  return syscall (__NR_io_uring_register, fd, opcode, arg, n);
+}
+
+/* Reads and writes at the current file position need IORING_OP_READ and
+   IORING_OP_WRITE and the RW_CUR_POS feature, all from Linux 5.6.  */
+static bool
+uring_supported (int fd, const struct io_uring_params *p)
+{
+  if (!(p->features & IORING_FEAT_RW_CUR_POS))
+    return false;
+
+  size_t size = sizeof (struct io_uring_probe)
+                + 256 * sizeof (struct io_uring_probe_op);
+  struct io_uring_probe *probe = calloc (1, size);
+  bool ok = sys_io_uring_register (fd, IORING_REGISTER_PROBE, probe, 256) == 0
+            && probe->last_op >= IORING_OP_WRITE
+            && probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED
+            && probe->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED;
+  free (probe);
+  return ok;
+}
+
+/* Returns NULL when the kernel lacks io_uring, or has it disabled or too
+   old for what we need, so callers can fall back to readiness polling.  */
+uring_t *
+uring_new (unsigned entries)
+{
+  struct io_uring_params p;
+  memset (&p, 0, sizeof (p));
+  int fd = sys_io_uring_setup (entries, &p);
+  if (fd < 0)
+    return NULL;
+  if (!uring_supported (fd, &p))
+    {
+      close (fd);
+      return NULL;
+    }
+
+  uring_t *ring = calloc (1, sizeof (uring_t));
+  ring->fd = fd;
+  ring->sq_entries = p.sq_entries;
+  ring->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof (unsigned);
+  ring->cq_ring_size
+      = p.cq_off.cqes + p.cq_entries * sizeof (struct io_uring_cqe);
+  bool single = p.features & IORING_FEAT_SINGLE_MMAP;
+  if (single && ring->cq_ring_size > ring->sq_ring_size)
+    ring->sq_ring_size = ring->cq_ring_size;
+
+  ring->sq_ring = mmap (NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (ring->sq_ring == MAP_FAILED)
+    goto fail;
+  if (single)
+    ring->cq_ring = ring->sq_ring;
+  else
+    {
+      ring->cq_ring = mmap (NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+      if (ring->cq_ring == MAP_FAILED)
+        goto fail;
+    }
+  ring->sqes_size = p.sq_entries * sizeof (struct io_uring_sqe);
+  ring->sqes = mmap (NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (ring->sqes == MAP_FAILED)
+    goto fail;
+
+  char *sq = ring->sq_ring, *cq = ring->cq_ring;
+  ring->sq_head = (unsigned *)(sq + p.sq_off.head);
+  ring->sq_tail = (unsigned *)(sq + p.sq_off.tail);
+  ring->sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+  ring->sq_array = (unsigned *)(sq + p.sq_off.array);
+  ring->cq_head = (unsigned *)(cq + p.cq_off.head);
+  ring->cq_tail = (unsigned *)(cq + p.cq_off.tail);
+  ring->cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+  ring->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+  return ring;
+
+fail:
+  if (ring->sq_ring != MAP_FAILED && ring->sq_ring)
+    munmap (ring->sq_ring, ring->sq_ring_size);
+  if (!single && ring->cq_ring != MAP_FAILED && ring->cq_ring)
+    munmap (ring->cq_ring, ring->cq_ring_size);
+  close (fd);
+  free (ring);
+  return NULL;
+}
+
+void
+uring_delete (uring_t *ring)
+{
+  if (!ring)
+    return;
+  munmap (ring->sqes, ring->sqes_size);
+  if (ring->cq_ring != ring->sq_ring)
+    munmap (ring->cq_ring, ring->cq_ring_size);
+  munmap (ring->sq_ring, ring->sq_ring_size);
+  close (ring->fd);
+  free (ring);
+}
+
+/* Take the next free submission slot, handing the queued ones to the
+   kernel first if the ring is full.  */
+static struct io_uring_sqe *
+uring_sqe (uring_t *ring)
+{
+  unsigned tail = *ring->sq_tail;
+  if (tail - __atomic_load_n (ring->sq_head, __ATOMIC_ACQUIRE)
+      == ring->sq_entries)
+    {
+      uring_submit (ring);
+      if (tail - __atomic_load_n (ring->sq_head, __ATOMIC_ACQUIRE)
+          == ring->sq_entries)
+        return NULL;
+    }
+
+  unsigned idx = tail & *ring->sq_mask;
+  struct io_uring_sqe *sqe = &ring->sqes[idx];
+  memset (sqe, 0, sizeof (*sqe));
+  ring->sq_array[idx] = idx;
+  return sqe;
+}
+
+static void
+uring_queue (uring_t *ring)
+{
+  __atomic_store_n (ring->sq_tail, *ring->sq_tail + 1, __ATOMIC_RELEASE);
+  ring->pending++;
+}
+
+/* Queue a transfer at the descriptor's current position.  Returns false
+   when the ring has no room even after submitting.  */
+static bool
+uring_rw (uring_t *ring, int op, int fd, const void *buf, size_t n,
+          uint64_t data)
+{
+  struct io_uring_sqe *sqe = uring_sqe (ring);
+  if (!sqe)
+    return false;
+
+  sqe->opcode = op;
+  sqe->fd = fd;
+  sqe->addr = (uint64_t)(uintptr_t)buf;
+  sqe->len = n > UINT32_MAX ? UINT32_MAX : n;
+  sqe->off = (uint64_t)-1;
+  sqe->user_data = data;
+  uring_queue (ring);
+  return true;
+}
+
+bool
+uring_read (uring_t *ring, int fd, void *buf, size_t n, uint64_t data)
+{
+  return uring_rw (ring, IORING_OP_READ, fd, buf, n, data);
+}
+
+bool
+uring_write (uring_t *ring, int fd, const void *buf, size_t n, uint64_t data)
+{
+  return uring_rw (ring, IORING_OP_WRITE, fd, buf, n, data);
+}
+
+/* Hand everything queued to the kernel in one call, without waiting for
+   completions.  Returns how many were taken, or -1 with errno set.  */
+int
+uring_submit (uring_t *ring)
+{
+  if (!ring->pending)
+    return 0;
+
+  int n;
+  do
+    n = sys_io_uring_enter (ring->fd, ring->pending, 0, 0);
+  while (n < 0 && errno == EINTR);
+  if (n > 0)
+    ring->pending -= n;
+  return n;
+}
+
+bool
+uring_reap (uring_t *ring, uint64_t *data, int32_t *res)
+{
+  unsigned head = *ring->cq_head;
+  if (head == __atomic_load_n (ring->cq_tail, __ATOMIC_ACQUIRE))
+    return false;
+
+  struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+  *data = cqe->user_data;
+  *res = cqe->res;
+  __atomic_store_n (ring->cq_head, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+#else
+
+uring_t *
+uring_new (unsigned entries)
+{
+  return NULL;
+}
+
+void
+uring_delete (uring_t *ring)
+{
+}
+
+bool
+uring_read (uring_t *ring, int fd, void *buf, size_t n, uint64_t data)
+{
+  return false;
+}
+
+bool
+uring_write (uring_t *ring, int fd, const void *buf, size_t n, uint64_t data)
+{
+  return false;
+}
+
+int
+uring_submit (uring_t *ring)
+{
+  return 0;
+}
+
+bool
+uring_reap (uring_t *ring, uint64_t *data, int32_t *res)
+{
+  return false;
+}
+
+#endif
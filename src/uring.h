@@ -0,0 +1,44 @@
+#ifndef URING_H
+#define URING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define URING_ENTRIES 256
+
+typedef struct Uring uring_t;
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+/* An io_uring driven through the raw system calls.  Submissions are
+   queued in the shared ring as they come and handed to the kernel
+   together by uring_submit; PENDING counts those not yet handed over.
+   Completions carry back the DATA they were queued with.  */
+struct Uring
+{
+  int fd;
+  unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+  unsigned *cq_head, *cq_tail, *cq_mask;
+  struct io_uring_sqe *sqes;
+  struct io_uring_cqe *cqes;
+  unsigned sq_entries;
+  unsigned pending;
+  void *sq_ring;
+  size_t sq_ring_size;
+  void *cq_ring;
+  size_t cq_ring_size;
+  size_t sqes_size;
+};
+
+uring_t *uring_new (unsigned entries);
+void uring_delete (uring_t *ring);
+
+bool uring_read (uring_t *ring, int fd, void *buf, size_t n, uint64_t data);
+bool uring_write (uring_t *ring, int fd, const void *buf, size_t n,
+                  uint64_t data);
+int uring_submit (uring_t *ring);
+bool uring_reap (uring_t *ring, uint64_t *data, int32_t *res);
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <uchar.h>
+
+/* Length of the well-formed sequence starting with LEAD.  */
+static inline size_t
+utf8_sequence_length (uint8_t lead)
+{
+  return lead < 0x80 ? 1 : lead < 0xe0 ? 2 : lead < 0xf0 ? 3 : 4;
+}
+
+/* Decode one UTF-8 sequence from S, storing the code point in *CH and
+   returning its length.  Malformed input decodes to U+FFFD, one byte at a
+   time.  */
+static inline size_t
+utf8_decode (const uint8_t *s, size_t n, char32_t *ch)
+{
+  uint8_t c = s[0];
+  size_t len = c < 0x80 ? 1 : c >> 5 == 0x6 ? 2 : c >> 4 == 0xe ? 3
+               : c >> 3 == 0x1e                          ? 4
+                                                         : 0;
+  if (!len || len > n)
+    {
+      *ch = 0xfffd;
+      return 1;
+    }
+  if (len == 1)
+    {
+      *ch = c;
+      return 1;
+    }
+
+  char32_t cp = c & (0x7f >> len);
+  for (size_t i = 1; i < len; i++)
+    {
+      if ((s[i] & 0xc0) != 0x80)
+        {
+          *ch = 0xfffd;
+          return 1;
+        }
+      cp = (cp << 6) | (s[i] & 0x3f);
+    }
+  *ch = cp;
+  return len;
+}
+
+/* Encode CH into S, which must have room for four bytes.  Returns the
+   number of bytes written.  */
+static inline size_t
+utf8_encode (char32_t ch, uint8_t *s)
+{
+  if (ch < 0x80)
+    {
+      s[0] = (uint8_t)ch;
+      return 1;
+    }
+  if (ch < 0x800)
+    {
+      s[0] = 0xc0 | (ch >> 6);
+      s[1] = 0x80 | (ch & 0x3f);
+      return 2;
+    }
+  if (ch < 0x10000)
+    {
+      s[0] = 0xe0 | (ch >> 12);
+      s[1] = 0x80 | ((ch >> 6) & 0x3f);
+      s[2] = 0x80 | (ch & 0x3f);
+      return 3;
+    }
+  s[0] = 0xf0 | (ch >> 18);
+  s[1] = 0x80 | ((ch >> 12) & 0x3f);
+  s[2] = 0x80 | ((ch >> 6) & 0x3f);
+  s[3] = 0x80 | (ch & 0x3f);
+  return 4;
+}
+
+#endif
@@ -0,0 +1,98 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+
+static _Thread_local error_handler_t *error_handlers;
+
+void
+error_push (error_handler_t *h)
+{
+  h->prev = error_handlers;
+  h->message[0] = '\0';
+  error_handlers = h;
+}
+
+/* Uninstall H, which must be the innermost handler, on the path that did
+   not raise.  */
+void
+error_pop (error_handler_t *h)
+{
+  error_handlers = h->prev;
+}
+
+void
+raise_runtime_error (const char *fmt, ...)
+{
+  char message[ERROR_MESSAGE_SIZE];
+  va_list ap;
+  va_start (ap, fmt);
+  vsnprintf (message, sizeof (message), fmt, ap);
+  va_end (ap);
+
+  error_handler_t *h = error_handlers;
+  if (!h)
+    {
+      fprintf (stderr, "Error: %s\n", message);
+      exit (EXIT_FAILURE);
+    }
+  error_handlers = h->prev;
+  memcpy (h->message, message, sizeof (message));
+  longjmp (h->env, 1);
+}
+
+size_t
+u32strlen (const char32_t *s)
+{
+  size_t n = 0;
+  while (s[n])
+    n++;
+  return n;
+}
+
+/* A NUL-terminated copy of the first N characters of S.  */
+char32_t *
+u32strndup (const char32_t *s, size_t n)
+{
+  char32_t *dup = malloc ((n + 1) * sizeof (char32_t));
+  memcpy (dup, s, n * sizeof (char32_t));
+  dup[n] = U'\0';
+  return dup;
+}
+
+uint32_t
+fnv1a_hash32 (const char32_t *s)
+{
+  uint32_t hash = 2166136261u;
+  for (; *s; s++)
+    for (int i = 0; i < 4; i++)
+      {
+        hash ^= (*s >> (8 * i)) & 0xff;
+        hash *= 16777619u;
+      }
+  return hash;
+}
+
+/* The SplitMix64 finaliser, folded to 32 bits.  */
+uint32_t
+splitmix_hash32 (uint64_t x)
+{
+  x += 0x9e3779b97f4a7c15u;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9u;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebu;
+  x ^= x >> 31;
+  return (uint32_t)(x ^ (x >> 32));
+}
+
+/* The bit pattern of D, with both zeroes made equal.  */
+uint64_t
+double_bits (double d)
+{
+  uint64_t bits;
+  if (d == 0.0)
+    d = 0.0;
+  memcpy (&bits, &d, sizeof bits);
+  return bits;
+}
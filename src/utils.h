@@ -0,0 +1,40 @@
+#ifndef UTILS_H
+#define UTILS_H
+
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <uchar.h>
+
+#define ERROR_MESSAGE_SIZE 256
+
+typedef struct ErrorHandler error_handler_t;
+
+/* Runtime errors unwind with longjmp to the innermost handler installed on
+   the raising thread, which finds the formatted message in MESSAGE.  With
+   no handler installed the error is reported and the process exits.  */
+struct ErrorHandler
+{
+  jmp_buf env;
+  error_handler_t *prev;
+  char message[ERROR_MESSAGE_SIZE];
+};
+
+/* Install H and evaluate to false; evaluates to true a second time when an
+   error unwinds to H, which is then already uninstalled.  */
+#define ERROR_CATCH(h) (error_push (h), setjmp ((h)->env) != 0)
+
+void error_push (error_handler_t *h);
+void error_pop (error_handler_t *h);
+
+_Noreturn void raise_runtime_error (const char *fmt, ...)
+    __attribute__ ((format (printf, 1, 2)));
+
+size_t u32strlen (const char32_t *s);
+char32_t *u32strndup (const char32_t *s, size_t n);
+uint32_t fnv1a_hash32 (const char32_t *s);
+uint32_t splitmix_hash32 (uint64_t x);
+uint64_t double_bits (double d);
+
+#endif
@@ -0,0 +1,3 @@
+;; The same sum as named-let-sum written as a do loop.
+
+(do ((i 0 (+ i 1)) (s 0 (+ s i))) ((= i 100000000) s))
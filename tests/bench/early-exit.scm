@@ -0,0 +1,25 @@
+;; Early exit from a search a million times, once through call/cc and once
+;; through the one-shot call/1cc.
+
+(define lst '(1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16))
+
+(define (search target)
+  (call/cc
+   (lambda (return)
+     (let loop ((l lst))
+       (if (eq? l '())
+           #f
+           (begin (if (= (car l) target) (return (car l))) (loop (cdr l))))))))
+
+(define (search/1cc target)
+  (call/1cc
+   (lambda (return)
+     (let loop ((l lst))
+       (if (eq? l '())
+           #f
+           (begin (if (= (car l) target) (return (car l))) (loop (cdr l))))))))
+
+(let loop ((i 0) (s 0))
+  (if (< i 1000000)
+      (loop (+ i 1) (+ s (search 8) (search/1cc 8)))
+      s))
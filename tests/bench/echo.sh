@@ -0,0 +1,43 @@
+#!/bin/sh
+# Echo 64 MB in 64-byte messages through cat(1) over a pair of FIFOs, one
+# fiber writing the messages and another reading the echoes back, so both
+# keep parking in the reactor as the pipes fill and drain.  The reactor
+# only sees descriptors, so FIFOs stand in for the socketpair that Scheme
+# code has no way to make.
+
+scheme=${1:?usage: tests/bench/echo.sh INTERPRETER}
+case $scheme in
+  /*) ;;
+  *) scheme=$(pwd)/$scheme ;;
+esac
+scratch=$(mktemp -d)
+trap 'rm -rf "$scratch"' EXIT
+cd "$scratch" || exit 1
+
+mkfifo up down
+cat >echo.scm <<'EOS'
+(define messages 1000000)
+(define msg (make-u8vector 64 120))
+
+;; Opening a FIFO waits for its other end, which cat opens in this order.
+(define up (open-binary-output-file "up"))
+(define down (open-binary-input-file "down"))
+
+(spawn (lambda ()
+         (let loop ((i 0))
+           (when (< i messages)
+             (write-bytevector msg up)
+             (loop (+ i 1))))
+         (flush-output-port up)))
+
+(let loop ((got 0))
+  (if (< got (* 64 messages))
+      (loop (+ got (u8vector-length (read-bytevector 4096 down))))
+      got))
+EOS
+
+cat <up >down &
+start=$(date +%s.%N)
+"$scheme" echo.scm >/dev/null 2>&1 || { echo FAIL; kill $! 2>/dev/null; exit 1; }
+printf '%.3f\n' "$(echo "$(date +%s.%N) - $start" | bc)"
+wait
@@ -0,0 +1,7 @@
+;; factorial(10000) and its decimal digits.
+
+(define (fact n)
+  (let loop ((i 1) (acc 1))
+    (if (> i n) acc (loop (+ i 1) (* acc i)))))
+
+(string-length (number->string (fact 10000)))
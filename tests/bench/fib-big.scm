@@ -0,0 +1,7 @@
+;; fib(100000) by iteration and its decimal digits.
+
+(define (fib n)
+  (let loop ((i 0) (a 0) (b 1))
+    (if (= i n) a (loop (+ i 1) b (+ a b)))))
+
+(string-length (number->string (fib 100000)))
@@ -0,0 +1,7 @@
+;; Non-tail calls and returns, the other places the VM checks for fuel and
+;; safepoints.
+
+(define (fib n)
+  (if (< n 2) n (+ (fib (- n 1)) (fib (- n 2)))))
+
+(fib 32)
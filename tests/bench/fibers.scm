@@ -0,0 +1,11 @@
+;; Ten thousand fibers each yielding a hundred times: a million context
+;; switches through the run queue.
+
+(let loop ((i 0))
+  (when (< i 10000)
+    (spawn (lambda ()
+             (let spin ((n 0))
+               (when (< n 100)
+                 (yield)
+                 (spin (+ n 1))))))
+    (loop (+ i 1))))
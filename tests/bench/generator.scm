@@ -0,0 +1,21 @@
+;; A generator built on call/cc: every element handed out captures the
+;; walker's stack and every resumption reinstates it.
+
+(define (make-generator n)
+  (define return #f)
+  (define (resume)
+    (let walk ((i 0))
+      (if (< i n)
+          (begin
+            (call/cc
+             (lambda (next)
+               (set! resume (lambda () (next #f)))
+               (return i)))
+            (walk (+ i 1)))))
+    (return #f))
+  (lambda () (call/cc (lambda (r) (set! return r) (resume)))))
+
+(define gen (make-generator 1000000))
+(let loop ((s 0))
+  (let ((x (gen)))
+    (if x (loop (+ s x)) s)))
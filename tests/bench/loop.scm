@@ -0,0 +1,8 @@
+;; A tight loop of backward jumps and nothing else, where a check at each
+;; jump costs the most relative to the work done.
+
+(define (count n)
+  (let loop ((i 0))
+    (if (< i n) (loop (+ i 1)) i)))
+
+(count 100000000)
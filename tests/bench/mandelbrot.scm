@@ -0,0 +1,24 @@
+;; Escape counts over a 400x400 grid of the Mandelbrot set, all flonum
+;; arithmetic through the fl operations.
+
+(define (escape cr ci)
+  (let loop ((zr 0.0) (zi 0.0) (i 0))
+    (if (or (= i 50) (fl> (fl+ (fl* zr zr) (fl* zi zi)) 4.0))
+        i
+        (loop (fl+ (fl- (fl* zr zr) (fl* zi zi)) cr)
+              (fl+ (fl* 2.0 (fl* zr zi)) ci)
+              (+ i 1)))))
+
+(define (coordinate k offset)
+  (fl- (fl/ (exact->inexact k) 200.0) offset))
+
+(let rows ((y 0) (total 0))
+  (if (= y 400)
+      total
+      (rows (+ y 1)
+            (let cols ((x 0) (t total))
+              (if (= x 400)
+                  t
+                  (cols (+ x 1)
+                        (+ t (escape (coordinate x 1.5)
+                                     (coordinate y 1.0)))))))))
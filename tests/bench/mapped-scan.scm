@@ -0,0 +1,10 @@
+;; Count the nonzero bytes of the 4 GB file mapped-scan.sh makes, reading
+;; it through a mapped bytevector one bytevector-u8-ref at a time.
+
+(define bv (file->bytevector/mapped "big.dat"))
+(define n (u8vector-length bv))
+
+(let loop ((i 0) (count 0))
+  (if (< i n)
+      (loop (+ i 1) (if (= (bytevector-u8-ref bv i) 0) count (+ count 1)))
+      count))
@@ -0,0 +1,6 @@
+#!/bin/sh
+# A 4 GB file, sparse so that making it costs nothing; its pages still
+# come through the page cache when mapped-scan.scm reads them.
+
+truncate -s 4G big.dat
+printf 'x' | dd of=big.dat bs=1 seek=4294967295 conv=notrunc 2>/dev/null
@@ -0,0 +1,5 @@
+;; Sum 10^8 integers in a named let, which compiles to a backward jump
+;; with no closure, frame or environment allocated per iteration.
+
+(let loop ((i 0) (s 0))
+  (if (< i 100000000) (loop (+ i 1) (+ s i)) s))
@@ -0,0 +1,14 @@
+;; Read the 100 MB port-read.sh writes three ways: line by line, in 64 KB
+;; bulk reads into one reused bytevector, and copied whole to another file.
+
+(let loop ((in (open-input-file "in.txt")) (n 0))
+  (if (read-line in) (loop in (+ n 1)) n))
+
+(define in (open-binary-input-file "in.txt"))
+(define buf (read-bytevector 65536 in))
+(let loop ((total 65536))
+  (let ((n (read-bytevector! buf in)))
+    (if (eq? n #f) total (loop (+ total n)))))
+
+(copy-port (open-binary-input-file "in.txt")
+           (open-binary-output-file "copy.txt"))
@@ -0,0 +1,4 @@
+#!/bin/sh
+# 100 MB of 100-byte lines.
+
+awk 'BEGIN { for (i = 0; i < 1000000; i++) printf "%099d\n", i }' >in.txt
@@ -0,0 +1,12 @@
+;; Write 100 MB to a file in short lines through write-string.
+
+(define out (open-output-file "out.txt"))
+(define line
+  (string-append "0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdef"
+                 "ghijklmnopqrstuvwxyz0123456789012345678abcdefgh\n"))
+
+(let loop ((i 0))
+  (when (< i 1000000)
+    (write-string line out)
+    (loop (+ i 1))))
+(flush-output-port out)
@@ -0,0 +1,7 @@
+;; Read the data reader.sh generates one datum at a time through a mapped
+;; port.  Its size over the time taken is the reader's throughput.
+
+(define p (open-mapped-input-port "data.scm"))
+
+(let loop ((x (read p)) (n 0))
+  (if (eq? x #f) n (loop (read p) (+ n 1))))
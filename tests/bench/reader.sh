@@ -0,0 +1,10 @@
+#!/bin/sh
+# About 200 MB of mixed data: integers, decimals, strings with escapes,
+# symbols, comments and nested lists.
+
+awk 'BEGIN {
+  for (i = 0; i < 2000000; i++)
+    printf "(record %d %d.%03de%d \"name \\\"%d\\\"\" sym-%d ; note\n" \
+           "  (tags alpha beta gamma) #(%d %d))\n",
+           i, i % 1000, i % 997, i % 20, i, i % 5000, i, -i
+}' >data.scm
@@ -0,0 +1,21 @@
+;; Two hundred fibers each reading a 1 MB file of its own in 16 KB chunks.
+;; Compare a default build with one made with -DNO_URING to weigh the
+;; io_uring backend against the synchronous path.
+
+(define done (make-channel))
+
+(let loop ((i 0))
+  (when (< i 200)
+    (spawn
+     (lambda ()
+       (let ((p (open-binary-input-file
+                 (string-append "f" (number->string i)))))
+         (let chunk ((n 0))
+           (let ((bv (read-bytevector 16384 p)))
+             (if (eq? bv #f)
+                 (channel-send done n)
+                 (chunk (+ n (u8vector-length bv)))))))))
+    (loop (+ i 1))))
+
+(let loop ((k 0) (total 0))
+  (if (= k 200) total (loop (+ k 1) (+ total (channel-recv done)))))
@@ -0,0 +1,9 @@
+#!/bin/sh
+# Two hundred files of 1 MB for readers.scm.
+
+head -c 1048576 /dev/urandom >f0
+i=1
+while [ $i -lt 200 ]; do
+  cp f0 f$i
+  i=$((i + 1))
+done
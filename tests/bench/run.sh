@@ -0,0 +1,52 @@
+#!/bin/sh
+# Time every benchmark under tests/bench with each interpreter given, best
+# of three runs, to compare builds: for example the tree before and after
+# a change to the VM loop.  A program NAME.scm with a NAME.sh beside it
+# has its input prepared by that script first, in the scratch directory
+# the program then runs in, and the preparation is not timed.  Times are
+# in seconds; a run that fails prints FAIL instead.  Scripts with no
+# program beside them, such as scaling.sh and echo.sh, drive processes of
+# their own and are run by hand with a single interpreter.
+
+if [ $# -eq 0 ]; then
+  echo "usage: tests/bench/run.sh INTERPRETER..." >&2
+  exit 2
+fi
+dir=$(cd "$(dirname "$0")" && pwd)
+
+now () { date +%s.%N; }
+
+best () {
+  scheme=$1 t=$2 best=
+  for i in 1 2 3; do
+    start=$(now)
+    if ! (cd "$scratch" && "$scheme" "$t") >/dev/null 2>&1; then
+      echo FAIL
+      return
+    fi
+    best=$(awk -v s="$start" -v e="$(now)" -v b="$best" \
+             'BEGIN { t = e - s; print (b == "" || t < b) ? t : b }')
+  done
+  printf '%.3f\n' "$best"
+}
+
+for t in "$dir"/*.scm; do
+  name=$(basename "$t" .scm)
+  printf '%-24s' "$name"
+  scratch=$(mktemp -d)
+  if [ -e "$dir/$name.sh" ] \
+     && ! (cd "$scratch" && sh "$dir/$name.sh") >/dev/null 2>&1; then
+    echo " setup failed"
+    rm -rf "$scratch"
+    continue
+  fi
+  for scheme in "$@"; do
+    case $scheme in
+      /*) ;;
+      *) scheme=$(pwd)/$scheme ;;
+    esac
+    printf ' %10s' "$(best "$scheme" "$t")"
+  done
+  echo
+  rm -rf "$scratch"
+done
@@ -0,0 +1,53 @@
+#!/bin/sh
+# Time a fixed amount of embarrassingly parallel work spread over 1 to 16
+# threads.  Scaling is linear when each doubling of the thread count
+# halves the time, up to the number of cores.  The pool for the parallel
+# operations sizes itself to the CPUs it may use, so taskset(1) picks its
+# thread count; that needs as many CPUs as the largest count.
+
+scheme=${1:?usage: tests/bench/scaling.sh INTERPRETER}
+scratch=$(mktemp -d)
+trap 'rm -rf "$scratch"' EXIT
+
+now () { date +%s.%N; }
+
+run () {
+  start=$(now)
+  if "$@" >/dev/null 2>&1; then
+    printf '%.3f\n' "$(echo "$(now) - $start" | bc)"
+  else
+    echo FAIL
+  fi
+}
+
+echo "isolates: 16 runs of fib(25) split across N isolates"
+for n in 1 2 4 8 16; do
+  cat >"$scratch/isolates.scm" <<EOS
+(define (worker)
+  (isolate-spawn
+   '(letrec ((fib (lambda (n)
+                    (if (< n 2) n (+ (fib (- n 1)) (fib (- n 2)))))))
+      (let loop ((i 0) (s 0))
+        (if (= i $((16 / n))) s (loop (+ i 1) (+ s (fib 25))))))))
+
+(let loop ((i 0) (acc '()))
+  (if (< i $n)
+      (loop (+ i 1) (cons (worker) acc))
+      (let join ((w acc) (s 0))
+        (if (eq? w '()) s (join (cdr w) (+ s (isolate-join (car w))))))))
+EOS
+  printf '%4d %10s\n' "$n" "$(run "$scheme" "$scratch/isolates.scm")"
+done
+
+echo "parallel-map: squares of a 10M-element list on N threads"
+cat >"$scratch/parallel-map.scm" <<'EOS'
+(define nums
+  (let loop ((i 10000000) (acc '()))
+    (if (= i 0) acc (loop (- i 1) (cons i acc)))))
+
+(parallel-map (lambda (x) (* x x)) nums)
+EOS
+for n in 1 2 4 8 16; do
+  printf '%4d %10s\n' "$n" \
+    "$(run taskset -c 0-$((n - 1)) "$scheme" "$scratch/parallel-map.scm")"
+done
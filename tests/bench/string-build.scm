@@ -0,0 +1,13 @@
+;; Build a 100 MB string from a million 100-byte pieces through a string
+;; port, where repeated string-append would copy quadratically.
+
+(define piece
+  (string-append "0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdef"
+                 "ghijklmnopqrstuvwxyz0123456789012345678abcdefgh\n"))
+
+(define out (open-output-string))
+(let loop ((i 0))
+  (when (< i 1000000)
+    (write-string piece out)
+    (loop (+ i 1))))
+(string-length (get-output-string out))
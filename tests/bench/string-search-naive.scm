@@ -0,0 +1,25 @@
+;; string-search.scm's search written in Scheme over string-ref, run once
+;; rather than a hundred times.
+
+(define hay
+  (let ((out (open-output-string)))
+    (let loop ((i 0))
+      (when (< i 1250000)
+        (write-string "abcdefgh" out)
+        (loop (+ i 1))))
+    (write-string "needle" out)
+    (get-output-string out)))
+
+(define (search hay pat)
+  (let ((n (string-length hay)) (m (string-length pat)))
+    (let outer ((i 0))
+      (cond ((> (+ i m) n) #f)
+            ((let inner ((j 0))
+               (cond ((= j m) #t)
+                     ((char=? (string-ref hay (+ i j)) (string-ref pat j))
+                      (inner (+ j 1)))
+                     (else #f)))
+             i)
+            (else (outer (+ i 1)))))))
+
+(search hay "needle")
@@ -0,0 +1,15 @@
+;; Find a pattern at the end of a 10 MB string a hundred times with
+;; string-contains.  string-search-naive.scm does the same with a loop
+;; over string-ref.
+
+(define hay
+  (let ((out (open-output-string)))
+    (let loop ((i 0))
+      (when (< i 1250000)
+        (write-string "abcdefgh" out)
+        (loop (+ i 1))))
+    (write-string "needle" out)
+    (get-output-string out)))
+
+(let loop ((i 0) (pos #f))
+  (if (< i 100) (loop (+ i 1) (string-contains hay "needle")) pos))
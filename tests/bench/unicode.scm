@@ -0,0 +1,25 @@
+;; Convert every line of the corpus unicode.sh writes to upper, lower and
+;; folded case, and classify each character of every tenth line.
+
+(define in (open-input-file "corpus.txt"))
+
+(define (classify s)
+  (let loop ((i 0) (n 0))
+    (if (= i (string-length s))
+        n
+        (let ((c (string-ref s i)))
+          (loop (+ i 1)
+                (if (or (char-alphabetic? c) (char-numeric? c)
+                        (char-upper-case? c))
+                    (+ n 1)
+                    n))))))
+
+(let loop ((line (read-line in)) (k 0) (n 0))
+  (if line
+      (begin
+        (string-upcase line)
+        (string-downcase line)
+        (string-foldcase line)
+        (loop (read-line in) (+ k 1)
+              (if (= (remainder k 10) 0) (+ n (classify line)) n)))
+      n))
@@ -0,0 +1,8 @@
+#!/bin/sh
+# About 20 MB of text mixing Latin, Greek, Cyrillic, CJK and plain ASCII.
+
+awk 'BEGIN {
+  for (i = 0; i < 235000; i++)
+    printf "The quick brown fox %d Ἀθῆναι Москва %s\n", i,
+           "straße 東京都 ÉCOLE café"
+}' >corpus.txt
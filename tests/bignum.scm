@@ -0,0 +1,50 @@
+;; Exact integers past the fixnum range: promotion on overflow, demotion
+;; when results fit again, and operands and digit strings long enough to
+;; take the Karatsuba and divide-and-conquer conversion paths.
+
+(define (fact n)
+  (let loop ((i 1) (acc 1))
+    (if (> i n) acc (loop (+ i 1) (* acc i)))))
+
+(define max-fixnum 9223372036854775807)
+
+(check 'add-overflow
+       (string=? (number->string (+ max-fixnum 1)) "9223372036854775808"))
+(check 'sub-overflow
+       (string=? (number->string (- (- max-fixnum) 2))
+                 "-9223372036854775809"))
+(check 'mul-overflow
+       (string=? (number->string (fact 25)) "15511210043330985984000000"))
+(check 'negate (= (- 5) -5))
+(check 'negate-min-fixnum
+       (string=? (number->string (- (- (- max-fixnum) 1)))
+                 "9223372036854775808"))
+(check 'negate-bignum (= (- (- (fact 25))) (fact 25)))
+(check 'demote (= (- (+ max-fixnum 10) 10) max-fixnum))
+(check 'demoted-arithmetic (= (+ (- (+ max-fixnum 1) max-fixnum) 1) 2))
+(check 'compare (and (> (fact 30) (fact 29)) (< (- (fact 30)) 0)))
+(check 'subtract
+       (= (- (fact 30) (fact 29)) 256411097818451356681764864000000))
+(check 'quotient (= (quotient (fact 25) (fact 24)) 25))
+(check 'remainder (= (remainder (+ (fact 25) 7) (fact 24)) 7))
+(check 'modulo-negative (= (modulo (- 7 (fact 25)) (fact 24)) 7))
+(check 'modulo-signs (and (= (modulo -7 2) 1) (= (modulo 7 -2) -1)
+                          (= (remainder -7 2) -1) (= (remainder 0 5) 0)))
+(check 'chained-equal (and (= 1 1 1) (eq? (= 1 2 1) #f) (eq? (= 2 1 1) #f)))
+(check 'chained-order (and (< 1 2 (fact 25)) (eq? (< 1 3 2) #f)
+                           (>= (fact 25) (fact 25) 1)))
+(check 'literal (= (* 4294967296 4294967296) 18446744073709551616))
+(check 'parse (= (string->number "1267650600228229401496703205376")
+                 (* 1125899906842624 1125899906842624)))
+
+(define big (fact 1000))
+(define square (* big big))
+(check 'digits (= (string-length (number->string big)) 2568))
+(check 'karatsuba-digits (= (string-length (number->string square)) 5136))
+(check 'karatsuba-leading
+       (string=? (substring (number->string square) 0 20)
+                 "16191550707235070460"))
+(check 'karatsuba-mod (= (remainder square 1000000007) 930870598))
+(check 'divide-back (= (quotient square big) big))
+(check 'hex (string=? (number->string (* 65536 65536 65536 65536) 16)
+                      "10000000000000000"))
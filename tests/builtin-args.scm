@@ -0,0 +1,9 @@
+;; The same object may be passed to a builtin more than once.
+
+(define x 21)
+(check 'repeated-fixnum (= (+ x x) 42))
+(check 'repeated-nil (eq? '() '()))
+(check 'repeated-false (= (length (list #f #f #f)) 3))
+(define s "ab")
+(check 'repeated-string (string=? (string-append s s s) "ababab"))
+(check 'list-after-repeat (equal? (list x x) '(21 21)))
@@ -0,0 +1,33 @@
+;; Builtins are bound at startup under their Scheme names, and can be
+;; passed around as values as well as called.
+
+(check 'arithmetic (= (+ 1 (* 2 3) (- 10 4) (quotient 9 2)) 17))
+(check 'number->string (string=? (number->string 255 16) "ff"))
+(check 'string->number (= (string->number "101" 2) 5))
+(check 'char-upcase (char=? (char-upcase #\a) #\A))
+(check 'string-index (= (string-index "hello" #\l) 2))
+(check 'string-contains (= (string-contains "haystack" "st") 3))
+(check 'regexp-match (regexp-match (regexp-compile "a+b") "aaab"))
+(check 'regexp-search (equal? (regexp-search "b+" "aabbbc") '(2 . 5)))
+(check 'regexp-replace
+       (string=? (regexp-replace "o" "foo boo" "0") "f00 b00"))
+(check 'length (and (= (length '()) 0) (= (length '(a)) 1)
+                    (= (length (iota 100)) 100)))
+(check 'list-ref (eq? (list-ref '(a b c) 2) 'c))
+(check 'fl+-as-value (fl= ((car (list fl+)) 1.0 2.0) 3.0))
+(check 'read (equal? (read (open-input-string "(a b)")) '(a b)))
+
+(define out (open-output-string))
+(write-string "copied" out)
+(define copy (open-output-string))
+(check 'copy-port (= (copy-port (open-input-string "abc") copy) 3))
+(check 'get-output-string (string=? (get-output-string out) "copied"))
+
+(define v (f64vector 1.0 2.0 3.0))
+(f64vector-add! v (f64vector 1.0 1.0 1.0))
+(f64vector-scale! v 2.0)
+(check 'f64vector-sum (fl= (f64vector-sum v) 18.0))
+(check 'f64vector-dot (fl= (f64vector-dot v v) 116.0))
+(check 'f64vector-ref (fl= (f64vector-ref v 2) 8.0))
+(check 's16vector (= (s16vector-ref (list->s16vector '(-1 2)) 0) -1))
+(check 'u8vector (= (bytevector-u8-ref (make-u8vector 2 7) 1) 7))
@@ -0,0 +1,25 @@
+;; Closures, procedures and syntax objects keep everything they refer to
+;; alive across collections.
+
+(define (make-adder n)
+  (let ((offset (list n)))
+    (lambda (x) (+ x (car offset)))))
+
+(define adders
+  (let loop ((i 0) (acc '()))
+    (if (= i 100) acc (loop (+ i 1) (cons (make-adder i) acc)))))
+
+(define (churn n)
+  (let loop ((i 0))
+    (when (< i n)
+      (list i i i i)
+      (loop (+ i 1)))))
+
+(churn 500000)
+
+(define (apply-all fs x)
+  (let loop ((fs fs) (s 0))
+    (if (eq? fs '()) s (loop (cdr fs) (+ s ((car fs) x))))))
+
+(check 'closures-survive (= (apply-all adders 1) (+ 100 4950)))
+(check 'toplevel-procedure-survives (= ((make-adder 2) 40) 42))
@@ -0,0 +1,57 @@
+;; call/cc for early exit and re-entry, and call/1cc, which may only be
+;; resumed once but never copies the stack.
+
+(define (find-first pred lst)
+  (call/cc
+   (lambda (return)
+     (let loop ((l lst))
+       (if (eq? l '())
+           #f
+           (begin (if (pred (car l)) (return (car l))) (loop (cdr l))))))))
+(check 'early-exit (= (find-first (lambda (x) (> x 2)) '(1 2 3 4)) 3))
+(check 'no-exit (eq? (find-first (lambda (x) (> x 9)) '(1 2 3)) #f))
+
+(define (find-first/1cc pred lst)
+  (call/1cc
+   (lambda (return)
+     (let loop ((l lst))
+       (if (eq? l '())
+           #f
+           (begin (if (pred (car l)) (return (car l))) (loop (cdr l))))))))
+(check 'one-shot-exit (= (find-first/1cc (lambda (x) (> x 2)) '(1 2 3 4)) 3))
+
+(check 'call/cc-value (= (+ 1 (call/cc (lambda (k) 41))) 42))
+(check 'call/cc-escape (= (+ 1 (call/cc (lambda (k) (+ 100 (k 41))))) 42))
+
+;; Re-entering a continuation after the call/cc has returned restores the
+;; stack it captured, so the same frames run again.
+(define (re-enter)
+  (let ((k #f) (n 0))
+    (let ((r (+ 100 (call/cc (lambda (c) (set! k c) 0)))))
+      (set! n (+ n 1))
+      (if (< n 3) (k n) (list n r)))))
+(check 're-entry (equal? (re-enter) '(3 102)))
+
+;; A generator that hands out the elements of a list one at a time,
+;; resuming its walk where it left off.
+(define (make-generator lst)
+  (define return #f)
+  (define (resume)
+    (for-each-element lst)
+    (return 'done))
+  (define (for-each-element l)
+    (if (eq? l '())
+        #t
+        (begin
+          (call/cc
+           (lambda (next)
+             (set! resume (lambda () (next #f)))
+             (return (car l))))
+          (for-each-element (cdr l)))))
+  (lambda () (call/cc (lambda (r) (set! return r) (resume)))))
+
+(define gen (make-generator '(a b c)))
+(define got
+  (let* ((a (gen)) (b (gen)) (c (gen)) (d (gen)))
+    (list a b c d)))
+(check 'generator (equal? got '(a b c done)))
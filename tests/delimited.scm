@@ -0,0 +1,50 @@
+;; reset and shift: a captured delimited continuation may be dropped,
+;; resumed once or many times, outlive its reset, and span stack segments
+;; sealed by deep recursion or by call/cc.
+
+(check 'no-shift (= (reset (+ 1 2)) 3))
+
+;; Returning from shift without calling k escapes to the reset.
+(check 'k-unused (= (+ 1 (reset (+ 10 (shift k 5)))) 6))
+
+(check 'k-once (= (reset (+ 10 (shift k (k 1)))) 11))
+(check 'k-twice (= (reset (+ 10 (shift k (+ (k 1) (k 2))))) 23))
+
+(define (k-many n)
+  (reset (* 2 (shift k (let loop ((i 0) (acc '()))
+                         (if (= i n)
+                             acc
+                             (loop (+ i 1) (cons (k i) acc))))))))
+(check 'k-many (equal? (k-many 5) '(8 6 4 2 0)))
+
+;; A continuation kept past its reset can still be resumed, repeatedly.
+(define saved #f)
+(check 'k-saved (= (reset (+ 1 (shift k (begin (set! saved k) 0)))) 0))
+(check 'k-after-reset (= (saved 41) 42))
+(check 'k-after-reset-again (= (+ (saved 1) (saved 2)) 5))
+
+;; shift captures up to the innermost reset only.
+(check 'nested-inner
+       (= (reset (+ 1 (reset (+ 10 (shift k (k (k 100))))))) 121))
+(check 'nested-outer
+       (= (reset (+ 1 (shift k2 (k2 (reset (+ 10 (shift k (k 5))))))))
+          16))
+
+;; Enough frames between reset and shift to fill several segments.
+(define (deep n)
+  (if (= n 0)
+      (shift k (k (k 0)))
+      (+ 1 (deep (- n 1)))))
+(check 'deep (= (reset (deep 1000)) 2000))
+
+;; call/cc seals the segment it runs on, so the slots between the prompt
+;; and shift are split across a sealed segment and the current one.
+(define (via-call/cc)
+  (reset (+ 1 (call/cc (lambda (c) (+ 10 (shift k (k (k 100)))))))))
+(check 'across-sealed (= (via-call/cc) 122))
+
+(define (deep-call/cc n)
+  (if (= n 0)
+      (call/cc (lambda (c) (shift k (k (k 0)))))
+      (+ 1 (deep-call/cc (- n 1)))))
+(check 'deep-across-sealed (= (reset (deep-call/cc 500)) 1000))
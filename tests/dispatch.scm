@@ -0,0 +1,107 @@
+;; `case', and `cond' on one variable, compiled to a dispatch table: dense
+;; over a small span of fixnums or characters, hashed otherwise, and a
+;; chain of eqv? tests below four keys.
+
+(check 'eqv-symbols (eqv? 'a 'a))
+(check 'eqv-distinct-symbols (eq? (eqv? 'a 'b) #f))
+(check 'eqv-fixnums (eqv? 100000 100000))
+(check 'eqv-exactness (eq? (eqv? 2 2.0) #f))
+(check 'eqv-characters (eqv? #\x #\x))
+(check 'eqv-empty-lists (eqv? '() '()))
+(check 'eqv-strings-are-not-shared (eq? (eqv? (string-append "a" "b") "ab") #f))
+
+(define (dense n)
+  (case n
+    ((0) 'zero)
+    ((1 2) 'small)
+    ((3) 'three)
+    ((4 5 6) 'some)
+    (else 'many)))
+
+(check 'dense-first (eq? (dense 0) 'zero))
+(check 'dense-shared-clause (eq? (dense 2) 'small))
+(check 'dense-last (eq? (dense 6) 'some))
+(check 'dense-above-span (eq? (dense 7) 'many))
+(check 'dense-below-span (eq? (dense -1) 'many))
+(check 'dense-other-type (eq? (dense 'zero) 'many))
+
+(define (vowel c)
+  (case c
+    ((#\a #\e #\i #\o #\u) #t)
+    ((#\y) 'sometimes)
+    (else #f)))
+
+(check 'dense-characters (eq? (vowel #\o) #t))
+(check 'dense-characters-else (eq? (vowel #\b) #f))
+(check 'dense-characters-clause (eq? (vowel #\y) 'sometimes))
+
+(define (hashed x)
+  (case x
+    ((red) 1)
+    ((green) 2)
+    ((blue) 3)
+    ((1000 -1000) 4)
+    ((#t) 5)
+    ((()) 6)
+    (else 0)))
+
+(check 'hashed-symbol (= (hashed 'green) 2))
+(check 'hashed-fixnum (= (hashed -1000) 4))
+(check 'hashed-boolean (= (hashed #t) 5))
+(check 'hashed-empty-list (= (hashed '()) 6))
+(check 'hashed-else (= (hashed 'purple) 0))
+(check 'hashed-unkeyable (= (hashed "red") 0))
+
+(define (no-else x)
+  (case x
+    ((a) 1)
+    ((b) 2)
+    ((c) 3)
+    ((d) 4)))
+
+(check 'fallthrough-without-else (eq? (no-else 'e) '()))
+
+(define (small x)
+  (case x
+    ((a) 'first)
+    ((b c) 'second)
+    (else 'other)))
+
+(check 'small-case-first (eq? (small 'a) 'first))
+(check 'small-case-second (eq? (small 'c) 'second))
+(check 'small-case-else (eq? (small 'z) 'other))
+(check 'small-case-number (eq? (case 3 ((1 2) 'low) ((3) 'three)) 'three))
+
+(define (classify x)
+  (cond ((eq? x 'north) 0)
+        ((eq? x 'east) 1)
+        ((eqv? x 'south) 2)
+        ((eq? 'west x) 3)
+        (else -1)))
+
+(check 'cond-dispatch (= (classify 'south) 2))
+(check 'cond-dispatch-constant-first (= (classify 'west) 3))
+(check 'cond-dispatch-else (= (classify 'up) -1))
+
+(define (ordinal n)
+  (cond ((eqv? n 1) 'first)
+        ((eqv? n 2) 'second)
+        ((eqv? n 3) 'third)
+        ((eqv? n 4) 'fourth)))
+
+(check 'cond-dense (eq? (ordinal 3) 'third))
+(check 'cond-fallthrough (eq? (ordinal 9) '()))
+
+(define (loop-sum n)
+  (let loop ((i 0) (acc 0))
+    (if (= i n)
+        acc
+        (loop (+ i 1)
+              (+ acc (case (remainder i 5)
+                       ((0) 1)
+                       ((1) 10)
+                       ((2) 100)
+                       ((3) 1000)
+                       (else 10000)))))))
+
+(check 'case-in-loop (= (loop-sum 10) 22222))
@@ -0,0 +1,39 @@
+;; Fibers parked by yield or a blocking channel operation resume where
+;; they left off, in order.
+
+(define log '())
+(define (note x) (set! log (cons x log)))
+
+(define (ping-pong)
+  (spawn (lambda () (note 'a) (yield) (note 'c)))
+  (note 'start)
+  (yield)
+  (note 'b)
+  (yield))
+(ping-pong)
+(check 'yield-order (equal? log '(c b a start)))
+
+;; A run ends only once the fibers it spawned have, so a fiber does not
+;; outlive the toplevel form that started it.
+(set! log '())
+(spawn (lambda () (note 'x) (yield) (note 'y)))
+(check 'drained-at-toplevel (equal? log '(y x)))
+
+(define in (make-channel))
+(define out (make-channel))
+(spawn (lambda () (channel-send out (+ 1 (channel-recv in)))))
+(channel-send in 41)
+(check 'channel-round-trip (= (channel-recv out) 42))
+
+(define (counter n ch)
+  (let loop ((i 0))
+    (when (< i n)
+      (channel-send ch i)
+      (loop (+ i 1)))))
+
+(define nums (make-channel))
+(spawn (lambda () (counter 100 nums)))
+(check 'many-parks
+       (= (let loop ((i 0) (sum 0))
+            (if (= i 100) sum (loop (+ i 1) (+ sum (channel-recv nums)))))
+          4950))
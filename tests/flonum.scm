@@ -0,0 +1,31 @@
+;; Flonum arithmetic compiled to float registers, and `let's that must
+;; not be, because a binding or the body may not be a flonum.
+
+(define y "not a flonum")
+(define v '(1 2))
+(check 'let-passes-through (equal? (let ((x y)) x) "not a flonum"))
+(check 'let-star-passes-through (equal? (let* ((x v) (z x)) z) '(1 2)))
+(check 'empty-let-passes-through (equal? (let () v) '(1 2)))
+
+(define a 1.5)
+(define b 2.5)
+(check 'fl-add (fl= (fl+ a b) 4.0))
+(check 'fl-let (fl= (let ((s (fl+ a b)) (d (fl- b a))) (fl* s d)) 4.0))
+(check 'fl-negate (fl= (fl- a) -1.5))
+(check 'fl-reciprocal (fl= (fl/ 4.0) 0.25))
+(check 'fl-convert (fl= (fl+ (exact->inexact 1) a) 2.5))
+(check 'fl-compare (fl< a b 3.0))
+(check 'fl-let-of-literals (fl= (let ((x 1.0) (z 2.0)) (fl+ x z)) 3.0))
+
+(define (norm x z) (fl+ (fl* x x) (fl* z z)))
+(check 'fl-closure (fl= (norm 3.0 4.0) 25.0))
+
+(define (escape cr ci)
+  (let loop ((zr 0.0) (zi 0.0) (i 0))
+    (if (or (= i 50) (fl> (fl+ (fl* zr zr) (fl* zi zi)) 4.0))
+        i
+        (loop (fl+ (fl- (fl* zr zr) (fl* zi zi)) cr)
+              (fl+ (fl* 2.0 (fl* zr zi)) ci)
+              (+ i 1)))))
+(check 'fl-loop-inside (= (escape 0.0 0.0) 50))
+(check 'fl-loop-escapes (= (escape 1.0 1.0) 2))
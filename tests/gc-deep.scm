@@ -0,0 +1,20 @@
+;; A long list and a deep tree survive collections intact.
+
+(define long (iota 1000000))
+
+(define (nest n)
+  (let loop ((i 0) (acc '()))
+    (if (= i n) acc (loop (+ i 1) (list acc)))))
+
+(define (depth tree)
+  (let loop ((t tree) (d 0))
+    (if (eq? t '()) d (loop (car t) (+ d 1)))))
+
+(define deep (nest 1000000))
+
+(let loop ((i 0))
+  (if (< i 20000)
+      (begin (iota 100) (loop (+ i 1)))))
+
+(check 'long-list (= (sum long) 499999500000))
+(check 'deep-tree (= (depth deep) 1000000))
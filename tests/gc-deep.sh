@@ -0,0 +1,7 @@
+#!/bin/sh
+# Collect while a list of a million pairs is live, with the C stack capped
+# at a megabyte, so this only passes if marking does not recurse down the
+# list.
+
+ulimit -s 1024
+exec "$SCHEME" "$PRELUDE" "$TESTS/gc-deep.scm"
@@ -0,0 +1,13 @@
+;; Allocate far more than the initial heap so that collections run, and
+;; check that what is still live comes through them intact.
+
+(define keep (iota 1000))
+
+(define (churn n)
+  (let loop ((i 0) (total 0))
+    (if (= i n)
+        total
+        (loop (+ i 1) (+ total (sum (iota 100)))))))
+
+(check 'garbage-computes (= (churn 20000) (* 20000 4950)))
+(check 'live-data-survives (= (sum keep) 499500))
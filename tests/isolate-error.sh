@@ -0,0 +1,19 @@
+#!/bin/sh
+# An error in an isolate's program ends that isolate only.  Its siblings
+# and parent carry on, and joining it raises the error in the joiner.
+
+cat >failing.scm <<'END'
+(define bad (isolate-spawn '(car 1)))
+(define good (isolate-spawn '(* 6 7)))
+(check 'sibling-result (= (isolate-join good) 42))
+(define again (isolate-spawn '(+ 1 (isolate-receive))))
+(isolate-send again 1)
+(check 'after-failure (= (isolate-join again) 2))
+(isolate-join bad)
+END
+
+if "$SCHEME" "$PRELUDE" failing.scm 2>err; then
+  echo "joining a failed isolate did not raise" >&2
+  exit 1
+fi
+grep -q 'Isolate failed: .*car' err || { cat err >&2; exit 1; }
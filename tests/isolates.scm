@@ -0,0 +1,24 @@
+;; Isolates run a program on a thread and heap of their own; values cross
+;; between them only as copies, through join or mail.
+
+(check 'join-result (= (isolate-join (isolate-spawn '(* 6 7))) 42))
+(check 'main-has-no-parent (eq? (isolate-parent) #f))
+
+(isolate-spawn '(isolate-send (isolate-parent) (list 1 "two" 3.5 'four)))
+(check 'mail-to-parent (equal? (isolate-receive) '(1 "two" 3.5 four)))
+
+(define child (isolate-spawn '(+ 1 (isolate-receive))))
+(isolate-send child 41)
+(check 'mail-to-child (= (isolate-join child) 42))
+
+(define (spawn-sum n)
+  (isolate-spawn
+   (list 'let 'loop '((i 0) (s 0))
+         (list 'if (list '= 'i n) 's '(loop (+ i 1) (+ s i))))))
+
+(define workers (list (spawn-sum 1000) (spawn-sum 2000) (spawn-sum 3000)))
+(check 'parallel-joins
+       (equal? (list (isolate-join (car workers))
+                     (isolate-join (car (cdr workers)))
+                     (isolate-join (car (cdr (cdr workers)))))
+               '(499500 1999000 4498500)))
@@ -0,0 +1,48 @@
+;; Named lets and do loops, both those compiled to backward jumps and those
+;; whose name is used some other way and so stay closures.
+
+(check 'named-let-sum
+       (= (let loop ((i 0) (s 0)) (if (= i 1000) s (loop (+ i 1) (+ s i))))
+          499500))
+
+(check 'do-loop
+       (= (do ((i 0 (+ i 1)) (s 0 (+ s i))) ((= i 10) s)) 45))
+
+(check 'do-without-step
+       (equal? (do ((i 3 (- i 1)) (acc '() (cons i acc)) (k 'k))
+                   ((= i 0) (list acc k)))
+               '((1 2 3) k)))
+
+(define log '())
+(do ((i 0 (+ i 1))) ((= i 3)) (set! log (cons i log)))
+(check 'do-body-runs (equal? log '(2 1 0)))
+
+(check 'swap-in-place
+       (equal? (let loop ((a 1) (b 2) (n 3))
+                 (if (= n 0) (list a b) (loop b a (- n 1))))
+               '(2 1)))
+
+(check 'nested-loops
+       (= (let outer ((i 0) (s 0))
+            (if (= i 10)
+                s
+                (outer (+ i 1)
+                       (let inner ((j 0) (t s))
+                         (if (= j i) t (inner (+ j 1) (+ t 1)))))))
+          45))
+
+;; Not loops: a call outside tail position, and the name escaping.
+(check 'non-tail-call
+       (= (let count ((l '(a b c d))) (if (eq? l '()) 0 (+ 1 (count (cdr l)))))
+          4))
+(check 'name-escapes
+       (= (let self ((n 0)) (if (= n 0) ((car (list self)) 5) n)) 5))
+
+;; Closures made in a loop body keep the values of their own iteration.
+(define thunks
+  (let loop ((i 0) (acc '()))
+    (if (= i 3) acc (loop (+ i 1) (cons (lambda () i) acc)))))
+(check 'captured-iteration
+       (equal? (list ((list-ref thunks 0)) ((list-ref thunks 1))
+                     ((list-ref thunks 2)))
+               '(2 1 0)))
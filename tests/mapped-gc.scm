@@ -0,0 +1,13 @@
+;; Run by mapped-gc.sh on the file it writes.
+
+(define (map-many n)
+  (let loop ((i 0) (total 0))
+    (if (= i n)
+        total
+        (let ((bv (file->bytevector/mapped "small.dat")))
+          (loop (+ i 1) (+ total (bytevector-u8-ref bv 0)))))))
+
+(check 'maps-released (= (map-many 200000) (* 200000 109)))
+
+(define port (open-mapped-input-port "small.dat"))
+(check 'mapped-port-reads (equal? (read port) 'mapped))
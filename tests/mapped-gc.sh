@@ -0,0 +1,8 @@
+#!/bin/sh
+# Map a small file far more often than a process may hold mappings at
+# once (vm.max_map_count defaults to 65530), dropping each bytevector
+# straight away, so this only passes if the collector unmaps dead mapped
+# bytevectors.
+
+echo "mapped bytevector" >small.dat
+exec "$SCHEME" "$PRELUDE" "$TESTS/mapped-gc.scm"
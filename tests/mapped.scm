@@ -0,0 +1,27 @@
+;; Mapped ports and bytevectors read a file in place, including one that
+;; is empty and so has no mapping at all.
+
+(define out (open-output-file "data.txt"))
+(write-string "alpha (beta 2)\nsecond line\n" out)
+(flush-output-port out)
+(flush-output-port (open-output-file "empty.txt"))
+
+(define bv (file->bytevector/mapped "data.txt"))
+(check 'mapped-length (= (u8vector-length bv) 27))
+(check 'mapped-bytes
+       (equal? (list (bytevector-u8-ref bv 0) (bytevector-u8-ref bv 26))
+               '(97 10)))
+
+(define p (open-mapped-input-port "data.txt"))
+(check 'mapped-read (eq? (read p) 'alpha))
+(check 'mapped-read-list (equal? (read p) '(beta 2)))
+(check 'mapped-read-end (eq? (read p) 'second))
+
+(define lines (open-mapped-input-port "data.txt"))
+(check 'mapped-read-line (string=? (read-line lines) "alpha (beta 2)"))
+(check 'mapped-rest (string=? (read-line lines) "second line"))
+(check 'mapped-end (eq? (read-line lines) #f))
+
+(check 'empty-bytevector
+       (= (u8vector-length (file->bytevector/mapped "empty.txt")) 0))
+(check 'empty-port (eq? (read (open-mapped-input-port "empty.txt")) #f))
@@ -0,0 +1,89 @@
+;; SRFI 4 vectors of every element type hold their extreme values exactly
+;; at any length, and the f64 kernels handle lengths that are not a
+;; multiple of their vector width, where the scalar tail does the rest.
+
+(define types
+  (list (list 'u8 make-u8vector u8vector-ref u8vector-set! u8vector->list
+              list->u8vector u8vector-length 0 255)
+        (list 's8 make-s8vector s8vector-ref s8vector-set! s8vector->list
+              list->s8vector s8vector-length -128 127)
+        (list 'u16 make-u16vector u16vector-ref u16vector-set! u16vector->list
+              list->u16vector u16vector-length 0 65535)
+        (list 's16 make-s16vector s16vector-ref s16vector-set! s16vector->list
+              list->s16vector s16vector-length -32768 32767)
+        (list 'u32 make-u32vector u32vector-ref u32vector-set! u32vector->list
+              list->u32vector u32vector-length 0 4294967295)
+        (list 's32 make-s32vector s32vector-ref s32vector-set! s32vector->list
+              list->s32vector s32vector-length -2147483648 2147483647)
+        (list 'u64 make-u64vector u64vector-ref u64vector-set! u64vector->list
+              list->u64vector u64vector-length 0 18446744073709551615)
+        (list 's64 make-s64vector s64vector-ref s64vector-set! s64vector->list
+              list->s64vector s64vector-length
+              -9223372036854775808 9223372036854775807)))
+
+(define lengths '(0 1 3 5 7 8 9 15 17 31 33))
+
+(define (all? ok lst)
+  (cond ((eq? lst '()) #t)
+        ((ok (car lst)) (all? ok (cdr lst)))
+        (else #f)))
+
+;; Fill with the minimum, set every other element to the maximum, and read
+;; the result back both ways.
+(define (type-ok? t n)
+  (let* ((make (list-ref t 1)) (ref (list-ref t 2)) (set (list-ref t 3))
+         (to-list (list-ref t 4)) (from-list (list-ref t 5))
+         (len (list-ref t 6)) (lo (list-ref t 7)) (hi (list-ref t 8))
+         (v (make n lo)))
+    (let loop ((i 0))
+      (when (< i n)
+        (if (= (modulo i 2) 1) (set v i hi))
+        (loop (+ i 1))))
+    (let ((expected (let loop ((i n) (acc '()))
+                      (if (= i 0)
+                          acc
+                          (loop (- i 1)
+                                (cons (if (= (modulo (- i 1) 2) 1) hi lo)
+                                      acc))))))
+      (and (= (len v) n)
+           (equal? (to-list v) expected)
+           (equal? (to-list (from-list expected)) expected)
+           (or (= n 0) (= (ref v (- n 1)) (if (= (modulo (- n 1) 2) 1) hi lo)))))))
+
+(define (check-type t)
+  (check (car t) (all? (lambda (n) (type-ok? t n)) lengths)))
+(let loop ((l types))
+  (when (not (eq? l '()))
+    (check-type (car l))
+    (loop (cdr l))))
+
+(check 'f32-rounds (let ((v (f32vector 0.1 1.5)))
+                     (and (not (= (f32vector-ref v 0) 0.1))
+                          (= (f32vector-ref v 1) 1.5))))
+(check 'f32-exact-stored (= (f32vector-ref (make-f32vector 3 2) 2) 2.0))
+
+(define (f64-range n)
+  (let ((v (make-f64vector n 0)))
+    (let loop ((i 0))
+      (when (< i n)
+        (f64vector-set! v i (+ i 1))
+        (loop (+ i 1))))
+    v))
+
+(define (f64-elements-ok? v f)
+  (let loop ((i 0))
+    (cond ((= i (f64vector-length v)) #t)
+          ((= (f64vector-ref v i) (f i)) (loop (+ i 1)))
+          (else #f))))
+
+(define (kernels-ok? n)
+  (let ((a (f64-range n)) (b (f64-range n)))
+    (and (= (f64vector-sum a) (quotient (* n (+ n 1)) 2))
+         (= (f64vector-dot a b) (quotient (* n (+ n 1) (+ (* 2 n) 1)) 6))
+         (f64-elements-ok? (f64vector-add! a b) (lambda (i) (* 2 (+ i 1))))
+         (f64-elements-ok? (f64vector-scale! b 0.5)
+                           (lambda (i) (/ (+ i 1) 2.0)))
+         (f64-elements-ok? (f64vector-map! (lambda (x) (- x 1)) b)
+                           (lambda (i) (- (/ (+ i 1) 2.0) 1))))))
+(check 'f64-kernels (all? kernels-ok? lengths))
+(check 'f64-kernels-long (kernels-ok? 1027))
@@ -0,0 +1,37 @@
+#!/bin/sh
+# Run numvectors.scm, then store one past each end of every integer
+# type's range, which must be refused rather than wrapped around.
+
+"$SCHEME" "$PRELUDE" "$TESTS/numvectors.scm" || exit 1
+
+status=0
+while read -r make value; do
+  printf '(%s 1 %s)\n' "$make" "$value" >overflow.scm
+  if "$SCHEME" overflow.scm 2>err; then
+    echo "($make 1 $value) was accepted" >&2
+    status=1
+  elif ! grep -q 'does not fit' err; then
+    cat err >&2
+    status=1
+  fi
+done <<'END'
+make-u8vector -1
+make-u8vector 256
+make-s8vector -129
+make-s8vector 128
+make-u16vector -1
+make-u16vector 65536
+make-s16vector -32769
+make-s16vector 32768
+make-u32vector -1
+make-u32vector 4294967296
+make-s32vector -2147483649
+make-s32vector 2147483648
+make-u64vector -1
+make-u64vector 18446744073709551616
+make-s64vector -9223372036854775809
+make-s64vector 9223372036854775808
+make-s32vector 1.5
+make-u8vector #\a
+END
+exit $status
@@ -0,0 +1,31 @@
+;; Futures and the parallel list operations, run on the work-stealing pool
+;; with enough elements that every worker gets chunks, and enough garbage
+;; that collections stop the world while they run.
+
+(define f (future (lambda () (sum (iota 1000)))))
+(check 'touch (= (touch f) 499500))
+(check 'touch-twice (= (touch f) 499500))
+
+(define fs (list (future (lambda () 1)) (future (lambda () 2))
+                 (future (lambda () 3))))
+(check 'many-futures
+       (= (+ (touch (list-ref fs 0)) (touch (list-ref fs 1))
+             (touch (list-ref fs 2)))
+          6))
+
+(define nums (iota 10000))
+(define squares (parallel-map (lambda (x) (* x x)) nums))
+(check 'map-order (equal? (list-ref squares 0) 0))
+(check 'map-last (= (list-ref squares 9999) 99980001))
+(check 'map-length (= (length squares) 10000))
+
+(check 'map-allocating
+       (= (sum (parallel-map (lambda (x) (length (iota (remainder x 50))))
+                             nums))
+          (* 200 1225)))
+
+(check 'reduce (= (parallel-reduce + 0 nums) 49995000))
+(check 'reduce-empty (= (parallel-reduce + 7 '()) 7))
+
+(parallel-for-each (lambda (x) (iota 10)) nums)
+(check 'map-empty (eq? (parallel-map (lambda (x) x) '()) '()))
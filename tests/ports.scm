@@ -0,0 +1,38 @@
+;; File ports on the buffered layer, with buffers made small enough that
+;; lines and reads straddle refills and flushes.
+
+(define out (open-output-file "lines.txt"))
+(set-port-buffer-size! out 7)
+(let loop ((i 0))
+  (when (< i 1000)
+    (write-string (string-append "line " (number->string i) "\n") out)
+    (loop (+ i 1))))
+(flush-output-port out)
+
+(define in (open-input-file "lines.txt"))
+(set-port-buffer-size! in 5)
+(check 'read-line (string=? (read-line in) "line 0"))
+(check 'read-string (string=? (read-string 6 in) "line 1"))
+(check 'rest-of-line (string=? (read-line in) ""))
+(check 'remaining-lines
+       (= (let loop ((n 0)) (if (read-line in) (loop (+ n 1)) n)) 998))
+(check 'end-of-file (eq? (read-line in) #f))
+
+(define bv (read-bytevector 5 (open-binary-input-file "lines.txt")))
+(check 'read-bytevector (= (bytevector-u8-ref bv 0) 108))
+
+(define bout (open-binary-output-file "copy.bin"))
+(write-bytevector bv bout)
+(flush-output-port bout)
+(check 'write-bytevector
+       (string=? (read-string 10 (open-input-file "copy.bin")) "line "))
+
+(read-bytevector! bv (open-binary-input-file "lines.txt") 1 3)
+(check 'read-bytevector!
+       (equal? (list (bytevector-u8-ref bv 1) (bytevector-u8-ref bv 2)
+                     (bytevector-u8-ref bv 3))
+               '(108 105 101)))
+
+(define all (open-binary-output-file "all.txt"))
+(check 'copy-port
+       (= (copy-port (open-binary-input-file "lines.txt") all) 8890))
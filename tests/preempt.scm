@@ -0,0 +1,18 @@
+;; Run with a quantum: a fiber that loops without yielding still gives way
+;; to the others, and a loop with no other fiber ready is handed back to
+;; the driver and resumed where it stopped.
+
+(define (spin-until-set)
+  (define done #f)
+  (spawn (lambda () (set! done #t)))
+  (let loop ((n 0))
+    (if done n (loop (+ n 1)))))
+(check 'spinner-preempted (> (spin-until-set) 0))
+
+(define (count-to n)
+  (let loop ((i 0) (s 0))
+    (if (= i n) s (loop (+ i 1) (+ s i)))))
+(check 'resumed-after-fuel (= (count-to 100000) 4999950000))
+
+(define (fib n) (if (< n 2) n (+ (fib (- n 1)) (fib (- n 2)))))
+(check 'resumed-mid-call (= (fib 20) 6765))
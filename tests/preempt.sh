@@ -0,0 +1,17 @@
+#!/bin/sh
+# Loops that never yield must still be interrupted: with a small quantum
+# preempt.scm only terminates if the spinning fiber is switched out, and
+# a loop that never ends must stop with an error once its deadline
+# passes.
+
+"$SCHEME" -q 100 -t 60000 "$PRELUDE" "$TESTS/preempt.scm" || exit 1
+
+echo '(let loop () (loop))' >forever.scm
+if "$SCHEME" -t 200 forever.scm 2>err; then
+  echo "forever.scm finished" >&2
+  exit 1
+fi
+grep -q 'Deadline exceeded' err || { cat err >&2; exit 1; }
+
+"$SCHEME" -q 100 -t 200 forever.scm 2>err && exit 1
+grep -q 'Deadline exceeded' err || { cat err >&2; exit 1; }
@@ -0,0 +1,12 @@
+;; Loaded by run.sh ahead of every test.  A check that fails raises an
+;; error naming it, which makes the interpreter exit nonzero.
+
+(define (check name ok) (if ok #t (error "check failed:" name)))
+
+(define (iota n)
+  (let loop ((i n) (acc '()))
+    (if (= i 0) acc (loop (- i 1) (cons (- i 1) acc)))))
+
+(define (sum lst)
+  (let loop ((l lst) (s 0))
+    (if (eq? l '()) s (loop (cdr l) (+ s (car l))))))
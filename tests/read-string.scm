@@ -0,0 +1,17 @@
+;; read-string counts characters, not bytes, even when the whole input is
+;; shorter than the longest UTF-8 sequence.
+
+(check 'two-byte-only (string=? (read-string 1 (open-input-string "é")) "é"))
+(check 'ascii-then-two-byte
+       (string=? (read-string 2 (open-input-string "aé")) "aé"))
+(check 'four-byte (string=? (read-string 1 (open-input-string "😀")) "😀"))
+
+(define p (open-input-string "aé😀b"))
+(check 'one-at-a-time
+       (equal? (let* ((a (read-string 1 p)) (b (read-string 1 p))
+                      (c (read-string 1 p)) (d (read-string 1 p)))
+                 (list a b c d))
+               '("a" "é" "😀" "b")))
+(check 'at-end (eq? (read-string 1 p) #f))
+(check 'short-at-end
+       (= (string-length (read-string 10 (open-input-string "éé"))) 2))
@@ -0,0 +1,13 @@
+;; Run by reader-stream.sh on the data it generates.
+
+(define p (open-mapped-input-port "stream.dat"))
+
+(define (scan p)
+  (let loop ((x (read p)) (n 0) (sum 0))
+    (if (eq? x #f)
+        (cons n sum)
+        (loop (read p) (+ n 1) (+ sum (car x))))))
+
+(define result (scan p))
+(check 'every-datum-read (= (car result) 2000000))
+(check 'data-intact (= (cdr result) 1999999000000))
@@ -0,0 +1,11 @@
+#!/bin/sh
+# Read about 70 MB of data one datum at a time with the address space
+# capped well below the couple of gigabytes keeping every datum would
+# take, so this only passes if the collector reclaims data once it has
+# been read and the reader does not hold on to input it has consumed.
+
+awk 'BEGIN { for (i = 0; i < 2000000; i++)
+               printf "(%d \"entry\" #(1 2 3) (a . b))\n", i }' >stream.dat
+ulimit -s 1024
+ulimit -v 1048576
+exec "$SCHEME" "$PRELUDE" "$TESTS/reader-stream.scm"
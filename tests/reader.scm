@@ -0,0 +1,36 @@
+;; The reader, through `read' on string ports: numbers parsed without
+;; strtod, escapes, comments skipped by the scanners, and symbols interned
+;; straight into the symbol table.
+
+(define (read-from s) (read (open-input-string s)))
+
+(check 'integer (= (read-from "12345") 12345))
+(check 'negative (= (read-from "-42") -42))
+(check 'bignum (= (read-from "100000000000000000000")
+                  (* 10000000000 10000000000)))
+(check 'decimal (= (read-from "0.1") (/ 1.0 10.0)))
+(check 'exponent (= (read-from "2.5e-3") (/ 2.5 1000.0)))
+(check 'large-exponent (= (read-from "1e22") (* 1e11 1e11)))
+(check 'negative-float (= (read-from "-0.5") (/ -1.0 2.0)))
+
+(check 'string-escapes
+       (equal? (read-from "\"a\\nb\\x41;\"") (string-append "a\nb" "A")))
+(check 'character (char=? (read-from "#\\a") #\a))
+(check 'named-character (char=? (read-from "#\\space") #\space))
+(check 'booleans (equal? (list (read-from "#t") (read-from "#false"))
+                         '(#t #f)))
+
+(check 'interned (eq? (read-from "foo") 'foo))
+(check 'bar-symbol (eq? (read-from "|two words|") '|two words|))
+(check 'quote (equal? (read-from "'x") '(quote x)))
+(check 'nested (equal? (read-from "(a (b [c]) . d)") '(a (b (c)) . d)))
+(check 'vector (eq? (vector-ref (read-from "#(p q)") 1) 'q))
+(check 'bytevector (= (bytevector-u8-ref (read-from "#u8(7 8 9)") 2) 9))
+
+(define p
+  (open-input-string
+   "; comment\n one #| block #| nested |# |# two #;(skipped) three"))
+(check 'comments
+       (equal? (let* ((a (read p)) (b (read p)) (c (read p))) (list a b c))
+               '(one two three)))
+(check 'end-of-input (eq? (read p) #f))
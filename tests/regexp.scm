@@ -0,0 +1,86 @@
+;; Regular expressions: leftmost-first matching with alternation, classes,
+;; anchors, groups and counted repetition, over UTF-8 text, including
+;; patterns whose DFA outgrows its cache.
+
+(define (span re s) (regexp-search re s))
+
+(check 'alt-first (equal? (span "ab|a" "ab") '(0 . 2)))
+(check 'alt-leftmost (equal? (span "dog|cat" "a cat, a dog") '(2 . 5)))
+(check 'alt-match (regexp-match "cat|dog|bird" "dog"))
+(check 'alt-whole (not (regexp-match "cat|dog" "cats")))
+(check 'alt-empty-branch (equal? (span "x(a|)y" "xy") '(0 . 2)))
+
+(check 'class-range (equal? (span "[0-9]+" "ab123c") '(2 . 5)))
+(check 'class-negated (equal? (span "[^a-c]" "abcd") '(3 . 4)))
+(check 'class-escapes (equal? (span "\\d+\\s+\\w+" "n: 42  abc_9!") '(3 . 12)))
+(check 'class-dot-newline (not (regexp-match "a.b" "a\nb")))
+(check 'class-non-ascii (equal? (span "[α-ω]+" "abc αβγ def") '(4 . 7)))
+(check 'literal-non-ascii (equal? (span "é+" "caféé!") '(3 . 5)))
+
+(check 'anchor-begin (equal? (span "^ab" "abab") '(0 . 2)))
+(check 'anchor-begin-only-at-start (not (span "^b" "ab")))
+(check 'anchor-not-at-from (not (regexp-search "^a" "ba" 1)))
+(check 'anchor-end (equal? (span "ab$" "abab") '(2 . 4)))
+(check 'anchor-both (and (regexp-match "^a*$" "aaa") (not (span "^a*$" "aab"))))
+(check 'search-from (equal? (regexp-search "a" "abca" 1) '(3 . 4)))
+
+;; Groups match as a unit; a search reports the span of the whole match.
+(check 'group-repeat (equal? (span "(ab)+" "xababab") '(1 . 7)))
+(check 'group-noncapturing (equal? (span "(?:ab)+c" "abababc") '(0 . 7)))
+(check 'group-nested (equal? (span "((a|b)c)+" "zacbcd") '(1 . 5)))
+(check 'group-alt (equal? (span "x(ab|cd)*y" "xabcdaby") '(0 . 8)))
+
+(check 'greedy (equal? (span "a+" "baaa") '(1 . 4)))
+(check 'lazy (equal? (span "a+?" "baaa") '(1 . 2)))
+(check 'lazy-then-literal (equal? (span "<.*?>" "<a><b>") '(0 . 3)))
+(check 'counted (equal? (span "x{2,3}" "axxxxb") '(1 . 4)))
+(check 'counted-exact (not (regexp-match "x{3}" "xx")))
+
+(check 'replace-all (string=? (regexp-replace "o+" "foo boo" "0") "f0 b0"))
+(check 'replace-empty (string=? (regexp-replace "x*" "ab" "-") "-a-b-"))
+
+(check 'compiled-reused
+       (let ((re (regexp-compile "[a-z]+@[a-z]+")))
+         (and (regexp-match re "me@here")
+              (equal? (regexp-search re "to: you@there.") '(4 . 13)))))
+
+;; Nested stars match in linear time; a backtracking matcher would take
+;; exponential time to fail here.
+(define many-a
+  (let ((out (open-output-string)))
+    (let loop ((i 0))
+      (when (< i 5000)
+        (write-string "a" out)
+        (loop (+ i 1))))
+    (get-output-string out)))
+(check 'nested-star-fails (not (regexp-match "(a*)*b" many-a)))
+(check 'nested-star-matches
+       (regexp-match "(a*)*b" (string-append many-a "b")))
+(check 'nested-star-search
+       (equal? (span "(a*)*b" (string-append "xx" many-a "b")) '(2 . 5003)))
+
+;; Telling which of the last sixteen characters were a takes the forward
+;; DFA tens of thousands of states, far past its cache, so matching must
+;; carry on correctly after the cache is flushed.
+(define (random-ab n seed)
+  (let ((out (open-output-string)))
+    (let loop ((i 0) (x seed))
+      (when (< i n)
+        (write-string (if (< x 1073741824) "a" "b") out)
+        (loop (+ i 1) (modulo (+ (* x 1103515245) 12345) 2147483648))))
+    (get-output-string out)))
+
+(define text (random-ab 200000 7))
+(define (last-a-end s)
+  (let loop ((i (- (string-length s) 16)))
+    (cond ((< i 0) #f)
+          ((char=? (string-ref s i) #\a) (+ i 16))
+          (else (loop (- i 1))))))
+
+(check 'cache-flush-search
+       (equal? (span "(a|b)*a(a|b){15}" text) (cons 0 (last-a-end text))))
+(check 'cache-flush-match
+       (eq? (regexp-match "[ab]*a[ab]{15}" text)
+            (char=? (string-ref text (- (string-length text) 16)) #\a)))
+(check 'cache-flush-miss
+       (not (regexp-match "[ab]*a[ab]{15}" (string-append text "b" many-a "c"))))
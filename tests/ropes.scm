@@ -0,0 +1,120 @@
+;; Strings built by string-append are balanced trees of leaves, flattened
+;; on first random access.  Each is checked against the same text written
+;; through a string port, which builds it flat.
+
+(define (build n piece combine)
+  (let loop ((i 0) (acc ""))
+    (if (= i n) acc (loop (+ i 1) (combine acc (piece i))))))
+
+(define (build-flat n piece backwards)
+  (let ((out (open-output-string)))
+    (let loop ((i 0))
+      (when (< i n)
+        (write-string (piece (if backwards (- n i 1) i)) out)
+        (loop (+ i 1))))
+    (get-output-string out)))
+
+(define letters "abcdefghijklmnopqrstuvwxyz")
+(define (short i) (substring letters (modulo i 20) (+ (modulo i 20) 7)))
+(define (wide i) (string-append "αβγ" (number->string i) "ω"))
+(define (long i)
+  (let ((out (open-output-string)))
+    (let loop ((k 0))
+      (when (< k 600)
+        (write-string (short (+ i k)) out)
+        (loop (+ k 7))))
+    (get-output-string out)))
+
+(define (same? a b)
+  (and (= (string-length a) (string-length b))
+       (string=? a b)))
+
+;; Positions either side of every leaf boundary a merge could have left.
+(define (refs-agree? a b)
+  (let ((n (string-length a)))
+    (let loop ((i 0))
+      (cond ((>= i n) #t)
+            ((not (char=? (string-ref a i) (string-ref b i))) #f)
+            (else (loop (+ i (if (< (modulo i 512) 2) 1 509))))))))
+
+(define appended (build 3000 short (lambda (acc p) (string-append acc p))))
+(define appended-flat (build-flat 3000 short #f))
+(check 'append-refs (refs-agree? appended appended-flat))
+(check 'append-chain (same? appended appended-flat))
+
+;; Prepending a short piece to a tree joins it at the far left, rotating
+;; on the way back up.
+(define prepended (build 3000 short (lambda (acc p) (string-append p acc))))
+(check 'prepend-chain (same? prepended (build-flat 3000 short #t)))
+
+;; Pieces past the leaf size are never merged, so every one is a leaf.
+(define (zigzag acc p i)
+  (if (= (modulo i 2) 0) (string-append acc p) (string-append p acc)))
+(define zigzagged
+  (let loop ((i 0) (acc ""))
+    (if (= i 200) acc (loop (+ i 1) (zigzag acc (long i) i)))))
+(define zigzagged-flat
+  (let loop ((i 0) (acc ""))
+    (if (= i 200)
+        acc
+        (loop (+ i 1)
+              (let ((out (open-output-string)))
+                (if (= (modulo i 2) 0)
+                    (begin (write-string acc out) (write-string (long i) out))
+                    (begin (write-string (long i) out) (write-string acc out)))
+                (get-output-string out))))))
+(check 'zigzag-refs (refs-agree? zigzagged zigzagged-flat))
+(check 'zigzag-chain (same? zigzagged zigzagged-flat))
+
+(define wide-appended (build 2000 wide string-append))
+(check 'wide-chain (same? wide-appended (build-flat 2000 wide #f)))
+(check 'wide-length (= (string-length wide-appended)
+                       (string-length (build-flat 2000 wide #f))))
+
+;; Joining trees of very different depths descends the deeper one.
+(define (longs n) (build n long string-append))
+(check 'join-shallow-deep
+       (same? (string-append (longs 3) (longs 300))
+              (string-append (build-flat 3 long #f) (build-flat 300 long #f))))
+(check 'join-deep-shallow
+       (same? (string-append (longs 300) (longs 3))
+              (string-append (build-flat 300 long #f) (build-flat 3 long #f))))
+
+;; Substrings of a tree, long ones sharing its flattened bytes and short
+;; ones copied, including substrings of substrings.
+(define flat (build-flat 3000 short #f))
+(define (substrings-agree? s)
+  (and (same? (substring s 500 5000) (substring flat 500 5000))
+       (same? (substring s 1000 1030) (substring flat 1000 1030))
+       (same? (substring (substring s 100 9000) 411 2000)
+              (substring flat 511 2100))
+       (same? (string-append (substring s 0 700) (substring s 700 21000))
+              flat)))
+(check 'rope-substrings
+       (substrings-agree? (build 3000 short string-append)))
+
+(define wide-flat (build-flat 2000 wide #f))
+(check 'wide-substring
+       (same? (substring (build 2000 wide string-append) 333 9001)
+              (substring wide-flat 333 9001)))
+
+;; Many threads reading the same tree race to flatten it; each must see
+;; the whole text whichever copy wins.
+(define shared (build 3000 short string-append))
+(define (ref-at i) (string-ref shared (* i 7)))
+(define refs (parallel-map ref-at (iota 3000)))
+(check 'parallel-flatten
+       (let loop ((l refs) (i 0))
+         (cond ((eq? l '()) #t)
+               ((char=? (car l) (string-ref flat (* i 7))) (loop (cdr l) (+ i 1)))
+               (else #f))))
+
+(define shared-wide (build 2000 wide string-append))
+(define (slice-at i) (substring shared-wide i (+ i 600)))
+(define slices (parallel-map slice-at (iota 200)))
+(check 'parallel-slices
+       (let loop ((l slices) (i 0))
+         (cond ((eq? l '()) #t)
+               ((same? (car l) (substring wide-flat i (+ i 600)))
+                (loop (cdr l) (+ i 1)))
+               (else #f))))
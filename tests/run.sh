@@ -0,0 +1,50 @@
+#!/bin/sh
+# Run every test under tests/ with the interpreter given as the first
+# argument, by default the ./scheme that `make' builds at the top of the
+# tree; `make check' builds it first.  A missing interpreter is an error,
+# not a run in which every test fails.  A .scm test passes when the interpreter exits with status 0
+# on it after prelude.scm, which defines `check' and the list helpers the
+# tests share; a failed check raises an error and so exits nonzero.  A .sh
+# test prepares its own input and runs the interpreter itself, finding it
+# in SCHEME, the prelude in PRELUDE and the tests in TESTS.  Every test
+# runs in a scratch directory of its own; a failing test's last lines of
+# error output are shown under its name.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+scheme=${1:-$dir/../scheme}
+case $scheme in
+  /*) ;;
+  *) scheme=$(pwd)/$scheme ;;
+esac
+if [ ! -x "$scheme" ] || [ -d "$scheme" ]; then
+  echo "tests/run.sh: no interpreter at $scheme; run make first" >&2
+  exit 2
+fi
+pass=0
+fail=0
+
+for t in "$dir"/*.scm "$dir"/*.sh; do
+  name=$(basename "$t")
+  case $name in
+    run.sh | prelude.scm) continue ;;
+  esac
+  case $name in
+    *.scm) [ -e "${t%.scm}.sh" ] && continue ;;
+  esac
+
+  scratch=$(mktemp -d)
+  if (cd "$scratch" && case $name in
+        *.scm) "$scheme" "$dir/prelude.scm" "$t" ;;
+        *.sh) SCHEME=$scheme PRELUDE=$dir/prelude.scm TESTS=$dir sh "$t" ;;
+      esac) >/dev/null 2>"$scratch.err"; then
+    pass=$((pass + 1))
+  else
+    fail=$((fail + 1))
+    echo "FAIL: $name"
+    tail -n 5 "$scratch.err" | sed 's/^/  /'
+  fi
+  rm -rf "$scratch" "$scratch.err"
+done
+
+echo "$pass passed, $fail failed"
+[ "$fail" -eq 0 ]
@@ -0,0 +1,10 @@
+;; Run by string-port-gc.sh.  Each string port carries buffers outside the
+;; heap; dropped ones must be collected as fast as they are made.
+
+(define (churn n)
+  (let loop ((i 0) (sum 0))
+    (if (= i n)
+        sum
+        (loop (+ i 1)
+              (+ sum (read (open-input-string (number->string i))))))))
+(check 'every-port-read (= (churn 300000) 44999850000))
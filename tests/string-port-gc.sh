@@ -0,0 +1,7 @@
+#!/bin/sh
+# Read one number from each of 300000 string ports with the address space
+# capped, so this only passes if the heap is collected often enough that
+# the buffers of dropped ports do not pile up.
+
+ulimit -v 262144
+exec "$SCHEME" "$PRELUDE" "$TESTS/string-port-gc.scm"
@@ -0,0 +1,33 @@
+;; String and bytevector ports growing their buffers as output arrives.
+
+(define out (open-output-string))
+(let loop ((i 0))
+  (when (< i 1000)
+    (write-string "ab" out)
+    (loop (+ i 1))))
+(define s (get-output-string out))
+(check 'grown (= (string-length s) 2000))
+(check 'contents (string=? (substring s 1996 2000) "abab"))
+
+(write-string "é😀" out)
+(check 'get-again (= (string-length (get-output-string out)) 2002))
+(check 'earlier-result-unchanged (= (string-length s) 2000))
+(check 'multibyte
+       (char=? (string-ref (get-output-string out) 2001) #\x1F600))
+
+(check 'empty (string=? (get-output-string (open-output-string)) ""))
+
+(define in (open-input-string "first\nsecond"))
+(check 'input-line (string=? (read-line in) "first"))
+(check 'input-rest (string=? (read-string 10 in) "second"))
+
+(define bout (open-output-bytevector))
+(write-bytevector (make-u8vector 3 7) bout)
+(write-bytevector (make-u8vector 2 9) bout)
+(define bv (get-output-bytevector bout))
+(check 'bytevector-output
+       (equal? (u8vector->list bv) '(7 7 7 9 9)))
+
+(define bin (open-input-bytevector bv))
+(check 'bytevector-input (equal? (u8vector->list (read-bytevector 4 bin))
+                                 '(7 7 7 9)))
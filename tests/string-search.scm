@@ -0,0 +1,41 @@
+;; String search and comparison on haystacks long enough for the vector
+;; kernels, with patterns short and long, matches at either end, and text
+;; that is not ASCII.
+
+(define (repeat s n)
+  (let ((out (open-output-string)))
+    (let loop ((i 0))
+      (when (< i n)
+        (write-string s out)
+        (loop (+ i 1))))
+    (get-output-string out)))
+
+(define hay (string-append (repeat "abcdefgh" 1000) "needle" "xyz"))
+(define long-pat (string-append (repeat "abcdefgh" 5) "needle"))
+
+(check 'index-first (= (string-index hay #\a) 0))
+(check 'index-late (= (string-index hay #\n) 8000))
+(check 'index-missing (eq? (string-index hay #\Q) #f))
+(check 'contains-short (= (string-contains hay "needle") 8000))
+(check 'contains-long (= (string-contains hay long-pat) 7960))
+(check 'contains-missing (eq? (string-contains hay "needles") #f))
+(check 'contains-at-start (= (string-contains hay "abc") 0))
+(check 'contains-empty (= (string-contains hay "") 0))
+
+(check 'search-all-disjoint (equal? (string-search-all "aaaaa" "aa") '(0 2)))
+(check 'search-all-empty (equal? (string-search-all "ab" "") '(0 1 2)))
+(check 'search-all-count
+       (= (length (string-search-all hay "cd")) 1000))
+
+(define wide (string-append (repeat "αβγ" 50) "ω" (repeat "é" 10) "ω"))
+(check 'index-non-ascii (= (string-index wide #\ω) 150))
+(check 'contains-non-ascii (= (string-contains wide "éω") 160))
+(check 'search-all-non-ascii (equal? (string-search-all wide "ω") '(150 161)))
+
+(define long-a (string-append (repeat "x" 100) "a"))
+(define long-b (string-append (repeat "x" 100) "b"))
+(check 'equal (string=? long-a (string-append (repeat "x" 100) "a")))
+(check 'not-equal (eq? (string=? long-a long-b) #f))
+(check 'less (string<? long-a long-b))
+(check 'prefix-less (string<? (repeat "x" 100) long-a))
+(check 'not-greater (eq? (string>? long-a long-b) #f))
@@ -0,0 +1,26 @@
+;; Run by symbols-gc.sh on the symbols it generates.  Symbols nothing
+;; refers to any more are dropped from the table, while those still held,
+;; by a variable, a global definition or a case jump table, stay unique.
+
+(define (kind x)
+  (case x
+    ((apple banana cherry date elder fig grape) 'fruit)
+    ((ant bee cicada dragonfly earwig flea gnat) 'insect)
+    (else 'other)))
+
+(define (intern name) (read (open-input-string name)))
+(define kept (intern "kept-symbol"))
+
+(define p (open-input-file "symbols.dat"))
+(define (scan p)
+  (let loop ((x (read p)) (n 0))
+    (if (eq? x #f) n (loop (read p) (+ n 1)))))
+(check 'every-symbol-read (= (scan p) 3000000))
+
+(check 'held-symbol (eq? kept (intern "kept-symbol")))
+(check 'global-name (eq? (intern "kind") 'kind))
+(check 'dispatch-keys
+       (and (eq? (kind (intern "fig")) 'fruit)
+            (eq? (kind (intern "gnat")) 'insect)
+            (eq? (kind (intern "unique-symbol-5")) 'other)))
+(check 'reinterned (eq? (intern "unique-symbol-7") (intern "unique-symbol-7")))
@@ -0,0 +1,9 @@
+#!/bin/sh
+# Read three million distinct symbols with the address space capped well
+# below what keeping all of them would take, so this only passes if the
+# symbol table lets the collector reclaim symbols once they are dropped.
+
+awk 'BEGIN { for (i = 0; i < 3000000; i++) printf "unique-symbol-%d\n", i }' \
+  >symbols.dat
+ulimit -v 262144
+exec "$SCHEME" "$PRELUDE" "$TESTS/symbols-gc.scm"
@@ -0,0 +1,17 @@
+;; Symbols read on several pool threads at once are interned to the same
+;; object.
+
+(define (read-names i)
+  (read (open-input-string "(interned-in-parallel another-fresh-name)")))
+
+(define results (parallel-map read-names (iota 2000)))
+
+(define (all-eq? lst)
+  (let loop ((l lst))
+    (cond ((eq? l '()) #t)
+          ((and (eq? (car (car l)) 'interned-in-parallel)
+                (eq? (car (cdr (car l))) 'another-fresh-name))
+           (loop (cdr l)))
+          (else #f))))
+
+(check 'unique-symbols (all-eq? results))
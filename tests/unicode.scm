@@ -0,0 +1,35 @@
+;; Character properties and case mappings from the generated tables, on
+;; ASCII and beyond it, and the string case conversions whose ASCII runs
+;; take the fast path.
+
+(check 'upcase-ascii (char=? (char-upcase #\a) #\A))
+(check 'upcase-latin (char=? (char-upcase #\é) #\É))
+(check 'upcase-greek (char=? (char-upcase #\λ) #\Λ))
+(check 'upcase-cyrillic (char=? (char-upcase #\ж) #\Ж))
+(check 'upcase-uncased (char=? (char-upcase #\1) #\1))
+(check 'downcase (char=? (char-downcase #\Ω) #\ω))
+(check 'foldcase (char=? (char-foldcase #\Σ) #\σ))
+
+(check 'alphabetic (and (char-alphabetic? #\a) (char-alphabetic? #\中)
+                        (not (char-alphabetic? #\3))))
+(check 'numeric (and (char-numeric? #\7) (char-numeric? #\٣)
+                     (not (char-numeric? #\x))))
+(check 'whitespace (and (char-whitespace? #\space)
+                        (char-whitespace? #\x3000)
+                        (not (char-whitespace? #\_))))
+(check 'upper-case (and (char-upper-case? #\Д) (not (char-upper-case? #\д))))
+(check 'lower-case (and (char-lower-case? #\ß) (not (char-lower-case? #\A))))
+(check 'digit-value (and (= (digit-value #\9) 9) (= (digit-value #\٣) 3)
+                         (eq? (digit-value #\a) #f)))
+
+(check 'string-upcase-ascii
+       (string=? (string-upcase "hello, world") "HELLO, WORLD"))
+(check 'string-upcase-mixed
+       (string=? (string-upcase "straße café") "STRASSE CAFÉ"))
+(check 'string-downcase
+       (string=? (string-downcase "ΑΒΓ Hello") "αβγ hello"))
+(check 'string-foldcase
+       (string=? (string-foldcase "Straße") (string-foldcase "STRASSE")))
+(check 'string-upcase-long
+       (string=? (string-upcase "abcdefghijklmnopqrstuvwxyzabcdefghijklmnop")
+                 "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP"))
@@ -0,0 +1,54 @@
+;; Run by uring.sh.  Many fibers reading and writing local files at once,
+;; which batches their transfers through the scheduler's io_uring where
+;; the kernel has one and takes the synchronous path where it does not.
+
+(define results (make-channel))
+
+(define (reader i)
+  (spawn
+   (lambda ()
+     (let ((p (open-binary-input-file (string-append "f" (number->string i)))))
+       (let loop ((n 0) (ok #t))
+         (let ((bv (read-bytevector 4096 p)))
+           (if (eq? bv #f)
+               (channel-send results (list i n ok))
+               (loop (+ n (u8vector-length bv))
+                     (and ok (= (bytevector-u8-ref bv 0) 120))))))))))
+
+(let loop ((i 0))
+  (when (< i 50)
+    (reader i)
+    (loop (+ i 1))))
+
+(check 'concurrent-reads
+       (let loop ((k 0) (ok #t))
+         (if (= k 50)
+             ok
+             (let ((r (channel-recv results)))
+               (loop (+ k 1)
+                     (and ok (= (list-ref r 1) (* 1000 (+ (car r) 1)))
+                          (list-ref r 2)))))))
+
+(define done (make-channel))
+(define (writer name)
+  (spawn
+   (lambda ()
+     (let ((p (open-binary-output-file name))
+           (msg (make-u8vector 100 121)))
+       (let loop ((i 0))
+         (when (< i 100)
+           (write-bytevector msg p)
+           (loop (+ i 1))))
+       (flush-output-port p)
+       (channel-send done name)))))
+
+(writer "w0")
+(writer "w1")
+(channel-recv done)
+(channel-recv done)
+(check 'concurrent-writes
+       (= (copy-port (open-binary-input-file "w0")
+                     (open-binary-output-file "both"))
+          (copy-port (open-binary-input-file "w1")
+                     (open-binary-output-file "both2"))
+          10000))
@@ -0,0 +1,9 @@
+#!/bin/sh
+# Fifty files of different sizes for uring.scm's fibers to read at once.
+
+i=0
+while [ $i -lt 50 ]; do
+  head -c $(((i + 1) * 1000)) /dev/zero | tr '\0' x >f$i
+  i=$((i + 1))
+done
+exec "$SCHEME" "$PRELUDE" "$TESTS/uring.scm"
@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+"""Generate src/pow5.h, the 128-bit truncated powers of five used by the
+reader's Eisel-Lemire float parser.
+
+Entry Q holds the 128 most significant bits of 5^Q for Q >= 0, and of a
+rounded-up reciprocal scaled to 128 bits for Q < 0.
+
+usage: tools/pow5.py > src/pow5.h
+"""
+
+SMALLEST = -342
+LARGEST = 308
+
+
+def entry(q):
+    if q >= 0:
+        p = 5**q
+        while p < 1 << 127:
+            p *= 2
+        while p >= 1 << 128:
+            p //= 2
+        return p
+    p = 5**-q
+    z = p.bit_length()
+    b = z + 127 if q >= -27 else 2 * z + 128
+    c = 2**b // p + 1
+    while c >= 1 << 128:
+        c //= 2
+    return c
+
+
+def main():
+    print("/* Generated by tools/pow5.py; do not edit.  */")
+    print()
+    print("#define POW5_SMALLEST %d" % SMALLEST)
+    print("#define POW5_LARGEST %d" % LARGEST)
+    print()
+    print("static const uint64_t pow5_table[][2] = {")
+    for q in range(SMALLEST, LARGEST + 1):
+        v = entry(q)
+        print("  { 0x%016xu, 0x%016xu }," % (v >> 64, v & ((1 << 64) - 1)))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Generate src/unidata.h, the character property tables behind the char
+predicates and case mappings, from Python's unicodedata.
+
+Each code point maps through two stages to a record holding its general
+category, its Uppercase and Lowercase properties, its value as a decimal
+digit and the deltas of its simple upper, lower and fold mappings.
+Stage one is indexed by the high bits and names a block of stage two,
+indexed by the low bits; identical blocks are stored once.  The block
+size is whichever makes the tables smallest.
+
+Python exposes only the full mappings.  Where one is longer than a
+character, the simple mapping is recovered as UnicodeData.txt has it:
+uppercase falls back to a single-character titlecase (the Greek iota
+subscript letters), lowercase is the character itself except for U+0130,
+and folding falls back to a single-character lowercase.  Characters with
+a longer full mapping also get an entry in a sorted special table used
+by the string procedures.
+
+usage: tools/unidata.py > src/unidata.h
+"""
+
+import unicodedata
+
+CATEGORIES = (
+    "Lu Ll Lt Lm Lo Mn Mc Me Nd Nl No Pc Pd Ps Pe Pi Pf Po "
+    "Sm Sc Sk So Zs Zl Zp Cc Cf Cs Co Cn"
+).split()
+
+UPPERCASE = 1
+LOWERCASE = 2
+SPECIAL = 4
+
+MAX_CODE_POINT = 0x10FFFF
+
+
+def simple_mappings(cp):
+    c = chr(cp)
+    upper, lower, fold, title = c.upper(), c.lower(), c.casefold(), c.title()
+    if len(upper) == 1:
+        su = ord(upper)
+    elif len(title) == 1:
+        su = ord(title)
+    else:
+        su = cp
+    if len(lower) == 1:
+        sl = ord(lower)
+    else:
+        sl = 0x69 if cp == 0x130 else cp
+    if len(fold) == 1:
+        sf = ord(fold)
+    elif len(lower) == 1:
+        sf = ord(lower)
+    else:
+        sf = cp
+    return su, sl, sf
+
+
+def build():
+    records = {}
+    rows = []
+    special = []
+    for cp in range(MAX_CODE_POINT + 1):
+        c = chr(cp)
+        su, sl, sf = simple_mappings(cp)
+        full = (c.upper(), c.lower(), c.casefold())
+        flags = 0
+        if c.isupper():
+            flags |= UPPERCASE
+        if c.islower():
+            flags |= LOWERCASE
+        if any(len(m) > 1 for m in full):
+            flags |= SPECIAL
+            special.append((cp, full))
+        category = unicodedata.category(c)
+        rec = (
+            CATEGORIES.index(category),
+            flags,
+            unicodedata.decimal(c) if category == "Nd" else -1,
+            su - cp,
+            sl - cp,
+            sf - cp,
+        )
+        rows.append(records.setdefault(rec, len(records)))
+    return records, rows, special
+
+
+def split(rows, shift):
+    size = 1 << shift
+    blocks = {}
+    stage1 = []
+    for i in range(0, len(rows), size):
+        block = tuple(rows[i : i + size])
+        stage1.append(blocks.setdefault(block, len(blocks)))
+    return stage1, list(blocks)
+
+
+def ctype(n):
+    return "uint8_t" if n <= 256 else "uint16_t"
+
+
+def table_bytes(stage1, blocks, nrecords):
+    width1 = 1 if len(blocks) <= 256 else 2
+    width2 = 1 if nrecords <= 256 else 2
+    return len(stage1) * width1 + sum(len(b) for b in blocks) * width2
+
+
+def print_array(decl, values, per_line=16):
+    print("static const %s[] = {" % decl)
+    for i in range(0, len(values), per_line):
+        print("  " + ", ".join(str(v) for v in values[i : i + per_line]) + ",")
+    print("};")
+
+
+def code_points(s):
+    cps = [hex(ord(ch)) for ch in s] + ["0"] * (3 - len(s))
+    return "{ " + ", ".join(cps) + " }"
+
+
+def main():
+    records, rows, special = build()
+    shift = min(
+        range(4, 10),
+        key=lambda s: table_bytes(*split(rows, s), len(records)),
+    )
+    stage1, blocks = split(rows, shift)
+
+    print("/* Generated by tools/unidata.py from Unicode %s; do not edit.  */"
+          % unicodedata.unidata_version)
+    print()
+    print("#define UNIDATA_SHIFT %d" % shift)
+    print("#define UNIDATA_MASK %d" % ((1 << shift) - 1))
+    print()
+    print("static const unicode_record_t unidata_records[] = {")
+    for cat, flags, digit, du, dl, df in records:
+        print("  { UC_%s, %d, %d, %d, %d, %d }," % (CATEGORIES[cat], flags,
+                                                  digit, du, dl, df))
+    print("};")
+    print()
+    print_array("%s unidata_stage1" % ctype(len(blocks)), stage1)
+    print()
+    print_array("%s unidata_stage2" % ctype(len(records)),
+                [r for b in blocks for r in b])
+    print()
+    print("static const unicode_special_t unidata_special[] = {")
+    for cp, (upper, lower, fold) in special:
+        print("  { %s, %s, %s, %s }," % (hex(cp), code_points(upper),
+                                         code_points(lower), code_points(fold)))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()